@@ -1,3 +1,5 @@
+import time
+
 import numpy
 
 import dpnp
@@ -100,3 +102,67 @@ class Elementwise(Benchmark):
 
     def time_tanh(self, *args):
         self.np.tanh(self.a)
+
+
+# asv run --python=python --bench ElementwiseBandwidth
+# reports effective memory bandwidth of unary operations, bytes read and
+# written per second
+class ElementwiseBandwidth(Benchmark):
+    unary_ops = [
+        "arccos",
+        "arcsin",
+        "arctan",
+        "cbrt",
+        "ceil",
+        "conjugate",
+        "copy",
+        "cos",
+        "cosh",
+        "degrees",
+        "exp",
+        "exp2",
+        "expm1",
+        "fabs",
+        "floor",
+        "log",
+        "log10",
+        "log1p",
+        "log2",
+        "negative",
+        "radians",
+        "reciprocal",
+        "sign",
+        "sin",
+        "sinh",
+        "sqrt",
+        "square",
+        "tan",
+        "tanh",
+        "trunc",
+    ]
+    params = [
+        unary_ops,
+        [2**20, 2**24],
+        ["float64", "float32", "int64", "int32"],
+    ]
+    param_names = ["op", "size", "dtype"]
+    unit = "GB/s"
+    repeat_count = 10
+
+    def setup(self, op, size, dtype):
+        self.func = getattr(dpnp, op)
+        self.a = dpnp.arange(1, size + 1, dtype=getattr(dpnp, dtype))
+        try:
+            # warm-up builds the kernel and checks the type is supported
+            result = self.func(self.a)
+        except (NotImplementedError, TypeError, ValueError):
+            raise NotImplementedError
+        self.nbytes = self.a.nbytes + result.nbytes
+
+    def track_bandwidth(self, *args):
+        best = float("inf")
+        for _ in range(self.repeat_count):
+            start = time.perf_counter()
+            self.func(self.a)
+            best = min(best, time.perf_counter() - start)
+        return self.nbytes / best / 1e9
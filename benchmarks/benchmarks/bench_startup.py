@@ -0,0 +1,52 @@
+# asv run --python=python --bench Startup
+# timeraw_* benchmarks are executed in a new interpreter each time,
+# so they include the library load and the first kernel compilation
+class Startup:
+    repeat = 5
+    number = 1
+
+    def timeraw_import(self):
+        return "import dpnp"
+
+    def timeraw_first_call(self):
+        return """
+        import dpnp
+        a = dpnp.arange(1024, dtype=dpnp.float32)
+        dpnp.sum(a + a)
+        """
+
+    def timeraw_first_call_after_warmup(self):
+        return """
+        import dpnp
+        from dpnp.dpnp_algo import dpnp_warmup
+        dpnp_warmup(["dpnp_arange_c_kernel", "dpnp_sum_c_kernel",
+                     "dpnp_add_c_"])
+        a = dpnp.arange(1024, dtype=dpnp.float32)
+        dpnp.sum(a + a)
+        """
+
+
+# Time to the first result of a representative set of operations.
+# Compare builds with and without -DDPNP_SYCL_AOT_CPU=ON to see the cost of
+# the JIT compilation on CPU devices:
+# asv run --python=python --bench StartupOps
+class StartupOps:
+    repeat = 5
+    number = 1
+    params = [["add", "multiply", "sum", "sqrt", "matmul", "sort"]]
+    param_names = ["op"]
+
+    def timeraw_first_result(self, op):
+        return f"""
+        import dpnp
+        a = dpnp.ones((64, 64), dtype=dpnp.float32)
+        ops = {{
+            "add": lambda: a + a,
+            "multiply": lambda: a * a,
+            "sum": lambda: dpnp.sum(a),
+            "sqrt": lambda: dpnp.sqrt(a),
+            "matmul": lambda: dpnp.matmul(a, a),
+            "sort": lambda: dpnp.sort(a),
+        }}
+        dpnp.asnumpy(ops["{op}"]())
+        """
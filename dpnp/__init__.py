@@ -49,6 +49,49 @@ if system() == "Windows":
         [os.getenv("PATH", ""), mypath, dpctlpath]
     )
 
+
+def _load_aot_backend():
+    """
+    Load the backend library with AOT compiled CPU device code for the best
+    instruction set supported by the CPU, if it is built. The extensions then
+    link to the already loaded library instead of the JIT compiled one.
+
+    """
+
+    try:
+        from numpy._core._multiarray_umath import __cpu_features__
+    except ImportError:
+        try:
+            from numpy.core._multiarray_umath import __cpu_features__
+        except ImportError:
+            return
+
+    import ctypes
+
+    if system() == "Windows":
+        lib_name = "dpnp_backend_c.dll"
+        mode = ctypes.DEFAULT_MODE
+    else:
+        lib_name = "libdpnp_backend_c.so"
+        mode = ctypes.RTLD_GLOBAL
+
+    # same features as -march of the CPU device compiler
+    isa_features = [
+        ("avx512", ["AVX512F", "AVX512CD", "AVX512BW", "AVX512DQ", "AVX512VL"]),
+        ("avx2", ["AVX2", "FMA3"]),
+        ("avx", ["AVX"]),
+    ]
+    for isa, features in isa_features:
+        lib_path = os.path.join(mypath, isa, lib_name)
+        if os.path.isfile(lib_path) and all(
+            __cpu_features__.get(feature, False) for feature in features
+        ):
+            ctypes.CDLL(lib_path, mode=mode)
+            return
+
+
+_load_aot_backend()
+
 from dpnp.dpnp_array import dpnp_array as ndarray
 from dpnp.dpnp_flatiter import flatiter as flatiter
 from dpnp.dpnp_iface_types import *
@@ -27,18 +27,28 @@
  * Example BS.
  *
  * This example shows simple usage of the DPNP C++ Backend library
- * to calculate black scholes algorithm like in Python version
+ * to calculate black scholes algorithm like in Python version.
+ *
+ * The algorithm is computed twice: by a chain of backend functions with a
+ * temporary array per step, and by @ref dpnp_fusion expressions evaluated in
+ * a single kernel. Throughput of both versions is printed.
  *
  * Possible compile line:
  * . /opt/intel/oneapi/setvars.sh
- * g++ -g dpnp/backend/examples/example_bs.cpp -Idpnp -Idpnp/backend/include
- * -Ldpnp -Wl,-rpath='$ORIGIN'/dpnp -ldpnp_backend_c -o example_bs
+ * icpx -fsycl -O2 dpnp/backend/examples/example_bs.cpp -Idpnp
+ * -Idpnp/backend/include -Idpnp/backend/src -I$DPCTL_INCLUDE_DIR -Ldpnp
+ * -Wl,-rpath='$ORIGIN'/dpnp -ldpnp_backend_c -o example_bs
  */
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <iostream>
 
+#include "dpnp_fusion.hpp"
 #include "dpnp_iface.hpp"
+#include "dpnp_iface_random.hpp"
 
 void black_scholes(double *price,
                    double *strike,
@@ -51,6 +61,9 @@ void black_scholes(double *price,
 {
     const size_t ndim = 1;
     const size_t scalar_size = 1;
+    const shape_elem_type shape[] = {static_cast<shape_elem_type>(size)};
+    const shape_elem_type scalar_shape[] = {1};
+    const shape_elem_type strides[] = {1};
 
     double *mr = (double *)dpnp_memory_alloc_c(1 * sizeof(double));
     mr[0] = -rate;
@@ -73,161 +86,246 @@ void black_scholes(double *price,
 
     double *p_div_s = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // p_div_s = P / S
-    dpnp_divide_c<double, double, double>(p_div_s, P, size, &size, ndim, S,
-                                          size, &size, ndim, NULL);
+    dpnp_divide_c<double, double, double>(
+        p_div_s, size, ndim, shape, strides, P, size, ndim, shape, strides, S,
+        size, ndim, shape, strides, NULL);
     double *a = (double *)dpnp_memory_alloc_c(size * sizeof(double));
-    dpnp_log_c<double, double>(p_div_s, a, size); // a = np.log(p_div_s)
+    // a = np.log(p_div_s)
+    dpnp_log_c<double, double>(a, size, ndim, shape, strides, p_div_s, size,
+                               ndim, shape, strides, NULL);
     dpnp_memory_free_c(p_div_s);
 
     double *b = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // b = T * mr
     dpnp_multiply_c<double, double, double>(
-        b, T, size, &size, ndim, mr, scalar_size, &scalar_size, ndim, NULL);
+        b, size, ndim, shape, strides, T, size, ndim, shape, strides, mr,
+        scalar_size, ndim, scalar_shape, strides, NULL);
     dpnp_memory_free_c(mr);
     double *z = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // z = T * vol_vol_twos
-    dpnp_multiply_c<double, double, double>(z, T, size, &size, ndim,
-                                            vol_vol_two, scalar_size,
-                                            &scalar_size, ndim, NULL);
+    dpnp_multiply_c<double, double, double>(
+        z, size, ndim, shape, strides, T, size, ndim, shape, strides,
+        vol_vol_two, scalar_size, ndim, scalar_shape, strides, NULL);
     dpnp_memory_free_c(vol_vol_two);
 
     double *c = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // c = quarters * z
-    dpnp_multiply_c<double, double, double>(c, quarter, scalar_size,
-                                            &scalar_size, ndim, z, size, &size,
-                                            ndim, NULL);
+    dpnp_multiply_c<double, double, double>(
+        c, size, ndim, shape, strides, quarter, scalar_size, ndim,
+        scalar_shape, strides, z, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(quarter);
 
     double *sqrt_z = (double *)dpnp_memory_alloc_c(size * sizeof(double));
-    dpnp_sqrt_c<double, double>(z, sqrt_z, size); // sqrt_z = np.sqrt(z)
+    // sqrt_z = np.sqrt(z)
+    dpnp_sqrt_c<double, double>(sqrt_z, size, ndim, shape, strides, z, size,
+                                ndim, shape, strides, NULL);
     dpnp_memory_free_c(z);
     double *y = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // y = ones / np.sqrt(z)
-    dpnp_divide_c<double, double, double>(y, one, scalar_size, &scalar_size,
-                                          ndim, sqrt_z, size, &size, ndim,
-                                          NULL);
+    dpnp_divide_c<double, double, double>(
+        y, size, ndim, shape, strides, one, scalar_size, ndim, scalar_shape,
+        strides, sqrt_z, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(sqrt_z);
     dpnp_memory_free_c(one);
 
     double *a_sub_b = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // a_sub_b = a - b
-    dpnp_subtract_c<double, double, double>(a_sub_b, a, size, &size, ndim, b,
-                                            size, &size, ndim, NULL);
+    dpnp_subtract_c<double, double, double>(
+        a_sub_b, size, ndim, shape, strides, a, size, ndim, shape, strides, b,
+        size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(a);
     double *a_sub_b_add_c =
         (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // a_sub_b_add_c = a_sub_b + c
-    dpnp_add_c<double, double, double>(a_sub_b_add_c, a_sub_b, size, &size,
-                                       ndim, c, size, &size, ndim, NULL);
+    dpnp_add_c<double, double, double>(
+        a_sub_b_add_c, size, ndim, shape, strides, a_sub_b, size, ndim, shape,
+        strides, c, size, ndim, shape, strides, NULL);
     double *w1 = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // w1 = a_sub_b_add_c * y
-    dpnp_multiply_c<double, double, double>(w1, a_sub_b_add_c, size, &size,
-                                            ndim, y, size, &size, ndim, NULL);
+    dpnp_multiply_c<double, double, double>(
+        w1, size, ndim, shape, strides, a_sub_b_add_c, size, ndim, shape,
+        strides, y, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(a_sub_b_add_c);
 
     double *a_sub_b_sub_c =
         (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // a_sub_b_sub_c = a_sub_b - c
-    dpnp_subtract_c<double, double, double>(a_sub_b_sub_c, a_sub_b, size, &size,
-                                            ndim, c, size, &size, ndim, NULL);
+    dpnp_subtract_c<double, double, double>(
+        a_sub_b_sub_c, size, ndim, shape, strides, a_sub_b, size, ndim, shape,
+        strides, c, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(a_sub_b);
     dpnp_memory_free_c(c);
     double *w2 = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // w2 = a_sub_b_sub_c * y
-    dpnp_multiply_c<double, double, double>(w2, a_sub_b_sub_c, size, &size,
-                                            ndim, y, size, &size, ndim, NULL);
+    dpnp_multiply_c<double, double, double>(
+        w2, size, ndim, shape, strides, a_sub_b_sub_c, size, ndim, shape,
+        strides, y, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(a_sub_b_sub_c);
     dpnp_memory_free_c(y);
 
     double *erf_w1 = (double *)dpnp_memory_alloc_c(size * sizeof(double));
-    dpnp_erf_c<double>(w1, erf_w1, size); // erf_w1 = np.erf(w1)
+    // erf_w1 = np.erf(w1)
+    dpnp_erf_c<double>(erf_w1, size, ndim, shape, strides, w1, size, ndim,
+                       shape, strides, NULL);
     dpnp_memory_free_c(w1);
     double *halfs_mul_erf_w1 =
         (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // halfs_mul_erf_w1 = halfs * erf_w1
-    dpnp_multiply_c<double, double, double>(halfs_mul_erf_w1, half, scalar_size,
-                                            &scalar_size, ndim, erf_w1, size,
-                                            &size, ndim, NULL);
+    dpnp_multiply_c<double, double, double>(
+        halfs_mul_erf_w1, size, ndim, shape, strides, half, scalar_size, ndim,
+        scalar_shape, strides, erf_w1, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(erf_w1);
     double *d1 = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // d1 = halfs + halfs_mul_erf_w1
-    dpnp_add_c<double, double, double>(d1, half, scalar_size, &scalar_size,
-                                       ndim, halfs_mul_erf_w1, size, &size,
-                                       ndim, NULL);
+    dpnp_add_c<double, double, double>(
+        d1, size, ndim, shape, strides, half, scalar_size, ndim, scalar_shape,
+        strides, halfs_mul_erf_w1, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(halfs_mul_erf_w1);
 
     double *erf_w2 = (double *)dpnp_memory_alloc_c(size * sizeof(double));
-    dpnp_erf_c<double>(w2, erf_w2, size); // erf_w2 = np.erf(w2)
+    // erf_w2 = np.erf(w2)
+    dpnp_erf_c<double>(erf_w2, size, ndim, shape, strides, w2, size, ndim,
+                       shape, strides, NULL);
     dpnp_memory_free_c(w2);
     double *halfs_mul_erf_w2 =
         (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // halfs_mul_erf_w2 = halfs * erf_w2
-    dpnp_multiply_c<double, double, double>(halfs_mul_erf_w2, half, scalar_size,
-                                            &scalar_size, ndim, erf_w2, size,
-                                            &size, ndim, NULL);
+    dpnp_multiply_c<double, double, double>(
+        halfs_mul_erf_w2, size, ndim, shape, strides, half, scalar_size, ndim,
+        scalar_shape, strides, erf_w2, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(erf_w2);
     double *d2 = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // d2 = halfs + halfs_mul_erf_w2
-    dpnp_add_c<double, double, double>(d2, half, scalar_size, &scalar_size,
-                                       ndim, halfs_mul_erf_w2, size, &size,
-                                       ndim, NULL);
+    dpnp_add_c<double, double, double>(
+        d2, size, ndim, shape, strides, half, scalar_size, ndim, scalar_shape,
+        strides, halfs_mul_erf_w2, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(halfs_mul_erf_w2);
     dpnp_memory_free_c(half);
 
     double *exp_b = (double *)dpnp_memory_alloc_c(size * sizeof(double));
-    dpnp_exp_c<double, double>(b, exp_b, size); // exp_b = np.exp(b)
+    // exp_b = np.exp(b)
+    dpnp_exp_c<double, double>(exp_b, size, ndim, shape, strides, b, size,
+                               ndim, shape, strides, NULL);
     double *Se = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // Se = exp_b * S
-    dpnp_multiply_c<double, double, double>(Se, exp_b, size, &size, ndim, S,
-                                            size, &size, ndim, NULL);
+    dpnp_multiply_c<double, double, double>(
+        Se, size, ndim, shape, strides, exp_b, size, ndim, shape, strides, S,
+        size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(exp_b);
     dpnp_memory_free_c(b);
 
     double *P_mul_d1 = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // P_mul_d1 = P * d1
-    dpnp_multiply_c<double, double, double>(P_mul_d1, P, size, &size, ndim, d1,
-                                            size, &size, ndim, NULL);
+    dpnp_multiply_c<double, double, double>(
+        P_mul_d1, size, ndim, shape, strides, P, size, ndim, shape, strides,
+        d1, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(d1);
     double *Se_mul_d2 = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // Se_mul_d2 = Se * d2
-    dpnp_multiply_c<double, double, double>(Se_mul_d2, Se, size, &size, ndim,
-                                            d2, size, &size, ndim, NULL);
+    dpnp_multiply_c<double, double, double>(
+        Se_mul_d2, size, ndim, shape, strides, Se, size, ndim, shape, strides,
+        d2, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(d2);
     double *r = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // r = P_mul_d1 - Se_mul_d2
-    dpnp_subtract_c<double, double, double>(r, P_mul_d1, size, &size, ndim,
-                                            Se_mul_d2, size, &size, ndim, NULL);
+    dpnp_subtract_c<double, double, double>(
+        r, size, ndim, shape, strides, P_mul_d1, size, ndim, shape, strides,
+        Se_mul_d2, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(Se_mul_d2);
     dpnp_memory_free_c(P_mul_d1);
 
-    dpnp_copyto_c<double, double>(call, r, size); // call[:] = r
+    // call[:] = r
+    dpnp_copyto_c<double, double>(call, size, ndim, shape, strides, r, size,
+                                  ndim, shape, strides, NULL);
     double *r_sub_P = (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // r_sub_P = r - P
-    dpnp_subtract_c<double, double, double>(r_sub_P, r, size, &size, ndim, P,
-                                            size, &size, ndim, NULL);
+    dpnp_subtract_c<double, double, double>(
+        r_sub_P, size, ndim, shape, strides, r, size, ndim, shape, strides, P,
+        size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(r);
     double *r_sub_P_add_Se =
         (double *)dpnp_memory_alloc_c(size * sizeof(double));
     // r_sub_P_add_Se = r_sub_P + Se
-    dpnp_add_c<double, double, double>(r_sub_P_add_Se, r_sub_P, size, &size,
-                                       ndim, Se, size, &size, ndim, NULL);
+    dpnp_add_c<double, double, double>(
+        r_sub_P_add_Se, size, ndim, shape, strides, r_sub_P, size, ndim, shape,
+        strides, Se, size, ndim, shape, strides, NULL);
     dpnp_memory_free_c(r_sub_P);
     dpnp_memory_free_c(Se);
-    dpnp_copyto_c<double, double>(put, r_sub_P_add_Se,
-                                  size); // put[:] = r_sub_P_add_Se
+    // put[:] = r_sub_P_add_Se
+    dpnp_copyto_c<double, double>(put, size, ndim, shape, strides,
+                                  r_sub_P_add_Se, size, ndim, shape, strides,
+                                  NULL);
     dpnp_memory_free_c(r_sub_P_add_Se);
 }
 
-int main(int, char **)
+void black_scholes_fused(double *price,
+                         double *strike,
+                         double *t,
+                         const double rate,
+                         const double vol,
+                         double *call,
+                         double *put,
+                         const size_t size)
 {
-    const size_t SIZE = 256;
+    using namespace dpnp_fusion;
+
+    const auto P = input(price);
+    const auto S = input(strike);
+    const auto T = input(t);
+
+    const auto a = dpnp_log_c(P / S);
+    const auto b = T * -rate;
+    const auto z = T * (vol * vol * 2);
+    const auto c = 0.25 * z;
+    const auto y = 1. / dpnp_sqrt_c(z);
+    const auto w1 = (a - b + c) * y;
+    const auto w2 = (a - b - c) * y;
+    const auto d1 = 0.5 + 0.5 * dpnp_erf_c(w1);
+    const auto d2 = 0.5 + 0.5 * dpnp_erf_c(w2);
+    const auto Se = dpnp_exp_c(b) * S;
+    const auto r = P * d1 - Se * d2;
+
+    // call[:] = r, put[:] = r - P + Se in one pass over memory
+    evaluate(size, assign(call, r), assign(put, r - P + Se));
+}
+
+template <typename _Function>
+double options_per_second(_Function black_scholes_func,
+                          double *price,
+                          double *strike,
+                          double *t,
+                          double *call,
+                          double *put,
+                          const size_t size,
+                          const size_t repetitions)
+{
+    const double RISK_FREE = 0.1;
+    const double VOLATILITY = 0.2;
+
+    // warm-up run builds the kernels
+    black_scholes_func(price, strike, t, RISK_FREE, VOLATILITY, call, put,
+                       size);
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (size_t r = 0; r < repetitions; ++r) {
+        black_scholes_func(price, strike, t, RISK_FREE, VOLATILITY, call, put,
+                           size);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+
+    const std::chrono::duration<double> time = t1 - t0;
+    return static_cast<double>(size * repetitions) / time.count();
+}
+
+int main(int argc, char **argv)
+{
+    const size_t SIZE = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 256;
+    const size_t REPETITIONS = 10;
 
     const size_t SEED = 7777777;
     const long PL = 10, PH = 50;
     const long SL = 10, SH = 50;
     const long TL = 1, TH = 2;
-    const double RISK_FREE = 0.1;
-    const double VOLATILITY = 0.2;
 
     dpnp_queue_initialize_c(QueueOptions::GPU_SELECTOR);
     std::cout << "SYCL queue is CPU: " << dpnp_queue_is_cpu_c() << std::endl;
@@ -252,6 +350,8 @@ int main(int, char **)
 
     double *call = (double *)dpnp_memory_alloc_c(SIZE * sizeof(double));
     double *put = (double *)dpnp_memory_alloc_c(SIZE * sizeof(double));
+    double *call_fused = (double *)dpnp_memory_alloc_c(SIZE * sizeof(double));
+    double *put_fused = (double *)dpnp_memory_alloc_c(SIZE * sizeof(double));
 
     dpnp_full_c<double>(zero, call, SIZE); // np.full(SIZE, 0., dtype=DTYPE)
     dpnp_full_c<double>(mone, put, SIZE);  // np.full(SIZE, -1., dtype=DTYPE)
@@ -259,19 +359,38 @@ int main(int, char **)
     dpnp_memory_free_c(mone);
     dpnp_memory_free_c(zero);
 
-    black_scholes(price, strike, t, RISK_FREE, VOLATILITY, call, put, SIZE);
+    const double unfused_rate = options_per_second(
+        black_scholes, price, strike, t, call, put, SIZE, REPETITIONS);
+    const double fused_rate =
+        options_per_second(black_scholes_fused, price, strike, t, call_fused,
+                           put_fused, SIZE, REPETITIONS);
 
     std::cout << "call: ";
-    for (size_t i = 0; i < 10; ++i) {
+    for (size_t i = 0; i < std::min<size_t>(SIZE, 10); ++i) {
         std::cout << call[i] << ", ";
     }
     std::cout << "..." << std::endl;
     std::cout << "put: ";
-    for (size_t i = 0; i < 10; ++i) {
+    for (size_t i = 0; i < std::min<size_t>(SIZE, 10); ++i) {
         std::cout << put[i] << ", ";
     }
     std::cout << "..." << std::endl;
 
+    double max_diff = 0.;
+    for (size_t i = 0; i < SIZE; ++i) {
+        max_diff = std::max(max_diff, std::fabs(call[i] - call_fused[i]));
+        max_diff = std::max(max_diff, std::fabs(put[i] - put_fused[i]));
+    }
+
+    std::cout << "size: " << SIZE << ", repetitions: " << REPETITIONS
+              << std::endl;
+    std::cout << "unfused: " << unfused_rate << " options/s" << std::endl;
+    std::cout << "fused:   " << fused_rate << " options/s ("
+              << fused_rate / unfused_rate << "x)" << std::endl;
+    std::cout << "max difference: " << max_diff << std::endl;
+
+    dpnp_memory_free_c(put_fused);
+    dpnp_memory_free_c(call_fused);
     dpnp_memory_free_c(put);
     dpnp_memory_free_c(call);
 
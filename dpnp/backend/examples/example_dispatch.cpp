@@ -0,0 +1,150 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+/**
+ * Example of the function pointer dispatch cost.
+ *
+ * This example measures the time of @ref get_dpnp_function_ptr per call and
+ * compares it with a lookup in the nested std::map the functions were stored
+ * in before the dense table. The std::map is filled with the same entries.
+ *
+ * Possible compile line:
+ * . /opt/intel/oneapi/setvars.sh
+ * g++ -g -O2 dpnp/backend/examples/example_dispatch.cpp -Idpnp
+ * -Idpnp/backend/include -Ldpnp -Wl,-rpath='$ORIGIN'/dpnp -ldpnp_backend_c
+ * -o example_dispatch
+ */
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include "dpnp_iface_fptr.hpp"
+
+static const size_t repetitions = 1000;
+
+struct dispatch_key
+{
+    DPNPFuncName name;
+    DPNPFuncType first_type;
+    DPNPFuncType second_type;
+};
+
+typedef std::map<DPNPFuncType, DPNPFuncData_t> map_2p_t;
+typedef std::map<DPNPFuncType, map_2p_t> map_1p_t;
+typedef std::map<DPNPFuncName, map_1p_t> func_map_t;
+
+static const DPNPFuncData_t &map_lookup(const func_map_t &func_map,
+                                        const dispatch_key &key)
+{
+    // the same three lookups as the former get_dpnp_function_ptr
+    func_map_t::const_iterator func_it = func_map.find(key.name);
+    if (func_it == func_map.cend()) {
+        throw std::runtime_error("DPNP Error: Unsupported function call.");
+    }
+
+    map_1p_t::const_iterator type1_it = func_it->second.find(key.first_type);
+    if (type1_it == func_it->second.cend()) {
+        throw std::runtime_error("DPNP Error: Unsupported first type.");
+    }
+
+    map_2p_t::const_iterator type2_it = type1_it->second.find(key.second_type);
+    if (type2_it == type1_it->second.cend()) {
+        throw std::runtime_error("DPNP Error: Unsupported second type.");
+    }
+
+    return type2_it->second;
+}
+
+int main(int, char **)
+{
+    const DPNPFuncType types[] = {
+        DPNPFuncType::DPNP_FT_BOOL,  DPNPFuncType::DPNP_FT_INT,
+        DPNPFuncType::DPNP_FT_LONG,  DPNPFuncType::DPNP_FT_FLOAT,
+        DPNPFuncType::DPNP_FT_DOUBLE};
+
+    std::vector<dispatch_key> keys;
+    func_map_t func_map;
+
+    // the first call fills the table, it is measured separately
+    auto t0 = std::chrono::high_resolution_clock::now();
+    get_dpnp_function_ptr(DPNPFuncName::DPNP_FN_ADD_EXT,
+                          DPNPFuncType::DPNP_FT_DOUBLE);
+    auto t1 = std::chrono::high_resolution_clock::now();
+
+    for (size_t i = 0; i < static_cast<size_t>(DPNPFuncName::DPNP_FN_LAST); ++i)
+    {
+        const DPNPFuncName name = static_cast<DPNPFuncName>(i);
+        for (DPNPFuncType type1 : types) {
+            for (DPNPFuncType type2 : types) {
+                try {
+                    const DPNPFuncData_t data =
+                        get_dpnp_function_ptr(name, type1, type2);
+                    func_map[name][type1][type2] = data;
+                    keys.push_back({name, type1, type2});
+                } catch (const std::runtime_error &) {
+                    // not registered combination
+                }
+            }
+        }
+    }
+
+    size_t checksum = 0;
+
+    auto t2 = std::chrono::high_resolution_clock::now();
+    for (size_t r = 0; r < repetitions; ++r) {
+        for (const dispatch_key &key : keys) {
+            const DPNPFuncData_t data = get_dpnp_function_ptr(
+                key.name, key.first_type, key.second_type);
+            checksum += reinterpret_cast<size_t>(data.ptr);
+        }
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    for (size_t r = 0; r < repetitions; ++r) {
+        for (const dispatch_key &key : keys) {
+            const DPNPFuncData_t &data = map_lookup(func_map, key);
+            checksum -= reinterpret_cast<size_t>(data.ptr);
+        }
+    }
+    auto t4 = std::chrono::high_resolution_clock::now();
+
+    const double calls = static_cast<double>(repetitions * keys.size());
+    const std::chrono::duration<double, std::nano> table_time = t3 - t2;
+    const std::chrono::duration<double, std::nano> map_time = t4 - t3;
+    const std::chrono::duration<double, std::micro> init_time = t1 - t0;
+
+    std::cout << "registered functions: " << keys.size() << "\n"
+              << "table initialization: " << init_time.count() << " us\n"
+              << "table lookup: " << table_time.count() / calls
+              << " ns per call\n"
+              << "std::map lookup: " << map_time.count() / calls
+              << " ns per call\n"
+              << "checksum: " << checksum << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+/**
+ * Example host path calibration.
+ *
+ * This example measures kernels supporting the host path with the host path
+ * forced on and off for growing array sizes. The largest size where the host
+ * loop is faster becomes the threshold of the kernel. Thresholds are written
+ * into the calibration file to be used with "DPNPC_HOST_PATH_CALIBRATION"
+ * environment variable.
+ *
+ * Possible compile line:
+ * . /opt/intel/oneapi/setvars.sh
+ * g++ -g dpnp/backend/examples/example_host_path_calibration.cpp -Idpnp
+ * -Idpnp/backend/include -Ldpnp -Wl,-rpath='$ORIGIN'/dpnp -ldpnp_backend_c
+ * -o example_host_path_calibration
+ *
+ * Usage:
+ * ./example_host_path_calibration [calibration_file]
+ */
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "dpnp_iface.hpp"
+
+static const size_t max_calibration_size = 64 * 1024;
+static const size_t repetitions = 100;
+
+static double measure(const std::function<void(size_t)> &call, size_t size)
+{
+    call(size); // warm up
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < repetitions; ++i) {
+        call(size);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double>(t2 - t1).count() / repetitions;
+}
+
+static size_t calibrate(const std::string &op,
+                        const std::function<void(size_t)> &call)
+{
+    size_t threshold = 0;
+    for (size_t size = 1; size <= max_calibration_size; size *= 2) {
+        dpnp_host_path_set_threshold_c(op.c_str(),
+                                       std::numeric_limits<size_t>::max());
+        const double host_time = measure(call, size);
+
+        dpnp_host_path_set_threshold_c(op.c_str(), 0);
+        const double device_time = measure(call, size);
+
+        std::cout << op << " size=" << size << " host=" << host_time
+                  << " device=" << device_time << std::endl;
+
+        if (host_time > device_time) {
+            break;
+        }
+        threshold = size;
+    }
+
+    dpnp_host_path_set_threshold_c(op.c_str(), threshold);
+    return threshold;
+}
+
+int main(int argc, char *argv[])
+{
+    const std::string file_name =
+        (argc > 1) ? argv[1] : "dpnp_host_path_calibration.txt";
+
+    const size_t ndim = 1;
+    double *input1 = reinterpret_cast<double *>(
+        dpnp_memory_alloc_c(max_calibration_size * sizeof(double)));
+    double *input2 = reinterpret_cast<double *>(
+        dpnp_memory_alloc_c(max_calibration_size * sizeof(double)));
+    double *result = reinterpret_cast<double *>(
+        dpnp_memory_alloc_c(max_calibration_size * sizeof(double)));
+
+    double value = 1.0;
+    dpnp_initval_c<double>(input1, &value, max_calibration_size);
+    dpnp_initval_c<double>(input2, &value, max_calibration_size);
+
+    calibrate("dpnp_initval_c", [&](size_t size) {
+        dpnp_initval_c<double>(result, &value, size);
+    });
+
+    calibrate("dpnp_add_c", [&](size_t size) {
+        const shape_elem_type shape = size;
+        dpnp_add_c<double, double, double>(result, input1, size, &shape, ndim,
+                                           input2, size, &shape, ndim, NULL);
+    });
+
+    calibrate("dpnp_sin_c", [&](size_t size) {
+        dpnp_sin_c<double, double>(input1, result, size);
+    });
+
+    calibrate("dpnp_sum_c", [&](size_t size) {
+        const shape_elem_type shape = size;
+        dpnp_sum_c<double, double>(result, input1, &shape, ndim, NULL, 0, NULL,
+                                   NULL);
+    });
+
+    dpnp_host_path_save_c(file_name.c_str());
+    std::cout << "Calibration saved to " << file_name << std::endl;
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input2);
+    dpnp_memory_free_c(input1);
+
+    return 0;
+}
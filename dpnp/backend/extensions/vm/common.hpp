@@ -67,6 +67,65 @@ typedef sycl::event (*binary_impl_fn_ptr_t)(sycl::queue,
 namespace dpctl_td_ns = dpctl::tensor::type_dispatch;
 namespace py = pybind11;
 
+/**
+ * @brief Check if arrays index the same elements of memory in the same order.
+ *
+ * An elementwise result may be written in place of such an input.
+ */
+inline bool same_logical_tensors(dpctl::tensor::usm_ndarray src,
+                                 dpctl::tensor::usm_ndarray dst)
+{
+    if (src.get_data() != dst.get_data() ||
+        src.get_elemsize() != dst.get_elemsize() ||
+        src.get_ndim() != dst.get_ndim())
+    {
+        return false;
+    }
+    return (src.get_shape_vector() == dst.get_shape_vector()) &&
+           (src.get_strides_vector() == dst.get_strides_vector());
+}
+
+/**
+ * @brief Copy C-contiguous input array into a temporary device allocation.
+ *
+ * Used for an input partially overlapping the output, so only that input is
+ * duplicated. The temporary is released by @ref free_temporaries.
+ */
+inline std::pair<char *, sycl::event>
+    copy_to_temporary(sycl::queue exec_q,
+                      dpctl::tensor::usm_ndarray src,
+                      const size_t nelems,
+                      const std::vector<sycl::event> &depends)
+{
+    const size_t nbytes = nelems * src.get_elemsize();
+    char *tmp = sycl::malloc_device<char>(nbytes, exec_q);
+    if (tmp == nullptr) {
+        throw std::runtime_error("Unable to allocate device memory.");
+    }
+
+    sycl::event copy_ev =
+        exec_q.copy<char>(src.get_data(), tmp, nbytes, depends);
+    return std::make_pair(tmp, copy_ev);
+}
+
+/**
+ * @brief Free temporary allocations once the computation is done.
+ */
+inline sycl::event free_temporaries(sycl::queue exec_q,
+                                    const std::vector<char *> &temporaries,
+                                    const sycl::event &comp_ev)
+{
+    return exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(comp_ev);
+        const sycl::context ctx = exec_q.get_context();
+        cgh.host_task([ctx, temporaries]() {
+            for (char *tmp : temporaries) {
+                sycl::free(tmp, ctx);
+            }
+        });
+    });
+}
+
 template <typename dispatchT>
 std::pair<sycl::event, sycl::event>
     unary_ufunc(sycl::queue exec_q,
@@ -132,12 +191,6 @@ std::pair<sycl::event, sycl::event>
         }
     }
 
-    // check memory overlap
-    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
-    if (overlap(src, dst)) {
-        throw py::value_error("Arrays index overlapping segments of memory.");
-    }
-
     const char *src_data = src.get_data();
     char *dst_data = dst.get_data();
 
@@ -154,11 +207,30 @@ std::pair<sycl::event, sycl::event>
     if (dispatch_fn == nullptr) {
         throw py::value_error("No implementation is defined for ufunc.");
     }
+
+    // check memory overlap, the same array is computed in place and
+    // a partially overlapping input is read from a temporary copy
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    std::vector<sycl::event> comp_depends(depends);
+    std::vector<char *> temporaries;
+    if (overlap(src, dst) && !same_logical_tensors(src, dst)) {
+        auto tmp = copy_to_temporary(exec_q, src, src_nelems, depends);
+        src_data = tmp.first;
+        temporaries.push_back(tmp.first);
+        comp_depends.push_back(tmp.second);
+    }
+
     sycl::event comp_ev =
-        dispatch_fn(exec_q, src_nelems, src_data, dst_data, depends);
+        dispatch_fn(exec_q, src_nelems, src_data, dst_data, comp_depends);
+
+    std::vector<sycl::event> host_task_events = {comp_ev};
+    if (!temporaries.empty()) {
+        host_task_events.push_back(
+            free_temporaries(exec_q, temporaries, comp_ev));
+    }
 
     sycl::event ht_ev =
-        dpctl::utils::keep_args_alive(exec_q, {src, dst}, {comp_ev});
+        dpctl::utils::keep_args_alive(exec_q, {src, dst}, host_task_events);
     return std::make_pair(ht_ev, comp_ev);
 }
 
@@ -233,12 +305,6 @@ std::pair<sycl::event, sycl::event> binary_ufunc(
         }
     }
 
-    // check memory overlap
-    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
-    if (overlap(src1, dst) || overlap(src2, dst)) {
-        throw py::value_error("Arrays index overlapping segments of memory.");
-    }
-
     const char *src1_data = src1.get_data();
     const char *src2_data = src2.get_data();
     char *dst_data = dst.get_data();
@@ -258,11 +324,36 @@ std::pair<sycl::event, sycl::event> binary_ufunc(
     if (dispatch_fn == nullptr) {
         throw py::value_error("No implementation is defined for ufunc.");
     }
+
+    // check memory overlap, the same array is computed in place and
+    // a partially overlapping input is read from a temporary copy
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    std::vector<sycl::event> comp_depends(depends);
+    std::vector<char *> temporaries;
+    if (overlap(src1, dst) && !same_logical_tensors(src1, dst)) {
+        auto tmp = copy_to_temporary(exec_q, src1, src_nelems, depends);
+        src1_data = tmp.first;
+        temporaries.push_back(tmp.first);
+        comp_depends.push_back(tmp.second);
+    }
+    if (overlap(src2, dst) && !same_logical_tensors(src2, dst)) {
+        auto tmp = copy_to_temporary(exec_q, src2, src_nelems, depends);
+        src2_data = tmp.first;
+        temporaries.push_back(tmp.first);
+        comp_depends.push_back(tmp.second);
+    }
+
     sycl::event comp_ev = dispatch_fn(exec_q, src_nelems, src1_data, src2_data,
-                                      dst_data, depends);
+                                      dst_data, comp_depends);
 
-    sycl::event ht_ev =
-        dpctl::utils::keep_args_alive(exec_q, {src1, src2, dst}, {comp_ev});
+    std::vector<sycl::event> host_task_events = {comp_ev};
+    if (!temporaries.empty()) {
+        host_task_events.push_back(
+            free_temporaries(exec_q, temporaries, comp_ev));
+    }
+
+    sycl::event ht_ev = dpctl::utils::keep_args_alive(exec_q, {src1, src2, dst},
+                                                      host_task_events);
     return std::make_pair(ht_ev, comp_ev);
 }
 
@@ -336,11 +427,7 @@ bool need_to_call_unary_ufunc(sycl::queue exec_q,
         }
     }
 
-    // check memory overlap
-    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
-    if (overlap(src, dst)) {
-        return false;
-    }
+    // memory overlap is allowed, see unary_ufunc
 
     // suppport only contiguous inputs
     bool is_src_c_contig = src.is_c_contiguous();
@@ -443,11 +530,7 @@ bool need_to_call_binary_ufunc(sycl::queue exec_q,
         }
     }
 
-    // check memory overlap
-    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
-    if (overlap(src1, dst) || overlap(src2, dst)) {
-        return false;
-    }
+    // memory overlap is allowed, see binary_ufunc
 
     // suppport only contiguous inputs
     bool is_src1_c_contig = src1.is_c_contiguous();
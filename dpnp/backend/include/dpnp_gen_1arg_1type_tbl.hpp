@@ -59,7 +59,8 @@
      * dimensions. */                                                          \
     /** @param[in]  input1_shape       Input array 1 shape. */                 \
     /** @param[in]  input1_strides     Input array 1 strides. */               \
-    /** @param[in]  where              Where condition. */                     \
+    /** @param[in]  where              Mask of result_size elements in C       \
+     * order or nullptr, zero elements keep result_out unchanged. */           \
     /** @param[in]  dep_event_vec_ref  Reference to vector of SYCL             \
      * events. */                                                              \
     template <typename _DataType>                                              \
@@ -87,9 +88,10 @@ MACRO_1ARG_1TYPE_OP(dpnp_conjugate_c,
                     std::conj(input_elem),
                     q.submit(kernel_func))
 MACRO_1ARG_1TYPE_OP(dpnp_copy_c, input_elem, q.submit(kernel_func))
-MACRO_1ARG_1TYPE_OP(dpnp_erf_c,
-                    dispatch_erf_op(input_elem),
-                    oneapi::mkl::vm::erf(q, input1_size, input1_data, result))
+MACRO_1ARG_1TYPE_OP(
+    dpnp_erf_c,
+    dispatch_erf_op(input_elem),
+    oneapi::mkl::vm::erf(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_1TYPE_OP(dpnp_negative_c, -input_elem, q.submit(kernel_func))
 MACRO_1ARG_1TYPE_OP(
     dpnp_recip_c,
@@ -98,9 +100,10 @@ MACRO_1ARG_1TYPE_OP(
 MACRO_1ARG_1TYPE_OP(dpnp_sign_c,
                     dispatch_sign_op(input_elem),
                     q.submit(kernel_func)) // no sycl::sign for int and long
-MACRO_1ARG_1TYPE_OP(dpnp_square_c,
-                    input_elem *input_elem,
-                    oneapi::mkl::vm::sqr(q, input1_size, input1_data, result))
+MACRO_1ARG_1TYPE_OP(
+    dpnp_square_c,
+    input_elem *input_elem,
+    oneapi::mkl::vm::sqr(q, input1_size, input1_data, result, dep_events))
 
 #undef MACRO_1ARG_1TYPE_OP
 
@@ -61,7 +61,8 @@
      */                                                                        \
     /** @param[in]  input1_shape       Input array 1 shape. */                 \
     /** @param[in]  input1_strides     Input array 1 strides. */               \
-    /** @param[in]  where              Where condition. */                     \
+    /** @param[in]  where              Mask of result_size elements in C       \
+     * order or nullptr, zero elements keep result_out unchanged. */           \
     /** @param[in]  dep_event_vec_ref  Reference to vector of SYCL events.     \
      */                                                                        \
     template <typename _DataType_input, typename _DataType_output>             \
@@ -85,95 +86,112 @@
 
 #endif
 
-MACRO_1ARG_2TYPES_OP(dpnp_acos_c,
-                     sycl::acos(input_elem),
-                     oneapi::mkl::vm::acos(q, input1_size, input1_data, result))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_acos_c,
+    sycl::acos(input_elem),
+    oneapi::mkl::vm::acos(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(
     dpnp_acosh_c,
     sycl::acosh(input_elem),
-    oneapi::mkl::vm::acosh(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_asin_c,
-                     sycl::asin(input_elem),
-                     oneapi::mkl::vm::asin(q, input1_size, input1_data, result))
+    oneapi::mkl::vm::acosh(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_asin_c,
+    sycl::asin(input_elem),
+    oneapi::mkl::vm::asin(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(
     dpnp_asinh_c,
     sycl::asinh(input_elem),
-    oneapi::mkl::vm::asinh(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_atan_c,
-                     sycl::atan(input_elem),
-                     oneapi::mkl::vm::atan(q, input1_size, input1_data, result))
+    oneapi::mkl::vm::asinh(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_atan_c,
+    sycl::atan(input_elem),
+    oneapi::mkl::vm::atan(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(
     dpnp_atanh_c,
     sycl::atanh(input_elem),
-    oneapi::mkl::vm::atanh(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_cbrt_c,
-                     sycl::cbrt(input_elem),
-                     oneapi::mkl::vm::cbrt(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_ceil_c,
-                     sycl::ceil(input_elem),
-                     oneapi::mkl::vm::ceil(q, input1_size, input1_data, result))
+    oneapi::mkl::vm::atanh(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_cbrt_c,
+    sycl::cbrt(input_elem),
+    oneapi::mkl::vm::cbrt(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_ceil_c,
+    sycl::ceil(input_elem),
+    oneapi::mkl::vm::ceil(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(dpnp_copyto_c, input_elem, q.submit(kernel_func))
-MACRO_1ARG_2TYPES_OP(dpnp_cos_c,
-                     sycl::cos(input_elem),
-                     oneapi::mkl::vm::cos(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_cosh_c,
-                     sycl::cosh(input_elem),
-                     oneapi::mkl::vm::cosh(q, input1_size, input1_data, result))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_cos_c,
+    sycl::cos(input_elem),
+    oneapi::mkl::vm::cos(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_cosh_c,
+    sycl::cosh(input_elem),
+    oneapi::mkl::vm::cosh(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(dpnp_degrees_c,
                      sycl::degrees(input_elem),
                      q.submit(kernel_func))
-MACRO_1ARG_2TYPES_OP(dpnp_exp2_c,
-                     sycl::exp2(input_elem),
-                     oneapi::mkl::vm::exp2(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_exp_c,
-                     sycl::exp(input_elem),
-                     oneapi::mkl::vm::exp(q, input1_size, input1_data, result))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_exp2_c,
+    sycl::exp2(input_elem),
+    oneapi::mkl::vm::exp2(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_exp_c,
+    sycl::exp(input_elem),
+    oneapi::mkl::vm::exp(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(
     dpnp_expm1_c,
     sycl::expm1(input_elem),
-    oneapi::mkl::vm::expm1(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_fabs_c,
-                     sycl::fabs(input_elem),
-                     oneapi::mkl::vm::abs(q, input1_size, input1_data, result))
+    oneapi::mkl::vm::expm1(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_fabs_c,
+    sycl::fabs(input_elem),
+    oneapi::mkl::vm::abs(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(
     dpnp_floor_c,
     sycl::floor(input_elem),
-    oneapi::mkl::vm::floor(q, input1_size, input1_data, result))
+    oneapi::mkl::vm::floor(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(
     dpnp_log10_c,
     sycl::log10(input_elem),
-    oneapi::mkl::vm::log10(q, input1_size, input1_data, result))
+    oneapi::mkl::vm::log10(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(
     dpnp_log1p_c,
     sycl::log1p(input_elem),
-    oneapi::mkl::vm::log1p(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_log2_c,
-                     sycl::log2(input_elem),
-                     oneapi::mkl::vm::log2(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_log_c,
-                     sycl::log(input_elem),
-                     oneapi::mkl::vm::ln(q, input1_size, input1_data, result))
+    oneapi::mkl::vm::log1p(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_log2_c,
+    sycl::log2(input_elem),
+    oneapi::mkl::vm::log2(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_log_c,
+    sycl::log(input_elem),
+    oneapi::mkl::vm::ln(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(dpnp_radians_c,
                      sycl::radians(input_elem),
                      q.submit(kernel_func))
-MACRO_1ARG_2TYPES_OP(dpnp_sin_c,
-                     sycl::sin(input_elem),
-                     oneapi::mkl::vm::sin(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_sinh_c,
-                     sycl::sinh(input_elem),
-                     oneapi::mkl::vm::sinh(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_sqrt_c,
-                     sycl::sqrt(input_elem),
-                     oneapi::mkl::vm::sqrt(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_tan_c,
-                     sycl::tan(input_elem),
-                     oneapi::mkl::vm::tan(q, input1_size, input1_data, result))
-MACRO_1ARG_2TYPES_OP(dpnp_tanh_c,
-                     sycl::tanh(input_elem),
-                     oneapi::mkl::vm::tanh(q, input1_size, input1_data, result))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_sin_c,
+    sycl::sin(input_elem),
+    oneapi::mkl::vm::sin(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_sinh_c,
+    sycl::sinh(input_elem),
+    oneapi::mkl::vm::sinh(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_sqrt_c,
+    sycl::sqrt(input_elem),
+    oneapi::mkl::vm::sqrt(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_tan_c,
+    sycl::tan(input_elem),
+    oneapi::mkl::vm::tan(q, input1_size, input1_data, result, dep_events))
+MACRO_1ARG_2TYPES_OP(
+    dpnp_tanh_c,
+    sycl::tanh(input_elem),
+    oneapi::mkl::vm::tanh(q, input1_size, input1_data, result, dep_events))
 MACRO_1ARG_2TYPES_OP(
     dpnp_trunc_c,
     sycl::trunc(input_elem),
-    oneapi::mkl::vm::trunc(q, input1_size, input1_data, result))
+    oneapi::mkl::vm::trunc(q, input1_size, input1_data, result, dep_events))
 
 #undef MACRO_1ARG_2TYPES_OP
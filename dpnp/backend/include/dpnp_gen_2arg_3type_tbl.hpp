@@ -71,7 +71,8 @@
      */                                                                        \
     /** @param[in]  input2_shape       Input array 2 shape. */                 \
     /** @param[in]  input2_strides     Input array 2 strides. */               \
-    /** @param[in]  where              Where condition. */                     \
+    /** @param[in]  where              Mask of result_size elements in C       \
+     * order or nullptr, zero elements keep result_out unchanged. */           \
     /** @param[in]  dep_event_vec_ref  Reference to vector of SYCL events.     \
      */                                                                        \
     template <typename _DataType_input1, typename _DataType_input2,            \
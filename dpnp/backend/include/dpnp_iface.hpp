@@ -83,6 +83,60 @@ enum class QueueOptions : uint32_t
                      @ref CPU_SELECTOR default */
 };
 
+/**
+ * @ingroup BACKEND_API
+ * @brief NUMA placement of memory allocated for CPU devices.
+ *
+ * The policy is applied by @ref dpnp_memory_alloc_c "dpnp_memory_alloc" to
+ * pages of memory newly requested from the SYCL runtime.
+ */
+enum class NumaPolicy : uint32_t
+{
+    NONE,       /**< pages are placed by the thread touching them first */
+    LOCAL,      /**< pages are placed on the node of the allocating thread */
+    INTERLEAVE, /**< pages are spread page by page over the allowed nodes,
+                   Linux only */
+    FIRST_TOUCH /**< pages are written by a kernel partitioned as the
+                   elementwise kernels, so they are placed on the nodes of the
+                   threads processing them */
+};
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Direction of memory bound to a command graph.
+ *
+ * Selects the copies made by @ref dpnp_graph_replay_c "dpnp_graph_replay"
+ * between bound memory and the memory passed to the captured calls.
+ */
+enum class GraphBinding : uint32_t
+{
+    INPUT,  /**< read by the recorded commands, copied in before them */
+    OUTPUT, /**< written by the recorded commands, copied out after them */
+    INOUT   /**< copied in before the recorded commands and out after them */
+};
+
+/**
+ * Number of bins of @ref DPNPMemoryStats::histogram.
+ */
+#define DPNP_MEMORY_HISTOGRAM_SIZE 48
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Memory statistics of the backend allocations.
+ *
+ * The structure is filled by @ref dpnp_memory_stats_c "dpnp_memory_stats".
+ */
+struct DPNPMemoryStats
+{
+    size_t live_bytes;   /**< bytes allocated and not freed yet */
+    size_t peak_bytes;   /**< maximum of @ref live_bytes */
+    size_t alloc_count;  /**< number of allocations */
+    size_t staged_bytes; /**< bytes copied into or out of staging memory */
+    /**< number of allocations by size, bin i counts sizes in [2^i, 2^(i+1)),
+         the last bin counts all larger sizes */
+    size_t histogram[DPNP_MEMORY_HISTOGRAM_SIZE];
+};
+
 /**
  * @ingroup BACKEND_API
  * @brief SYCL queue initialization.
@@ -103,6 +157,73 @@ INP_DLLEXPORT void dpnp_queue_initialize_c(
  */
 INP_DLLEXPORT size_t dpnp_queue_is_cpu_c();
 
+/**
+ * @ingroup BACKEND_API
+ * @brief Bind SYCL queue to the calling thread.
+ *
+ * Kernels called from this thread without explicit queue reference run on
+ * the bound queue instead of the global one. So do the random number
+ * generation engines of the thread, seeded by
+ * @ref dpnp_rng_srand_c "dpnp_rng_srand" called from the thread. The queue
+ * is copied, so the caller may release its reference afterwards.
+ *
+ * @param [in]  q_ref  Reference to SYCL queue. nullptr restores the global
+ *                     queue for the calling thread.
+ */
+INP_DLLEXPORT void dpnp_queue_bind_thread_c(DPCTLSyclQueueRef q_ref);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Create in-order SYCL queues over NUMA domains of the CPU device.
+ *
+ * The CPU device of the current queue is partitioned by NUMA affinity domain
+ * and an in-order queue is created for each sub-device, up to @ref count.
+ * Queues are kept by the library and obtained with
+ * @ref dpnp_queue_get_sub_queue_c "dpnp_queue_get_sub_queue", typically to be
+ * bound to worker threads with
+ * @ref dpnp_queue_bind_thread_c "dpnp_queue_bind_thread".
+ *
+ * @param [in]  count  Maximum number of queues to create.
+ *
+ * @return  Number of created queues. It is 1 if the device can not be
+ *          partitioned.
+ */
+INP_DLLEXPORT size_t dpnp_queue_create_numa_sub_queues_c(size_t count);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Get SYCL queue created by
+ * @ref dpnp_queue_create_numa_sub_queues_c "dpnp_queue_create_numa_sub_queues".
+ *
+ * @param [in]  index  Index of the queue.
+ *
+ * @return  Reference to SYCL queue owned by the library. It stays valid when
+ *          the sub-queues are created again.
+ */
+INP_DLLEXPORT DPCTLSyclQueueRef dpnp_queue_get_sub_queue_c(size_t index);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Compile kernels for the queue device ahead of their first use.
+ *
+ * Kernels are JIT compiled by the SYCL runtime at their first submit.
+ * Warm-up moves the compilation to the call, compiled programs are kept in
+ * the SYCL runtime cache and reused by the kernel submits.
+ *
+ * @param [in]  q_ref         Reference to SYCL queue.
+ * @param [in]  kernel_names  Kernels with a name containing any of the strings
+ *                            are compiled, for example "dpnp_sum_c_kernel".
+ *                            nullptr means all kernels of the library.
+ * @param [in]  count         Number of strings in @ref kernel_names.
+ *
+ * @return Number of compiled kernels.
+ */
+INP_DLLEXPORT size_t dpnp_queue_warmup_c(DPCTLSyclQueueRef q_ref,
+                                         const char *const *kernel_names,
+                                         size_t count);
+INP_DLLEXPORT size_t dpnp_queue_warmup_c(const char *const *kernel_names,
+                                         size_t count);
+
 /**
  * @ingroup BACKEND_API
  * @brief SYCL queue memory allocation.
@@ -122,12 +243,300 @@ INP_DLLEXPORT char *dpnp_memory_alloc_c(size_t size_in_bytes);
 INP_DLLEXPORT void dpnp_memory_free_c(DPCTLSyclQueueRef q_ref, void *ptr);
 INP_DLLEXPORT void dpnp_memory_free_c(void *ptr);
 
+/**
+ * @ingroup BACKEND_API
+ * @brief SYCL queue memory deallocation after dependencies are complete.
+ *
+ * Memory is released by the host task submitted into the queue. The function
+ * returns immediately.
+ *
+ * @param [in]  q_ref              Reference to SYCL queue.
+ * @param [in]  ptr                Memory allocated by @ref dpnp_memory_alloc_c.
+ * @param [in]  dep_event_vec_ref  Reference to vector of SYCL events the memory
+ *                                 is used by.
+ *
+ * @return Event of the deallocation.
+ */
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_memory_free_async_c(DPCTLSyclQueueRef q_ref,
+                             void *ptr,
+                             const DPCTLEventVectorRef dep_event_vec_ref);
+
 INP_DLLEXPORT void dpnp_memory_memcpy_c(DPCTLSyclQueueRef q_ref,
                                         void *dst,
                                         const void *src,
                                         size_t size_in_bytes);
 INP_DLLEXPORT void
     dpnp_memory_memcpy_c(void *dst, const void *src, size_t size_in_bytes);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Release memory cached by the backend memory pool.
+ *
+ * Memory freed by @ref dpnp_memory_free_c is kept by the pool and reused by
+ * @ref dpnp_memory_alloc_c. This function returns idle memory to the SYCL
+ * runtime.
+ *
+ * @param [in]  q_ref  Reference to SYCL queue. Only memory of the queue context
+ *                     is released.
+ */
+INP_DLLEXPORT void dpnp_memory_pool_trim_c(DPCTLSyclQueueRef q_ref);
+INP_DLLEXPORT void dpnp_memory_pool_trim_c();
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Limit of the idle memory kept by the backend memory pool.
+ *
+ * Memory freed above the limit is returned to the SYCL runtime immediately.
+ * Zero value effectively disables caching.
+ *
+ * @param [in]  size_in_bytes  Limit in bytes.
+ */
+INP_DLLEXPORT void dpnp_memory_pool_set_high_water_mark_c(size_t size_in_bytes);
+INP_DLLEXPORT size_t dpnp_memory_pool_get_high_water_mark_c();
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Number of bytes copied by the backend to stage kernel arguments.
+ *
+ * Counts copies of the input data into memory accessible by the kernel or by
+ * the host and copies of the result back to the original memory. The counter
+ * is never reset, compare values taken before and after the code of interest.
+ *
+ * @return Number of bytes since the library load.
+ */
+INP_DLLEXPORT size_t dpnp_memory_staged_bytes_c();
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Set NUMA placement policy of the memory for CPU devices.
+ *
+ * Default is @ref NumaPolicy::NONE or the value of "DPNPC_MEMORY_NUMA_POLICY"
+ * environment variable ("local", "interleave", "first_touch").
+ *
+ * @param [in]  policy  Placement policy.
+ */
+INP_DLLEXPORT void dpnp_memory_set_numa_policy_c(NumaPolicy policy);
+INP_DLLEXPORT NumaPolicy dpnp_memory_get_numa_policy_c();
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Statistics of the memory allocated by @ref dpnp_memory_alloc_c.
+ *
+ * Requested sizes are counted, not the sizes of the pool blocks.
+ *
+ * @param [in]  q_ref     Reference to SYCL queue. Memory of the queue context
+ *                        and device is counted. nullptr means all queues.
+ * @param [in]  usm_type  USM kind "device", "shared" or "host". nullptr means
+ *                        all kinds.
+ * @param [out] stats     Statistics.
+ *
+ * @exception std::runtime_error  Unknown USM kind.
+ */
+INP_DLLEXPORT void dpnp_memory_stats_c(DPCTLSyclQueueRef q_ref,
+                                       const char *usm_type,
+                                       DPNPMemoryStats *stats);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Reset counters, histograms and peaks of the memory statistics.
+ *
+ * Live bytes are kept, peaks are set to them.
+ */
+INP_DLLEXPORT void dpnp_memory_stats_reset_c();
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Start tracking of the peak memory used by the code region.
+ *
+ * Regions belong to the calling thread. They might be nested and are closed
+ * by @ref dpnp_memory_region_end_c from the same thread in the reverse order.
+ *
+ * @param [in]  name  Name of the region.
+ */
+INP_DLLEXPORT void dpnp_memory_region_begin_c(const char *name);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Close the innermost region opened by @ref dpnp_memory_region_begin_c.
+ *
+ * @return Peak number of bytes allocated in the region above the amount
+ *         allocated at its start.
+ */
+INP_DLLEXPORT size_t dpnp_memory_region_end_c();
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Largest peak of the closed regions with the name.
+ *
+ * @param [in]  name  Name of the region.
+ *
+ * @return Peak in bytes or zero if no region with the name was closed.
+ */
+INP_DLLEXPORT size_t dpnp_memory_region_peak_c(const char *name);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Create an empty command graph for SYCL queue.
+ *
+ * Commands submitted to the queue between
+ * @ref dpnp_graph_begin_capture_c "dpnp_graph_begin_capture" and
+ * @ref dpnp_graph_end_capture_c "dpnp_graph_end_capture" are recorded instead
+ * of being executed, and executed later by
+ * @ref dpnp_graph_replay_c "dpnp_graph_replay" without the host overhead of
+ * the original calls. Only functions returning events (`_ext_c` kernels
+ * called with @ref q_ref) can be captured.
+ *
+ * @param [in]  q_ref  Reference to SYCL queue to capture.
+ *
+ * @return  Graph handle to be released by
+ *          @ref dpnp_graph_delete_c "dpnp_graph_delete".
+ */
+INP_DLLEXPORT void *dpnp_graph_create_c(DPCTLSyclQueueRef q_ref);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Start recording commands of the graph queue.
+ *
+ * Capturing a graph again records a new sequence of calls. The graph is
+ * updated instead of being built from scratch if the sequence has the same
+ * commands. To replay the same calls on other memory use
+ * @ref dpnp_graph_bind_c "dpnp_graph_bind" instead.
+ *
+ * Without SYCL command graph support the calls are executed at once and
+ * @ref dpnp_graph_replay_c "dpnp_graph_replay" fails.
+ *
+ * @param [in]  graph  Graph handle.
+ */
+INP_DLLEXPORT void dpnp_graph_begin_capture_c(void *graph);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Stop recording commands and prepare the graph for replay.
+ *
+ * @param [in]  graph  Graph handle.
+ */
+INP_DLLEXPORT void dpnp_graph_end_capture_c(void *graph);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Replay the graph on other memory than the captured one.
+ *
+ * Each replay copies input memory into the captured memory before the
+ * recorded commands and copies the captured memory to output memory after
+ * them.
+ *
+ * @param [in]  graph          Graph handle.
+ * @param [in]  captured       USM pointer passed to the captured calls.
+ * @param [in]  ptr            USM pointer to use instead, @ref captured to
+ *                             remove the binding.
+ * @param [in]  size_in_bytes  Size of the memory in bytes.
+ * @param [in]  direction      Copies made on each replay.
+ */
+INP_DLLEXPORT void dpnp_graph_bind_c(void *graph,
+                                     void *captured,
+                                     void *ptr,
+                                     size_t size_in_bytes,
+                                     GraphBinding direction);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Execute commands recorded in the graph.
+ *
+ * @param [in]  graph               Graph handle.
+ * @param [in]  dep_event_vec_ref   Reference to vector of SYCL events.
+ *
+ * @return  Event of the graph execution.
+ *
+ * @throw std::runtime_error  Without SYCL command graph support.
+ */
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_graph_replay_c(void *graph,
+                        const DPCTLEventVectorRef dep_event_vec_ref);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Release the graph and temporary memory owned by it.
+ *
+ * @param [in]  graph  Graph handle.
+ */
+INP_DLLEXPORT void dpnp_graph_delete_c(void *graph);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Set size threshold of the host path.
+ *
+ * Kernels supporting it compute results of at most @ref threshold elements
+ * on the calling thread instead of submitting to a CPU device.
+ *
+ * @param [in]  op         Kernel function name (e.g. "dpnp_add_c") or
+ *                         "default" for all kernels not set explicitly.
+ * @param [in]  threshold  Threshold in elements. 0 disables the host path.
+ */
+INP_DLLEXPORT void dpnp_host_path_set_threshold_c(const char *op,
+                                                  size_t threshold);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Get size threshold of the host path.
+ *
+ * @param [in]  op  Kernel function name.
+ *
+ * @return  Threshold in elements.
+ */
+INP_DLLEXPORT size_t dpnp_host_path_get_threshold_c(const char *op);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Read host path thresholds from calibration file.
+ *
+ * The file named by "DPNPC_HOST_PATH_CALIBRATION" environment variable is
+ * read at the first use of the host path.
+ *
+ * @param [in]  file_name  Name of the calibration file.
+ */
+INP_DLLEXPORT void dpnp_host_path_load_c(const char *file_name);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Write host path thresholds into calibration file.
+ *
+ * @param [in]  file_name  Name of the calibration file.
+ */
+INP_DLLEXPORT void dpnp_host_path_save_c(const char *file_name);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Enable tuning of elementwise kernel launch parameters.
+ *
+ * When enabled, work-group and vector sizes of an elementwise kernel are
+ * measured at its first use for each result type and size class on the
+ * device. Tuning is enabled by "DPNPC_LAUNCH_TUNING" environment variable
+ * set to a nonzero integer as well.
+ *
+ * @param [in]  enable  Nonzero to enable, 0 to disable.
+ */
+INP_DLLEXPORT void dpnp_launch_tuning_enable_c(size_t enable);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Read tuned launch parameters from cache file.
+ *
+ * The file named by "DPNPC_LAUNCH_TUNING_CACHE" environment variable is
+ * read at the first use of an elementwise kernel and updated by tuning.
+ *
+ * @param [in]  file_name  Name of the cache file.
+ */
+INP_DLLEXPORT void dpnp_launch_tuning_load_c(const char *file_name);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Write tuned launch parameters into cache file.
+ *
+ * @param [in]  file_name  Name of the cache file.
+ */
+INP_DLLEXPORT void dpnp_launch_tuning_save_c(const char *file_name);
+
 /**
  * @ingroup BACKEND_API
  * @brief Test whether all array elements along a given axis evaluate to True.
@@ -359,30 +768,39 @@ INP_DLLEXPORT void dpnp_matmul_c(void *result_out,
  * @ingroup BACKEND_API
  * @brief Compute the variance along the specified axis, while ignoring NaNs.
  *
+ * NaN are skipped on the device in a single pass, no mask or compacted copy
+ * of the input is made. All axes are reduced if @ref naxis is 0.
+ *
  * @param [in]  q_ref               Reference to SYCL queue.
- * @param [in]  array               Input array.
- * @param [in]  mask_arr            Input mask array when elem is nan.
+ * @param [in]  array               Input array with data.
  * @param [out] result              Output array.
- * @param [in]  result_size         Output array size.
- * @param [in]  size                Number of elements in input arrays.
+ * @param [in]  shape               Shape of input array.
+ * @param [in]  ndim                Number of elements in shape.
+ * @param [in]  axis                Axis.
+ * @param [in]  naxis               Number of elements in axis.
+ * @param [in]  ddof                Delta degrees of freedom.
  * @param [in]  dep_event_vec_ref   Reference to vector of SYCL events.
  */
-template <typename _DataType>
+template <typename _DataType, typename _ResultType>
 INP_DLLEXPORT DPCTLSyclEventRef
     dpnp_nanvar_c(DPCTLSyclQueueRef q_ref,
                   void *array,
-                  void *mask_arr,
                   void *result,
-                  const size_t result_size,
-                  size_t size,
+                  const shape_elem_type *shape,
+                  size_t ndim,
+                  const shape_elem_type *axis,
+                  size_t naxis,
+                  size_t ddof,
                   const DPCTLEventVectorRef dep_event_vec_ref);
 
-template <typename _DataType>
+template <typename _DataType, typename _ResultType>
 INP_DLLEXPORT void dpnp_nanvar_c(void *array,
-                                 void *mask_arr,
                                  void *result,
-                                 const size_t result_size,
-                                 size_t size);
+                                 const shape_elem_type *shape,
+                                 size_t ndim,
+                                 const shape_elem_type *axis,
+                                 size_t naxis,
+                                 size_t ddof);
 
 /**
  * @ingroup BACKEND_API
@@ -660,7 +1078,8 @@ INP_DLLEXPORT void dpnp_ediff1d_c(void *result_out,
  * @param [in]  axes_ndim         Number of elements in @ref axes
  * @param [in]  initial           Pointer to initial value for the algorithm.
  * @ref _DataType_input is expected
- * @param [in]  where             mask array
+ * @param [in]  where             Mask of @ref input_in elements or nullptr.
+ * Elements with zero mask are not summed.
  * @param [in]  dep_event_vec_ref Reference to vector of SYCL events.
  */
 template <typename _DataType_output, typename _DataType_input>
@@ -686,6 +1105,35 @@ INP_DLLEXPORT void dpnp_sum_c(void *result_out,
                               const void *initial,
                               const long *where);
 
+/**
+ * @ingroup BACKEND_API
+ * @brief Sum of array elements over given axes, treating NaN as zero.
+ *
+ * NaN are skipped on the device, no mask or copy of the input is made.
+ * All axes are reduced if @ref axes_ndim is 0.
+ *
+ * @param [in]  q_ref             Reference to SYCL queue.
+ * @param [out] result_out        Output array pointer. @ref _DataType_output
+ * type is expected
+ * @param [in]  input_in          Input array pointer. @ref _DataType_input type
+ * is expected
+ * @param [in]  input_shape       Shape of @ref input_in
+ * @param [in]  input_shape_ndim  Number of elements in @ref input_shape
+ * @param [in]  axes              Array of axes to apply to @ref input_shape
+ * @param [in]  axes_ndim         Number of elements in @ref axes
+ * @param [in]  dep_event_vec_ref Reference to vector of SYCL events.
+ */
+template <typename _DataType_output, typename _DataType_input>
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_nansum_c(DPCTLSyclQueueRef q_ref,
+                  void *result_out,
+                  const void *input_in,
+                  const shape_elem_type *input_shape,
+                  const size_t input_shape_ndim,
+                  const shape_elem_type *axes,
+                  const size_t axes_ndim,
+                  const DPCTLEventVectorRef dep_event_vec_ref);
+
 /**
  * @ingroup BACKEND_API
  * @brief Custom implementation of count_nonzero function
@@ -820,6 +1268,8 @@ INP_DLLEXPORT void dpnp_prod_c(void *result_out,
  * @ingroup BACKEND_API
  * @brief Range of values (maximum - minimum) along an axis.
  *
+ * Minimum and maximum are found in one pass, NaN is propagated.
+ *
  * @param [in]  q_ref               Reference to SYCL queue.
  * @param [out] result_out          Output array.
  * @param [in]  result_size         Size of output array.
@@ -1428,6 +1878,8 @@ INP_DLLEXPORT void dpnp_matrix_rank_c(void *array1_in,
  * @ingroup BACKEND_API
  * @brief math library implementation of max function
  *
+ * NaN is propagated. All axes are reduced if @ref naxis is 0.
+ *
  * @param [in]  q_ref               Reference to SYCL queue.
  * @param [in]  array1_in           Input array with data.
  * @param [out] result1             Output array.
@@ -1463,6 +1915,8 @@ INP_DLLEXPORT void dpnp_max_c(void *array1_in,
  * @ingroup BACKEND_API
  * @brief math library implementation of mean function
  *
+ * Computed in a single pass. All axes are reduced if @ref naxis is 0.
+ *
  * @param [in]  q_ref               Reference to SYCL queue.
  * @param [in]  array               Input array with data.
  * @param [out] result              Output array.
@@ -1491,6 +1945,33 @@ INP_DLLEXPORT void dpnp_mean_c(void *array,
                                const shape_elem_type *axis,
                                size_t naxis);
 
+/**
+ * @ingroup BACKEND_API
+ * @brief Mean along the specified axes, while ignoring NaNs.
+ *
+ * The mean of a slice of NaN only is NaN. All axes are reduced if
+ * @ref naxis is 0.
+ *
+ * @param [in]  q_ref               Reference to SYCL queue.
+ * @param [in]  array               Input array with data.
+ * @param [out] result              Output array.
+ * @param [in]  shape               Shape of input array.
+ * @param [in]  ndim                Number of elements in shape.
+ * @param [in]  axis                Axis.
+ * @param [in]  naxis               Number of elements in axis.
+ * @param [in]  dep_event_vec_ref   Reference to vector of SYCL events.
+ */
+template <typename _DataType, typename _ResultType>
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_nanmean_c(DPCTLSyclQueueRef q_ref,
+                   void *array,
+                   void *result,
+                   const shape_elem_type *shape,
+                   size_t ndim,
+                   const shape_elem_type *axis,
+                   size_t naxis,
+                   const DPCTLEventVectorRef dep_event_vec_ref);
+
 /**
  * @ingroup BACKEND_API
  * @brief math library implementation of median function
@@ -1527,6 +2008,8 @@ INP_DLLEXPORT void dpnp_median_c(void *array,
  * @ingroup BACKEND_API
  * @brief math library implementation of min function
  *
+ * NaN is propagated. All axes are reduced if @ref naxis is 0.
+ *
  * @param [in]  q_ref               Reference to SYCL queue.
  * @param [in]  array               Input array with data.
  * @param [out] result              Output array.
@@ -1558,6 +2041,64 @@ INP_DLLEXPORT void dpnp_min_c(void *array,
                               const shape_elem_type *axis,
                               size_t naxis);
 
+/**
+ * @ingroup BACKEND_API
+ * @brief Maximum along the specified axes, while ignoring NaNs.
+ *
+ * NaN are skipped on the device, the result of a slice of NaN only is NaN.
+ * All axes are reduced if @ref naxis is 0.
+ *
+ * @param [in]  q_ref               Reference to SYCL queue.
+ * @param [in]  array1_in           Input array with data.
+ * @param [out] result1             Output array.
+ * @param [in]  result_size         Output array size.
+ * @param [in]  shape               Shape of input array.
+ * @param [in]  ndim                Number of elements in shape.
+ * @param [in]  axis                Axis.
+ * @param [in]  naxis               Number of elements in axis.
+ * @param [in]  dep_event_vec_ref   Reference to vector of SYCL events.
+ */
+template <typename _DataType>
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_nanmax_c(DPCTLSyclQueueRef q_ref,
+                  void *array1_in,
+                  void *result1,
+                  const size_t result_size,
+                  const shape_elem_type *shape,
+                  size_t ndim,
+                  const shape_elem_type *axis,
+                  size_t naxis,
+                  const DPCTLEventVectorRef dep_event_vec_ref);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Minimum along the specified axes, while ignoring NaNs.
+ *
+ * NaN are skipped on the device, the result of a slice of NaN only is NaN.
+ * All axes are reduced if @ref naxis is 0.
+ *
+ * @param [in]  q_ref               Reference to SYCL queue.
+ * @param [in]  array1_in           Input array with data.
+ * @param [out] result1             Output array.
+ * @param [in]  result_size         Output array size.
+ * @param [in]  shape               Shape of input array.
+ * @param [in]  ndim                Number of elements in shape.
+ * @param [in]  axis                Axis.
+ * @param [in]  naxis               Number of elements in axis.
+ * @param [in]  dep_event_vec_ref   Reference to vector of SYCL events.
+ */
+template <typename _DataType>
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_nanmin_c(DPCTLSyclQueueRef q_ref,
+                  void *array1_in,
+                  void *result1,
+                  const size_t result_size,
+                  const shape_elem_type *shape,
+                  size_t ndim,
+                  const shape_elem_type *axis,
+                  size_t naxis,
+                  const DPCTLEventVectorRef dep_event_vec_ref);
+
 /**
  * @ingroup BACKEND_API
  * @brief math library implementation of argmax function
@@ -1600,6 +2141,120 @@ INP_DLLEXPORT DPCTLSyclEventRef
 template <typename _DataType, typename _idx_DataType>
 INP_DLLEXPORT void dpnp_argmin_c(void *array, void *result, size_t size);
 
+/**
+ * @ingroup BACKEND_API
+ * @brief Indices of the maximum values along an axis, as numpy.argmax.
+ *
+ * The first index is returned on ties, the first NaN if any.
+ *
+ * @param [in]  q_ref               Reference to SYCL queue.
+ * @param [in]  array               Input array with data.
+ * @param [out] result              Output array with indices, of the input
+ *                                  shape without the reduced axis.
+ * @param [in]  shape               Shape of input array.
+ * @param [in]  ndim                Number of elements in shape.
+ * @param [in]  axis                Axis to reduce over.
+ * @param [in]  naxis               Number of elements in axis, 0 to reduce
+ *                                  the flattened array, at most 1.
+ * @param [in]  dep_event_vec_ref   Reference to vector of SYCL events.
+ */
+template <typename _DataType, typename _idx_DataType>
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_argmax_axis_c(DPCTLSyclQueueRef q_ref,
+                    void *array,
+                    void *result,
+                    const shape_elem_type *shape,
+                    size_t ndim,
+                    const shape_elem_type *axis,
+                    size_t naxis,
+                    const DPCTLEventVectorRef dep_event_vec_ref);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Indices of the minimum values along an axis, as numpy.argmin.
+ *
+ * The first index is returned on ties, the first NaN if any.
+ *
+ * @param [in]  q_ref               Reference to SYCL queue.
+ * @param [in]  array               Input array with data.
+ * @param [out] result              Output array with indices, of the input
+ *                                  shape without the reduced axis.
+ * @param [in]  shape               Shape of input array.
+ * @param [in]  ndim                Number of elements in shape.
+ * @param [in]  axis                Axis to reduce over.
+ * @param [in]  naxis               Number of elements in axis, 0 to reduce
+ *                                  the flattened array, at most 1.
+ * @param [in]  dep_event_vec_ref   Reference to vector of SYCL events.
+ */
+template <typename _DataType, typename _idx_DataType>
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_argmin_axis_c(DPCTLSyclQueueRef q_ref,
+                    void *array,
+                    void *result,
+                    const shape_elem_type *shape,
+                    size_t ndim,
+                    const shape_elem_type *axis,
+                    size_t naxis,
+                    const DPCTLEventVectorRef dep_event_vec_ref);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Indices of the maximum values along an axis, as numpy.nanargmax.
+ *
+ * The first index is returned on ties. NaN are ignored, -1 is returned for
+ * a slice of NaN only.
+ *
+ * @param [in]  q_ref               Reference to SYCL queue.
+ * @param [in]  array               Input array with data.
+ * @param [out] result              Output array with indices, of the input
+ *                                  shape without the reduced axis.
+ * @param [in]  shape               Shape of input array.
+ * @param [in]  ndim                Number of elements in shape.
+ * @param [in]  axis                Axis to reduce over.
+ * @param [in]  naxis               Number of elements in axis, 0 to reduce
+ *                                  the flattened array, at most 1.
+ * @param [in]  dep_event_vec_ref   Reference to vector of SYCL events.
+ */
+template <typename _DataType, typename _idx_DataType>
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_nanargmax_axis_c(DPCTLSyclQueueRef q_ref,
+                    void *array,
+                    void *result,
+                    const shape_elem_type *shape,
+                    size_t ndim,
+                    const shape_elem_type *axis,
+                    size_t naxis,
+                    const DPCTLEventVectorRef dep_event_vec_ref);
+
+/**
+ * @ingroup BACKEND_API
+ * @brief Indices of the minimum values along an axis, as numpy.nanargmin.
+ *
+ * The first index is returned on ties. NaN are ignored, -1 is returned for
+ * a slice of NaN only.
+ *
+ * @param [in]  q_ref               Reference to SYCL queue.
+ * @param [in]  array               Input array with data.
+ * @param [out] result              Output array with indices, of the input
+ *                                  shape without the reduced axis.
+ * @param [in]  shape               Shape of input array.
+ * @param [in]  ndim                Number of elements in shape.
+ * @param [in]  axis                Axis to reduce over.
+ * @param [in]  naxis               Number of elements in axis, 0 to reduce
+ *                                  the flattened array, at most 1.
+ * @param [in]  dep_event_vec_ref   Reference to vector of SYCL events.
+ */
+template <typename _DataType, typename _idx_DataType>
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_nanargmin_axis_c(DPCTLSyclQueueRef q_ref,
+                    void *array,
+                    void *result,
+                    const shape_elem_type *shape,
+                    size_t ndim,
+                    const shape_elem_type *axis,
+                    size_t naxis,
+                    const DPCTLEventVectorRef dep_event_vec_ref);
+
 /**
  * @ingroup BACKEND_API
  * @brief math library implementation of around function
@@ -1631,6 +2286,9 @@ INP_DLLEXPORT void dpnp_around_c(const void *input_in,
  * @ingroup BACKEND_API
  * @brief math library implementation of std function
  *
+ * Computed in a single pass from the moments of the values. All axes are
+ * reduced if @ref naxis is 0.
+ *
  * @param [in]  q_ref               Reference to SYCL queue.
  * @param [in]  array               Input array with data.
  * @param [out] result              Output array with indeces.
@@ -1662,6 +2320,35 @@ INP_DLLEXPORT void dpnp_std_c(void *array,
                               size_t naxis,
                               size_t ddof);
 
+/**
+ * @ingroup BACKEND_API
+ * @brief Standard deviation along the specified axes, while ignoring NaNs.
+ *
+ * Computed in a single pass from the moments of the values. All axes are
+ * reduced if @ref naxis is 0.
+ *
+ * @param [in]  q_ref               Reference to SYCL queue.
+ * @param [in]  array               Input array with data.
+ * @param [out] result              Output array.
+ * @param [in]  shape               Shape of input array.
+ * @param [in]  ndim                Number of elements in shape.
+ * @param [in]  axis                Axis.
+ * @param [in]  naxis               Number of elements in axis.
+ * @param [in]  ddof                Delta degrees of freedom.
+ * @param [in]  dep_event_vec_ref   Reference to vector of SYCL events.
+ */
+template <typename _DataType, typename _ResultType>
+INP_DLLEXPORT DPCTLSyclEventRef
+    dpnp_nanstd_c(DPCTLSyclQueueRef q_ref,
+                  void *array,
+                  void *result,
+                  const shape_elem_type *shape,
+                  size_t ndim,
+                  const shape_elem_type *axis,
+                  size_t naxis,
+                  size_t ddof,
+                  const DPCTLEventVectorRef dep_event_vec_ref);
+
 /**
  * @ingroup BACKEND_API
  * @brief math library implementation of take function
@@ -1817,6 +2504,9 @@ INP_DLLEXPORT void dpnp_triu_c(void *array,
  * @ingroup BACKEND_API
  * @brief math library implementation of var function
  *
+ * Computed in a single pass from the moments of the values. All axes are
+ * reduced if @ref naxis is 0.
+ *
  * @param [in]  q_ref               Reference to SYCL queue.
  * @param [in]  array               Input array with data.
  * @param [out] result              Output array with indeces.
@@ -96,9 +96,13 @@ enum class DPNPFuncName : size_t
     DPNP_FN_ARGMAX,          /**< Used in numpy.argmax() impl  */
     DPNP_FN_ARGMAX_EXT,      /**< Used in numpy.argmax() impl, requires extra
                                 parameters */
+    DPNP_FN_ARGMAX_AXIS_EXT, /**< Used in numpy.argmax() impl over an axis,
+                                requires extra parameters */
     DPNP_FN_ARGMIN,          /**< Used in numpy.argmin() impl  */
     DPNP_FN_ARGMIN_EXT,      /**< Used in numpy.argmin() impl, requires extra
                                 parameters */
+    DPNP_FN_ARGMIN_AXIS_EXT, /**< Used in numpy.argmin() impl over an axis,
+                                requires extra parameters */
     DPNP_FN_ARGSORT,         /**< Used in numpy.argsort() impl  */
     DPNP_FN_ARGSORT_EXT,     /**< Used in numpy.argsort() impl, requires extra
                                 parameters */
@@ -296,6 +300,20 @@ enum class DPNPFuncName : size_t
     DPNP_FN_MULTIPLY, /**< Used in numpy.multiply() impl  */
     DPNP_FN_MULTIPLY_EXT,  /**< Used in numpy.multiply() impl, requires extra
                               parameters */
+    DPNP_FN_NANARGMAX_AXIS_EXT, /**< Used in numpy.nanargmax() impl, requires
+                                   extra parameters */
+    DPNP_FN_NANARGMIN_AXIS_EXT, /**< Used in numpy.nanargmin() impl, requires
+                                   extra parameters */
+    DPNP_FN_NANMAX_EXT,    /**< Used in numpy.nanmax() impl, requires extra
+                              parameters */
+    DPNP_FN_NANMEAN_EXT,   /**< Used in numpy.nanmean() impl, requires extra
+                              parameters */
+    DPNP_FN_NANMIN_EXT,    /**< Used in numpy.nanmin() impl, requires extra
+                              parameters */
+    DPNP_FN_NANSTD_EXT,    /**< Used in numpy.nanstd() impl, requires extra
+                              parameters */
+    DPNP_FN_NANSUM_EXT,    /**< Used in numpy.nansum() impl, requires extra
+                              parameters */
     DPNP_FN_NANVAR,        /**< Used in numpy.nanvar() impl  */
     DPNP_FN_NANVAR_EXT,    /**< Used in numpy.nanvar() impl, requires extra
                               parameters */
@@ -581,8 +599,10 @@ typedef struct DPNPFuncData
  * @ingroup BACKEND_API
  * @brief get runtime pointer to selected function
  *
- * Runtime pointer to the backend API function from storage map<name,
- * map<first_type, map<second_type, DPNPFuncData_t>>>
+ * Runtime pointer to the backend API function from storage
+ * table[name][first_type][second_type]. The lookup does not depend on the
+ * number of registered functions. Kernel family of the function is
+ * registered in the storage at the first lookup of the function.
  *
  * @param [in]  name         Name of the function in storage
  * @param [in]  first_type   First type of the storage
@@ -619,6 +639,19 @@ void *get_dpnp_function_ptr1(
     DPNPFuncType first_type,
     DPNPFuncType second_type = DPNPFuncType::DPNP_FT_NONE);
 
+/**
+ * @ingroup BACKEND_API
+ * @brief Register all kernel families.
+ *
+ * Kernel families are registered by @ref get_dpnp_function_ptr at the first
+ * lookup of their functions. This function registers all of them at once,
+ * for example to move the cost out of a latency critical section.
+ *
+ * @return Number of registered function names.
+ */
+INP_DLLEXPORT
+size_t dpnp_func_map_register_all_c();
+
 /**
  * DEPRECATED.
  * Experimental interface. DO NOT USE IT!
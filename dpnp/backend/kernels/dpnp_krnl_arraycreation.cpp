@@ -27,8 +27,10 @@
 
 #include "dpnp_fptr.hpp"
 #include "dpnp_iface.hpp"
+#include "dpnp_reduction.hpp"
 #include "dpnp_utils.hpp"
 #include "dpnpc_memory_adapter.hpp"
+#include "memory_pool_sycl.hpp"
 #include "queue_sycl.hpp"
 
 template <typename _KernelNameSpecialization>
@@ -46,9 +48,6 @@ DPCTLSyclEventRef dpnp_arange_c(DPCTLSyclQueueRef q_ref,
     // calculation algorithm
     // TODO: floating point (and negatives) types from `start` and `step`
 
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -56,6 +55,7 @@ DPCTLSyclEventRef dpnp_arange_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     sycl::event event;
 
     validate_type_for_device<_DataType>(q);
@@ -70,6 +70,7 @@ DPCTLSyclEventRef dpnp_arange_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_arange_c_kernel<_DataType>>(
             gws, kernel_parallel_for_func);
     };
@@ -138,10 +139,11 @@ DPCTLSyclEventRef dpnp_diag_c(DPCTLSyclQueueRef q_ref,
 {
     // avoid warning unused variable
     (void)res_ndim;
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     validate_type_for_device<_DataType>(q);
 
@@ -219,9 +221,6 @@ DPCTLSyclEventRef dpnp_eye_c(DPCTLSyclQueueRef q_ref,
                              const shape_elem_type *res_shape,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (result1 == nullptr) {
@@ -233,6 +232,8 @@ DPCTLSyclEventRef dpnp_eye_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     validate_type_for_device<_DataType>(q);
 
@@ -343,9 +344,6 @@ DPCTLSyclEventRef dpnp_identity_c(DPCTLSyclQueueRef q_ref,
                                   const size_t n,
                                   const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (n == 0) {
@@ -353,6 +351,7 @@ DPCTLSyclEventRef dpnp_identity_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     sycl::event event;
 
     validate_type_for_device<_DataType>(q);
@@ -367,6 +366,7 @@ DPCTLSyclEventRef dpnp_identity_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_identity_c_kernel<_DataType>>(
             gws, kernel_parallel_for_func);
     };
@@ -461,6 +461,20 @@ void dpnp_ones_like_c(void *result, size_t size)
 template <typename _DataType>
 void (*dpnp_ones_like_default_c)(void *, size_t) = dpnp_ones_like_c<_DataType>;
 
+template <typename _DataType>
+class dpnp_ptp_c_kernel;
+
+template <typename _DataType>
+class dpnp_ptp_strided_c_kernel;
+
+/// Accumulator of dpnp_ptp_c
+template <typename _DataType>
+struct dpnp_ptp_minmax
+{
+    _DataType min;
+    _DataType max;
+};
+
 template <typename _DataType>
 DPCTLSyclEventRef dpnp_ptp_c(DPCTLSyclQueueRef q_ref,
                              void *result1_out,
@@ -478,20 +492,15 @@ DPCTLSyclEventRef dpnp_ptp_c(DPCTLSyclQueueRef q_ref,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
     // avoid warning unused variable
-    (void)result_strides;
     (void)input_strides;
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
-    DPCTLSyclEventRef e1_ref = nullptr;
-    DPCTLSyclEventRef e2_ref = nullptr;
-    DPCTLSyclEventRef e3_ref = nullptr;
 
     if ((input1_in == nullptr) || (result1_out == nullptr)) {
         return event_ref;
     }
 
-    if (input_ndim < 1) {
+    if ((input_ndim < 1) || (input_size == 0)) {
         return event_ref;
     }
 
@@ -499,41 +508,102 @@ DPCTLSyclEventRef dpnp_ptp_c(DPCTLSyclQueueRef q_ref,
 
     validate_type_for_device<_DataType>(q);
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, input1_in, input_size, true);
-    DPNPC_ptr_adapter<_DataType> result_ptr(q_ref, result1_out, result_size,
-                                            false, true);
-    _DataType *arr = input1_ptr.get_ptr();
-    _DataType *result = result_ptr.get_ptr();
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    _DataType *min_arr = reinterpret_cast<_DataType *>(
-        sycl::malloc_shared(result_size * sizeof(_DataType), q));
-    _DataType *max_arr = reinterpret_cast<_DataType *>(
-        sycl::malloc_shared(result_size * sizeof(_DataType), q));
+    const _DataType *arr = static_cast<const _DataType *>(input1_in);
+    _DataType *result = static_cast<_DataType *>(result1_out);
 
-    e1_ref = dpnp_min_c<_DataType>(q_ref, arr, min_arr, result_size,
-                                   input_shape, input_ndim, axis, naxis, NULL);
-    e2_ref = dpnp_max_c<_DataType>(q_ref, arr, max_arr, result_size,
-                                   input_shape, input_ndim, axis, naxis, NULL);
+    // the reduction writes C order, a strided result is filled from a
+    // temporary one
+    bool result_is_contiguous = true;
+    if (result_strides != nullptr) {
+        shape_elem_type c_stride = 1;
+        for (size_t i = result_ndim; i-- > 0;) {
+            if ((result_shape[i] != 1) && (result_strides[i] != c_stride)) {
+                result_is_contiguous = false;
+            }
+            c_stride *= result_shape[i];
+        }
+    }
 
-    shape_elem_type *_strides = reinterpret_cast<shape_elem_type *>(
-        sycl::malloc_shared(result_ndim * sizeof(shape_elem_type), q));
-    get_shape_offsets_inkernel(result_shape, result_ndim, _strides);
+    _DataType *reduced = result;
+    if (!result_is_contiguous) {
+        reduced = dpnp_pool_malloc<_DataType>(result_size, q,
+                                              sycl::usm::alloc::device);
+    }
 
-    e3_ref = dpnp_subtract_c<_DataType, _DataType, _DataType>(
-        q_ref, result, result_size, result_ndim, result_shape, result_strides,
-        max_arr, result_size, result_ndim, result_shape, _strides, min_arr,
-        result_size, result_ndim, result_shape, _strides, NULL, NULL);
+    // minimum and maximum are found in one pass over the input
+    using minmax_t = dpnp_ptp_minmax<_DataType>;
+    const dpnp_minimum<_DataType> min_op;
+    const dpnp_maximum<_DataType> max_op;
+
+    sycl::event event =
+        dpnp_reduce_over_axes<class dpnp_ptp_c_kernel<_DataType>>(
+            q_ref, reduced, arr, input_shape, input_ndim, axis, naxis,
+            minmax_t{min_op.identity(), max_op.identity()},
+            [](const _DataType x) { return minmax_t{x, x}; },
+            [=](const minmax_t &x, const minmax_t &y) {
+                return minmax_t{min_op(x.min, y.min), max_op(x.max, y.max)};
+            },
+            [](const minmax_t &acc) {
+                return static_cast<_DataType>(acc.max - acc.min);
+            },
+            dep_events);
+
+    if (!result_is_contiguous) {
+        const size_t packed_size = 2 * result_ndim;
+
+        // shape and strides of up to DPNP_KERNEL_ARG_MAX_NDIM dimensions are
+        // passed to the kernel by value
+        dpnp_kernel_array<shape_elem_type, 2 * DPNP_KERNEL_ARG_MAX_NDIM>
+            packed_by_value{};
+        shape_elem_type *dev_packed = nullptr;
+        shape_elem_type *host_packed = packed_by_value.data;
+        if (result_ndim > DPNP_KERNEL_ARG_MAX_NDIM) {
+            dev_packed = dpnp_pool_malloc<shape_elem_type>(
+                packed_size, q, sycl::usm::alloc::device);
+            host_packed = dpnp_pool_malloc<shape_elem_type>(
+                packed_size, q, sycl::usm::alloc::host);
+        }
 
-    DPCTLEvent_Wait(e1_ref);
-    DPCTLEvent_Wait(e2_ref);
-    DPCTLEvent_Wait(e3_ref);
-    DPCTLEvent_Delete(e1_ref);
-    DPCTLEvent_Delete(e2_ref);
-    DPCTLEvent_Delete(e3_ref);
+        // packed vector is concatenation of result_shape and result_strides
+        std::copy(result_shape, result_shape + result_ndim, host_packed);
+        std::copy(result_strides, result_strides + result_ndim,
+                  host_packed + result_ndim);
 
-    sycl::free(min_arr, q);
-    sycl::free(max_arr, q);
-    sycl::free(_strides, q);
+        std::vector<sycl::event> strided_deps = {event};
+        if (dev_packed != nullptr) {
+            strided_deps.push_back(q.copy<shape_elem_type>(
+                host_packed, dev_packed, packed_size));
+        }
+
+        event = q.parallel_for<dpnp_ptp_strided_c_kernel<_DataType>>(
+            sycl::range<1>(result_size), strided_deps,
+            [=](sycl::id<1> global_id) {
+                const shape_elem_type *packed =
+                    dev_packed ? dev_packed : packed_by_value.data;
+
+                size_t id = global_id[0];
+                shape_elem_type offset = 0;
+                for (size_t i = result_ndim; i-- > 0;) {
+                    const size_t dim = static_cast<size_t>(packed[i]);
+                    offset += static_cast<shape_elem_type>(id % dim) *
+                              packed[result_ndim + i];
+                    id /= dim;
+                }
+                result[offset] = reduced[global_id[0]];
+            });
+
+        if (dev_packed != nullptr) {
+            dpnp_pool_free_async(q, {reduced, dev_packed, host_packed},
+                                 {event});
+        }
+        else {
+            dpnp_pool_free_async(q, {reduced}, {event});
+        }
+    }
+
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
 
     return DPCTLEvent_Copy(event_ref);
 }
@@ -701,9 +771,6 @@ DPCTLSyclEventRef dpnp_trace_c(DPCTLSyclQueueRef q_ref,
                                const size_t ndim,
                                const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!array1_in || !result_in || !shape_ || !ndim) {
@@ -718,6 +785,7 @@ DPCTLSyclEventRef dpnp_trace_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     validate_type_for_device<_DataType>(q);
     validate_type_for_device<_ResultType>(q);
@@ -738,6 +806,7 @@ DPCTLSyclEventRef dpnp_trace_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_trace_c_kernel<_DataType, _ResultType>>(
             gws, kernel_parallel_for_func);
     };
@@ -789,9 +858,6 @@ DPCTLSyclEventRef dpnp_tri_c(DPCTLSyclQueueRef q_ref,
                              const int k,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     sycl::event event;
@@ -801,6 +867,7 @@ DPCTLSyclEventRef dpnp_tri_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     validate_type_for_device<_DataType>(q);
 
@@ -826,6 +893,7 @@ DPCTLSyclEventRef dpnp_tri_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_tri_c_kernel<_DataType>>(
             gws, kernel_parallel_for_func);
     };
@@ -871,9 +939,6 @@ DPCTLSyclEventRef dpnp_tril_c(DPCTLSyclQueueRef q_ref,
                               const size_t res_ndim,
                               const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if ((array_in == nullptr) || (result1 == nullptr)) {
@@ -901,6 +966,8 @@ DPCTLSyclEventRef dpnp_tril_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     validate_type_for_device<_DataType>(q);
 
@@ -1005,9 +1072,6 @@ DPCTLSyclEventRef dpnp_triu_c(DPCTLSyclQueueRef q_ref,
                               const size_t res_ndim,
                               const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if ((array_in == nullptr) || (result1 == nullptr)) {
@@ -1035,6 +1099,8 @@ DPCTLSyclEventRef dpnp_triu_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     validate_type_for_device<_DataType>(q);
 
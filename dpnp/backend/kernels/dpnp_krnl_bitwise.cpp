@@ -30,6 +30,7 @@
 #include "dpnp_iterator.hpp"
 #include "dpnp_utils.hpp"
 #include "dpnpc_memory_adapter.hpp"
+#include "memory_pool_sycl.hpp"
 #include "queue_sycl.hpp"
 
 template <typename _KernelNameSpecialization>
@@ -42,12 +43,10 @@ DPCTLSyclEventRef dpnp_invert_c(DPCTLSyclQueueRef q_ref,
                                 size_t size,
                                 const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     sycl::event event;
 
     _DataType *input_data = static_cast<_DataType *>(array1_in);
@@ -102,6 +101,7 @@ DPCTLSyclEventRef dpnp_invert_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_invert_c_kernel<_DataType>>(
             sycl::nd_range<1>(gws_range, lws_range), kernel_parallel_for_func);
     };
@@ -180,7 +180,6 @@ static void func_map_init_bitwise_1arg_1type(func_map_t &fmap)
         /* avoid warning unused variable*/                                     \
         (void)result_shape;                                                    \
         (void)where;                                                           \
-        (void)dep_event_vec_ref;                                               \
                                                                                \
         DPCTLSyclEventRef event_ref = nullptr;                                 \
                                                                                \
@@ -189,6 +188,8 @@ static void func_map_init_bitwise_1arg_1type(func_map_t &fmap)
         }                                                                      \
                                                                                \
         sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));             \
+        std::vector<sycl::event> dep_events =                                  \
+            cast_event_vector(dep_event_vec_ref);                              \
                                                                                \
         _DataType *input1_data =                                               \
             static_cast<_DataType *>(const_cast<void *>(input1_in));           \
@@ -254,17 +255,17 @@ static void func_map_init_bitwise_1arg_1type(func_map_t &fmap)
                 }                                                              \
             };                                                                 \
             auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
                 cgh.parallel_for<                                              \
                     class __name__##_broadcast_kernel<_DataType>>(             \
                     gws, kernel_parallel_for_func);                            \
             };                                                                 \
                                                                                \
-            q.submit(kernel_func).wait();                                      \
+            event = q.submit(kernel_func);                                     \
+            event.wait();                                                      \
                                                                                \
             input1_it->~DPNPC_id();                                            \
             input2_it->~DPNPC_id();                                            \
-                                                                               \
-            return event_ref;                                                  \
         }                                                                      \
         else if (use_strides) {                                                \
             if ((result_ndim != input1_ndim) || (result_ndim != input2_ndim))  \
@@ -276,45 +277,55 @@ static void func_map_init_bitwise_1arg_1type(func_map_t &fmap)
                     " or input2 ndim=" + std::to_string(input2_ndim));         \
             }                                                                  \
                                                                                \
-            /* memory transfer optimization, use USM-host for temporary speeds \
-             * up tranfer to device */                                         \
-            using usm_host_allocatorT =                                        \
-                sycl::usm_allocator<shape_elem_type, sycl::usm::alloc::host>;  \
-                                                                               \
             size_t strides_size = 3 * result_ndim;                             \
-            shape_elem_type *dev_strides_data =                                \
-                sycl::malloc_device<shape_elem_type>(strides_size, q);         \
                                                                                \
-            /* create host temporary for packed strides managed by shared      \
-             * pointer */                                                      \
-            auto strides_host_packed =                                         \
-                std::vector<shape_elem_type, usm_host_allocatorT>(             \
-                    strides_size, usm_host_allocatorT(q));                     \
+            /* strides of up to DPNP_KERNEL_ARG_MAX_NDIM dimensions are passed \
+             * to the kernel by value, so no temporary USM memory is needed */ \
+            dpnp_kernel_array<shape_elem_type, 3 * DPNP_KERNEL_ARG_MAX_NDIM>   \
+                strides_by_value{};                                            \
+            shape_elem_type *dev_strides_data = nullptr;                       \
+            shape_elem_type *strides_host_packed = strides_by_value.data;      \
+                                                                               \
+            if (result_ndim > DPNP_KERNEL_ARG_MAX_NDIM) {                      \
+                dev_strides_data = dpnp_pool_malloc<shape_elem_type>(          \
+                    strides_size, q, sycl::usm::alloc::device);                \
+                                                                               \
+                /* memory transfer optimization, use USM-host for temporary    \
+                 * speeds up tranfer to device. Both temporaries are released  \
+                 * when the kernel is done */                                  \
+                strides_host_packed = dpnp_pool_malloc<shape_elem_type>(       \
+                    strides_size, q, sycl::usm::alloc::host);                  \
+            }                                                                  \
                                                                                \
             /* packed vector is concatenation of result_strides,               \
              * input1_strides and input2_strides */                            \
             std::copy(result_strides, result_strides + result_ndim,            \
-                      strides_host_packed.begin());                            \
+                      strides_host_packed);                                    \
             std::copy(input1_strides, input1_strides + result_ndim,            \
-                      strides_host_packed.begin() + result_ndim);              \
+                      strides_host_packed + result_ndim);                      \
             std::copy(input2_strides, input2_strides + result_ndim,            \
-                      strides_host_packed.begin() + 2 * result_ndim);          \
+                      strides_host_packed + 2 * result_ndim);                  \
                                                                                \
-            auto copy_strides_ev = q.copy<shape_elem_type>(                    \
-                strides_host_packed.data(), dev_strides_data,                  \
-                strides_host_packed.size());                                   \
+            std::vector<sycl::event> copy_strides_ev;                          \
+            if (dev_strides_data != nullptr) {                                 \
+                copy_strides_ev.push_back(q.copy<shape_elem_type>(             \
+                    strides_host_packed, dev_strides_data, strides_size));     \
+            }                                                                  \
                                                                                \
             auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {       \
                 const size_t output_id =                                       \
                     global_id[0]; /* for (size_t i = 0; i < result_size; ++i)  \
                                    */                                          \
                 {                                                              \
+                    const shape_elem_type *strides_data =                      \
+                        dev_strides_data ? dev_strides_data                    \
+                                         : strides_by_value.data;              \
                     const shape_elem_type *result_strides_data =               \
-                        &dev_strides_data[0];                                  \
+                        &strides_data[0];                                      \
                     const shape_elem_type *input1_strides_data =               \
-                        &dev_strides_data[result_ndim];                        \
+                        &strides_data[result_ndim];                            \
                     const shape_elem_type *input2_strides_data =               \
-                        &dev_strides_data[2 * result_ndim];                    \
+                        &strides_data[2 * result_ndim];                        \
                                                                                \
                     size_t input1_id = 0;                                      \
                     size_t input2_id = 0;                                      \
@@ -338,15 +349,17 @@ static void func_map_init_bitwise_1arg_1type(func_map_t &fmap)
                 }                                                              \
             };                                                                 \
             auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
                 cgh.depends_on(copy_strides_ev);                               \
                 cgh.parallel_for<class __name__##_strides_kernel<_DataType>>(  \
                     gws, kernel_parallel_for_func);                            \
             };                                                                 \
                                                                                \
-            q.submit(kernel_func).wait();                                      \
-                                                                               \
-            sycl::free(dev_strides_data, q);                                   \
-            return event_ref;                                                  \
+            event = q.submit(kernel_func);                                     \
+            if (dev_strides_data != nullptr) {                                 \
+                dpnp_pool_free_async(                                          \
+                    q, {dev_strides_data, strides_host_packed}, {event});      \
+            }                                                                  \
         }                                                                      \
         else {                                                                 \
             auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {       \
@@ -359,6 +372,7 @@ static void func_map_init_bitwise_1arg_1type(func_map_t &fmap)
                 result[i] = __operation__;                                     \
             };                                                                 \
             auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
                 cgh.parallel_for<class __name__##_kernel<_DataType>>(          \
                     gws, kernel_parallel_for_func);                            \
             };                                                                 \
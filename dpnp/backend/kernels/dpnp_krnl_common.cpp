@@ -30,6 +30,7 @@
 #include "dpnp_fptr.hpp"
 #include "dpnp_utils.hpp"
 #include "dpnpc_memory_adapter.hpp"
+#include "host_path.hpp"
 #include "queue_sycl.hpp"
 #include <dpnp_iface.hpp>
 
@@ -47,12 +48,10 @@ DPCTLSyclEventRef dpnp_astype_c(DPCTLSyclQueueRef q_ref,
                                 const size_t size,
                                 const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     sycl::event event;
 
     DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size);
@@ -74,6 +73,7 @@ DPCTLSyclEventRef dpnp_astype_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_astype_c_kernel<_DataType, _ResultType>>(
             gws, kernel_parallel_for_func);
     };
@@ -125,8 +125,6 @@ sycl::event dot(sycl::queue &queue,
                 size_t size,
                 const std::vector<sycl::event> &dependencies = {})
 {
-    (void)dependencies;
-
     sycl::event event;
 
     if constexpr ((std::is_same<_DataType_input1, double>::value ||
@@ -138,11 +136,12 @@ sycl::event dot(sycl::queue &queue,
                                        input1_strides, // input1 stride
                                        input2_in,
                                        input2_strides, // input2 stride
-                                       result_out);
+                                       result_out, dependencies);
     }
     else {
 #if LIBSYCL_VERSION_GREATER(5, 3, 0)
         event = queue.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
             cgh.parallel_for(
                 sycl::range<1>{size},
                 sycl::reduction(
@@ -173,6 +172,7 @@ sycl::event dot(sycl::queue &queue,
         };
 
         auto kernel_func = [&](sycl::handler &cgh) {
+            cgh.depends_on(dependencies);
             cgh.parallel_for<class dpnp_dot_c_kernel<
                 _DataType_output, _DataType_input1, _DataType_input2>>(
                 gws, kernel_parallel_for_func);
@@ -221,11 +221,9 @@ DPCTLSyclEventRef dpnp_dot_c(DPCTLSyclQueueRef q_ref,
                              const shape_elem_type *input2_strides,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     DPNPC_ptr_adapter<_DataType_input1> input1_ptr(q_ref, input1_in,
                                                    input1_size);
@@ -237,8 +235,8 @@ DPCTLSyclEventRef dpnp_dot_c(DPCTLSyclQueueRef q_ref,
 
     if (!input1_size || !input2_size) {
         _DataType_output val = _DataType_output(0);
-        dpnp_initval_c<_DataType_output>(result, &val, result_size);
-        return event_ref;
+        return dpnp_initval_c<_DataType_output>(q_ref, result, &val,
+                                                result_size, dep_event_vec_ref);
     }
 
     // scalar
@@ -246,21 +244,24 @@ DPCTLSyclEventRef dpnp_dot_c(DPCTLSyclQueueRef q_ref,
         // there is no support of strides in multiply function
         // so result can be wrong if input array has non-standard (c-contiguous)
         // strides
-        dpnp_multiply_c<_DataType_output, _DataType_input1, _DataType_input2>(
-            result, result_size, result_ndim, result_shape, result_strides,
-            input1_in, input1_size, input1_ndim, input1_shape, input1_strides,
-            input2_in, input2_size, input2_ndim, input2_shape, input2_strides,
-            NULL);
-        return event_ref;
+        return dpnp_multiply_c<_DataType_output, _DataType_input1,
+                               _DataType_input2>(
+            q_ref, result, result_size, result_ndim, result_shape,
+            result_strides, input1_in, input1_size, input1_ndim, input1_shape,
+            input1_strides, input2_in, input2_size, input2_ndim, input2_shape,
+            input2_strides, NULL, dep_event_vec_ref);
     }
 
     // if both arrays are vectors
     if ((input1_ndim == 1) && (input2_ndim == 1)) {
         assert(input1_size == input2_size);
         sycl::event event = dot(q, result, input1, input2, input1_strides[0],
-                                input2_strides[0], input1_size);
-        event.wait();
-        return event_ref;
+                                input2_strides[0], input1_size, dep_events);
+
+        input1_ptr.depends_on(event);
+        input2_ptr.depends_on(event);
+        event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+        return DPCTLEvent_Copy(event_ref);
     }
 
     // 1D vector
@@ -377,15 +378,17 @@ DPCTLSyclEventRef dpnp_dot_c(DPCTLSyclQueueRef q_ref,
                         _DataType_output(1), // alpha
                         input1, lda, input2, ldb,
                         _DataType_output(0), // beta
-                        result, ldc);
-                    event.wait();
+                        result, ldc, dep_events);
                     delete[] ext_input1_shape;
                     delete[] ext_input1_strides;
                     delete[] ext_input2_shape;
                     delete[] ext_input2_strides;
                     delete[] ext_result_shape;
 
-                    return event_ref;
+                    input1_ptr.depends_on(event);
+                    input2_ptr.depends_on(event);
+                    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+                    return DPCTLEvent_Copy(event_ref);
                 } catch (const std::exception &e) {
                     // do nothing, proceed to general case
                 }
@@ -424,8 +427,8 @@ DPCTLSyclEventRef dpnp_dot_c(DPCTLSyclQueueRef q_ref,
         dot_in2 = dot_in2 + res_coords[ext_input1_ndim + ext_input2_ndim - 3] *
                                 ext_input2_strides[ext_input2_ndim - 1];
 
-        dot_events.push_back(
-            dot(q, dot_res, dot_in1, dot_in2, dot_st1, dot_st2, dot_size));
+        dot_events.push_back(dot(q, dot_res, dot_in1, dot_in2, dot_st1,
+                                 dot_st2, dot_size, dep_events));
     }
 
     sycl::event::wait(dot_events);
@@ -528,9 +531,6 @@ DPCTLSyclEventRef dpnp_eig_c(DPCTLSyclQueueRef q_ref,
     // because interface requires float type but calculations are expected in
     // double type
 
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -538,6 +538,8 @@ DPCTLSyclEventRef dpnp_eig_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
     sycl::event event;
 
     DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array_in, size * size, true);
@@ -645,9 +647,6 @@ DPCTLSyclEventRef dpnp_eigvals_c(DPCTLSyclQueueRef q_ref,
     // because interface requires float type but calculations are expected in
     // double type
 
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -655,6 +654,8 @@ DPCTLSyclEventRef dpnp_eigvals_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
     sycl::event event;
 
     DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array_in, size * size, true);
@@ -735,9 +736,6 @@ DPCTLSyclEventRef dpnp_initval_c(DPCTLSyclQueueRef q_ref,
                                  size_t size,
                                  const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -745,11 +743,20 @@ DPCTLSyclEventRef dpnp_initval_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     _DataType val = *(static_cast<_DataType *>(value));
 
     validate_type_for_device<_DataType>(q);
 
-    auto event = q.fill<_DataType>(result, val, size);
+    if (dpnp_host_path(q, "dpnp_initval_c", size, dep_events)) {
+        std::fill_n(static_cast<_DataType *>(result), size, val);
+
+        sycl::event event;
+        event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+        return DPCTLEvent_Copy(event_ref);
+    }
+
+    auto event = q.fill<_DataType>(result, val, size, dep_events);
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
 
     return DPCTLEvent_Copy(event_ref);
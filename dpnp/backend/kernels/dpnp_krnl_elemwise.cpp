@@ -32,8 +32,169 @@
 #include "dpnp_iterator.hpp"
 #include "dpnp_utils.hpp"
 #include "dpnpc_memory_adapter.hpp"
+#include "host_path.hpp"
+#include "launch_tuner.hpp"
+#include "memory_pool_sycl.hpp"
 #include "queue_sycl.hpp"
 
+/**
+ * Tuned launch parameters of elementwise operation @ref op_name.
+ *
+ * @ref submit(params, scratch) runs the kernel storing the result into
+ * @ref scratch, an array of @ref size elements allocated only if the tuner
+ * measures the kernel, so the inputs stay intact even for in-place calls.
+ */
+template <typename _DataType_output, typename _Submit>
+static dpnp_launch_params dpnp_elemwise_launch_params(sycl::queue &q,
+                                                      const char *op_name,
+                                                      const size_t size,
+                                                      const _Submit &submit)
+{
+    _DataType_output *scratch = nullptr;
+    const dpnp_launch_params launch = DPNPC_launch_tuner::get_instance().get(
+        q, op_name, dpnp_launch_type_name<_DataType_output>(), size,
+        [&](const dpnp_launch_params &candidate) {
+            if (scratch == nullptr) {
+                scratch = dpnp_pool_malloc<_DataType_output>(
+                    size, q, sycl::usm::alloc::device);
+            }
+            return submit(candidate, scratch);
+        });
+
+    if (scratch != nullptr) {
+        // the tuner waits for all the runs
+        dpnp_pool_free_async(q, {scratch}, {});
+    }
+
+    return launch;
+}
+
+template <typename _KernelNameSpecialization1,
+          typename _KernelNameSpecialization2>
+class dpnp_unary_sg_kernel;
+
+/**
+ * Submit a kernel applying unary operation @ref op to contiguous arrays.
+ *
+ * Each sub-group loads and stores vectors of @ref launch.vec_sz elements per
+ * work item, the tail of the arrays is processed per element. Elements with
+ * zero @ref where keep the previous result.
+ */
+template <typename _KernelName,
+          typename _DataType_input,
+          typename _DataType_output,
+          typename _Operation>
+static sycl::event
+    dpnp_unary_sg_submit(sycl::queue &q,
+                         const dpnp_launch_params &launch,
+                         _DataType_input *input1_data,
+                         _DataType_output *result,
+                         const size_t result_size,
+                         const size_t *where,
+                         const _Operation op,
+                         const std::vector<sycl::event> &dep_events)
+{
+    auto submit_vec = [&](auto vec_sz_type) {
+        constexpr unsigned int vec_sz = decltype(vec_sz_type)::value;
+        constexpr sycl::access::address_space global_space =
+            sycl::access::address_space::global_space;
+
+        const size_t lws = launch.lws;
+        auto gws_range = sycl::range<1>(
+            ((result_size + lws * vec_sz - 1) / (lws * vec_sz)) * lws);
+        auto lws_range = sycl::range<1>(lws);
+
+        auto kernel_parallel_for_func = [=](sycl::nd_item<1> nd_it) {
+            auto sg = nd_it.get_sub_group();
+            const auto max_sg_size = sg.get_max_local_range()[0];
+            const size_t start =
+                vec_sz * (nd_it.get_group(0) * nd_it.get_local_range(0) +
+                          sg.get_group_id()[0] * max_sg_size);
+
+            if (start + static_cast<size_t>(vec_sz) * max_sg_size <
+                result_size) {
+                using input_ptrT =
+                    sycl::multi_ptr<_DataType_input, global_space>;
+                using result_ptrT =
+                    sycl::multi_ptr<_DataType_output, global_space>;
+
+                const sycl::vec<_DataType_input, vec_sz> x =
+                    sg.load<vec_sz>(input_ptrT(&input1_data[start]));
+                sycl::vec<_DataType_output, vec_sz> res_vec;
+                for (size_t k = 0; k < vec_sz; ++k) {
+                    res_vec[k] = op(x[k]);
+                }
+
+                if (where != nullptr) {
+                    /* masked lanes keep the previous result */
+                    using where_ptrT = sycl::multi_ptr<size_t, global_space>;
+                    const sycl::vec<size_t, vec_sz> mask = sg.load<vec_sz>(
+                        where_ptrT(const_cast<size_t *>(&where[start])));
+                    const sycl::vec<_DataType_output, vec_sz> prev =
+                        sg.load<vec_sz>(result_ptrT(&result[start]));
+                    res_vec = dpnp_vec_select(mask, res_vec, prev);
+                }
+                sg.store<vec_sz>(result_ptrT(&result[start]), res_vec);
+            }
+            else {
+                for (size_t k = start + sg.get_local_id()[0]; k < result_size;
+                     k += max_sg_size)
+                {
+                    if ((where != nullptr) && !where[k]) {
+                        continue;
+                    }
+                    result[k] = op(input1_data[k]);
+                }
+            }
+        };
+
+        auto kernel_func = [&](sycl::handler &cgh) {
+            cgh.depends_on(dep_events);
+            cgh.parallel_for<class dpnp_unary_sg_kernel<
+                _KernelName, decltype(vec_sz_type)>>(
+                sycl::nd_range<1>(gws_range, lws_range),
+                kernel_parallel_for_func);
+        };
+
+        return q.submit(kernel_func);
+    };
+
+    return dpnp_launch_vec_sz_dispatch(launch.vec_sz, submit_vec);
+}
+
+/**
+ * Submit a kernel applying unary operation @ref op to contiguous arrays with
+ * the launch parameters tuned for operation @ref op_name.
+ */
+template <typename _KernelName,
+          typename _DataType_input,
+          typename _DataType_output,
+          typename _Operation>
+static sycl::event
+    dpnp_unary_sg_submit(sycl::queue &q,
+                         const char *op_name,
+                         _DataType_input *input1_data,
+                         _DataType_output *result,
+                         const size_t result_size,
+                         const size_t *where,
+                         const _Operation op,
+                         const std::vector<sycl::event> &dep_events)
+{
+    const dpnp_launch_params launch =
+        dpnp_elemwise_launch_params<_DataType_output>(
+            q, op_name, result_size,
+            [&](const dpnp_launch_params &candidate,
+                _DataType_output *scratch) {
+                return dpnp_unary_sg_submit<_KernelName>(
+                    q, candidate, input1_data, scratch, result_size, nullptr,
+                    op, dep_events);
+            });
+
+    return dpnp_unary_sg_submit<_KernelName>(q, launch, input1_data, result,
+                                             result_size, where, op,
+                                             dep_events);
+}
+
 #define MACRO_1ARG_2TYPES_OP(__name__, __operation1__, __operation2__)         \
     template <typename _KernelNameSpecialization1,                             \
               typename _KernelNameSpecialization2>                             \
@@ -43,6 +204,10 @@
               typename _KernelNameSpecialization2>                             \
     class __name__##_strides_kernel;                                           \
                                                                                \
+    template <typename _KernelNameSpecialization1,                             \
+              typename _KernelNameSpecialization2>                             \
+    class __name__##_sg_kernel;                                                \
+                                                                               \
     template <typename _DataType_input, typename _DataType_output>             \
     DPCTLSyclEventRef __name__(                                                \
         DPCTLSyclQueueRef q_ref, void *result_out, const size_t result_size,   \
@@ -55,8 +220,6 @@
     {                                                                          \
         /* avoid warning unused variable*/                                     \
         (void)result_shape;                                                    \
-        (void)where;                                                           \
-        (void)dep_event_vec_ref;                                               \
                                                                                \
         DPCTLSyclEventRef event_ref = nullptr;                                 \
                                                                                \
@@ -65,6 +228,8 @@
         }                                                                      \
                                                                                \
         sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));             \
+        std::vector<sycl::event> dep_events =                                  \
+            cast_event_vector(dep_event_vec_ref);                              \
                                                                                \
         _DataType_input *input1_data =                                         \
             static_cast<_DataType_input *>(const_cast<void *>(input1_in));     \
@@ -91,40 +256,53 @@
                     std::to_string(input1_ndim));                              \
             }                                                                  \
                                                                                \
-            /* memory transfer optimization, use USM-host for temporary speeds \
-             * up tranfer to device */                                         \
-            using usm_host_allocatorT =                                        \
-                sycl::usm_allocator<shape_elem_type, sycl::usm::alloc::host>;  \
-                                                                               \
             size_t strides_size = 2 * result_ndim;                             \
-            shape_elem_type *dev_strides_data =                                \
-                sycl::malloc_device<shape_elem_type>(strides_size, q);         \
                                                                                \
-            /* create host temporary for packed strides managed by shared      \
-             * pointer */                                                      \
-            auto strides_host_packed =                                         \
-                std::vector<shape_elem_type, usm_host_allocatorT>(             \
-                    strides_size, usm_host_allocatorT(q));                     \
+            /* strides of up to DPNP_KERNEL_ARG_MAX_NDIM dimensions are passed \
+             * to the kernel by value, so no temporary USM memory is needed */ \
+            dpnp_kernel_array<shape_elem_type, 2 * DPNP_KERNEL_ARG_MAX_NDIM>   \
+                strides_by_value{};                                            \
+            shape_elem_type *dev_strides_data = nullptr;                       \
+            shape_elem_type *strides_host_packed = strides_by_value.data;      \
+                                                                               \
+            if (result_ndim > DPNP_KERNEL_ARG_MAX_NDIM) {                      \
+                dev_strides_data = dpnp_pool_malloc<shape_elem_type>(          \
+                    strides_size, q, sycl::usm::alloc::device);                \
+                                                                               \
+                /* memory transfer optimization, use USM-host for temporary    \
+                 * speeds up tranfer to device. Both temporaries are released  \
+                 * when the kernel is done */                                  \
+                strides_host_packed = dpnp_pool_malloc<shape_elem_type>(       \
+                    strides_size, q, sycl::usm::alloc::host);                  \
+            }                                                                  \
                                                                                \
             /* packed vector is concatenation of result_strides,               \
              * input1_strides and input2_strides */                            \
             std::copy(result_strides, result_strides + result_ndim,            \
-                      strides_host_packed.begin());                            \
+                      strides_host_packed);                                    \
             std::copy(input1_strides, input1_strides + result_ndim,            \
-                      strides_host_packed.begin() + result_ndim);              \
+                      strides_host_packed + result_ndim);                      \
                                                                                \
-            auto copy_strides_ev = q.copy<shape_elem_type>(                    \
-                strides_host_packed.data(), dev_strides_data,                  \
-                strides_host_packed.size());                                   \
+            std::vector<sycl::event> copy_strides_ev;                          \
+            if (dev_strides_data != nullptr) {                                 \
+                copy_strides_ev.push_back(q.copy<shape_elem_type>(             \
+                    strides_host_packed, dev_strides_data, strides_size));     \
+            }                                                                  \
                                                                                \
             auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {       \
                 size_t output_id = global_id[0]; /* for (size_t i = 0; i <     \
                                                     result_size; ++i) */       \
+                if ((where != nullptr) && !where[output_id]) {                 \
+                    return;                                                    \
+                }                                                              \
                 {                                                              \
+                    const shape_elem_type *strides_data =                      \
+                        dev_strides_data ? dev_strides_data                    \
+                                         : strides_by_value.data;              \
                     const shape_elem_type *result_strides_data =               \
-                        &dev_strides_data[0];                                  \
+                        &strides_data[0];                                      \
                     const shape_elem_type *input1_strides_data =               \
-                        &dev_strides_data[result_ndim];                        \
+                        &strides_data[result_ndim];                            \
                                                                                \
                     size_t input_id = 0;                                       \
                     for (size_t i = 0; i < input1_ndim; ++i) {                 \
@@ -140,44 +318,81 @@
                 }                                                              \
             };                                                                 \
             auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
+                cgh.depends_on(copy_strides_ev);                               \
                 cgh.parallel_for<class __name__##_strides_kernel<              \
                     _DataType_input, _DataType_output>>(                       \
                     gws, kernel_parallel_for_func);                            \
             };                                                                 \
                                                                                \
-            q.submit(kernel_func).wait();                                      \
-                                                                               \
-            sycl::free(dev_strides_data, q);                                   \
-            return event_ref;                                                  \
+            event = q.submit(kernel_func);                                     \
+            if (dev_strides_data != nullptr) {                                 \
+                dpnp_pool_free_async(                                          \
+                    q, {dev_strides_data, strides_host_packed}, {event});      \
+            }                                                                  \
         }                                                                      \
         else {                                                                 \
-            auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {       \
-                size_t output_id = global_id[0]; /* for (size_t i = 0; i <     \
-                                                    result_size; ++i) */       \
-                {                                                              \
-                    const _DataType_output input_elem =                        \
-                        input1_data[output_id];                                \
-                    result[output_id] = __operation1__;                        \
+            if (dpnp_host_path(q, #__name__, result_size, dep_events)) {       \
+                for (size_t i = 0; i < result_size; ++i) {                     \
+                    if ((where != nullptr) && !where[i]) {                     \
+                        continue;                                              \
+                    }                                                          \
+                    const _DataType_output input_elem = input1_data[i];        \
+                    result[i] = __operation1__;                                \
                 }                                                              \
-            };                                                                 \
-            auto kernel_func = [&](sycl::handler &cgh) {                       \
-                cgh.parallel_for<class __name__##_kernel<_DataType_input,      \
-                                                         _DataType_output>>(   \
-                    gws, kernel_parallel_for_func);                            \
-            };                                                                 \
+                                                                               \
+                event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);       \
+                return DPCTLEvent_Copy(event_ref);                             \
+            }                                                                  \
                                                                                \
             if constexpr (both_types_are_same<_DataType_input,                 \
                                               _DataType_output, float,         \
                                               double>)                         \
             {                                                                  \
-                if (q.get_device().has(sycl::aspect::fp64)) {                  \
+                /* MKL VM computes all elements, masked call uses kernel */    \
+                if ((where == nullptr) &&                                      \
+                    q.get_device().has(sycl::aspect::fp64))                    \
+                {                                                              \
                     event = __operation2__;                                    \
                                                                                \
                     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);   \
                     return DPCTLEvent_Copy(event_ref);                         \
                 }                                                              \
             }                                                                  \
-            event = q.submit(kernel_func);                                     \
+                                                                               \
+            if constexpr (none_of_both_types<                                  \
+                              _DataType_input, _DataType_output,               \
+                              std::complex<float>, std::complex<double>>)      \
+            {                                                                  \
+                auto op = [=](const _DataType_output input_elem) {             \
+                    return static_cast<_DataType_output>(__operation1__);      \
+                };                                                             \
+                event = dpnp_unary_sg_submit<class __name__##_sg_kernel<       \
+                    _DataType_input, _DataType_output>>(                       \
+                    q, #__name__, input1_data, result, result_size, where, op, \
+                    dep_events);                                               \
+            }                                                                  \
+            else {                                                             \
+                auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {   \
+                    size_t output_id = global_id[0]; /* for (size_t i = 0; i < \
+                                                        result_size; ++i) */   \
+                    if ((where != nullptr) && !where[output_id]) {             \
+                        return;                                                \
+                    }                                                          \
+                    {                                                          \
+                        const _DataType_output input_elem =                    \
+                            input1_data[output_id];                            \
+                        result[output_id] = __operation1__;                    \
+                    }                                                          \
+                };                                                             \
+                auto kernel_func = [&](sycl::handler &cgh) {                   \
+                    cgh.depends_on(dep_events);                                \
+                    cgh.parallel_for<class __name__##_kernel<                  \
+                        _DataType_input, _DataType_output>>(                   \
+                        gws, kernel_parallel_for_func);                        \
+                };                                                             \
+                event = q.submit(kernel_func);                                 \
+            }                                                                  \
         }                                                                      \
                                                                                \
         event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);               \
@@ -729,7 +944,6 @@ static void func_map_init_elemwise_1arg_2type(func_map_t &fmap)
     fmap[DPNPFuncName::DPNP_FN_SQRT][eft_DBL][eft_DBL] = {
         eft_DBL, (void *)dpnp_sqrt_c_default<double, double>};
 
-    // Used in dpnp_std_c
     fmap[DPNPFuncName::DPNP_FN_SQRT_EXT][eft_FLT][eft_FLT] = {
         eft_FLT, (void *)dpnp_sqrt_c_ext<float, float>};
     fmap[DPNPFuncName::DPNP_FN_SQRT_EXT][eft_DBL][eft_DBL] = {
@@ -792,33 +1006,6 @@ static void func_map_init_elemwise_1arg_2type(func_map_t &fmap)
     return;
 }
 
-template <typename T>
-constexpr T dispatch_erf_op(T elem)
-{
-    if constexpr (is_any_v<T, std::int32_t, std::int64_t>) {
-        // TODO: need to convert to double when possible
-        return sycl::erf((float)elem);
-    }
-    else {
-        return sycl::erf(elem);
-    }
-}
-
-template <typename T>
-constexpr T dispatch_sign_op(T elem)
-{
-    if constexpr (is_any_v<T, std::int32_t, std::int64_t>) {
-        if (elem > 0)
-            return T(1);
-        if (elem < 0)
-            return T(-1);
-        return elem; // elem is 0
-    }
-    else {
-        return sycl::sign(elem);
-    }
-}
-
 #define MACRO_1ARG_1TYPE_OP(__name__, __operation1__, __operation2__)          \
     template <typename _KernelNameSpecialization>                              \
     class __name__##_kernel;                                                   \
@@ -826,6 +1013,9 @@ constexpr T dispatch_sign_op(T elem)
     template <typename _KernelNameSpecialization>                              \
     class __name__##_strides_kernel;                                           \
                                                                                \
+    template <typename _KernelNameSpecialization>                              \
+    class __name__##_sg_kernel;                                                \
+                                                                               \
     template <typename _DataType>                                              \
     DPCTLSyclEventRef __name__(                                                \
         DPCTLSyclQueueRef q_ref, void *result_out, const size_t result_size,   \
@@ -838,8 +1028,6 @@ constexpr T dispatch_sign_op(T elem)
     {                                                                          \
         /* avoid warning unused variable*/                                     \
         (void)result_shape;                                                    \
-        (void)where;                                                           \
-        (void)dep_event_vec_ref;                                               \
                                                                                \
         DPCTLSyclEventRef event_ref = nullptr;                                 \
                                                                                \
@@ -848,6 +1036,8 @@ constexpr T dispatch_sign_op(T elem)
         }                                                                      \
                                                                                \
         sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));             \
+        std::vector<sycl::event> dep_events =                                  \
+            cast_event_vector(dep_event_vec_ref);                              \
                                                                                \
         _DataType *input1_data =                                               \
             static_cast<_DataType *>(const_cast<void *>(input1_in));           \
@@ -873,40 +1063,53 @@ constexpr T dispatch_sign_op(T elem)
                     std::to_string(input1_ndim));                              \
             }                                                                  \
                                                                                \
-            /* memory transfer optimization, use USM-host for temporary speeds \
-             * up tranfer to device */                                         \
-            using usm_host_allocatorT =                                        \
-                sycl::usm_allocator<shape_elem_type, sycl::usm::alloc::host>;  \
-                                                                               \
             size_t strides_size = 2 * result_ndim;                             \
-            shape_elem_type *dev_strides_data =                                \
-                sycl::malloc_device<shape_elem_type>(strides_size, q);         \
                                                                                \
-            /* create host temporary for packed strides managed by shared      \
-             * pointer */                                                      \
-            auto strides_host_packed =                                         \
-                std::vector<shape_elem_type, usm_host_allocatorT>(             \
-                    strides_size, usm_host_allocatorT(q));                     \
+            /* strides of up to DPNP_KERNEL_ARG_MAX_NDIM dimensions are passed \
+             * to the kernel by value, so no temporary USM memory is needed */ \
+            dpnp_kernel_array<shape_elem_type, 2 * DPNP_KERNEL_ARG_MAX_NDIM>   \
+                strides_by_value{};                                            \
+            shape_elem_type *dev_strides_data = nullptr;                       \
+            shape_elem_type *strides_host_packed = strides_by_value.data;      \
+                                                                               \
+            if (result_ndim > DPNP_KERNEL_ARG_MAX_NDIM) {                      \
+                dev_strides_data = dpnp_pool_malloc<shape_elem_type>(          \
+                    strides_size, q, sycl::usm::alloc::device);                \
+                                                                               \
+                /* memory transfer optimization, use USM-host for temporary    \
+                 * speeds up tranfer to device. Both temporaries are released  \
+                 * when the kernel is done */                                  \
+                strides_host_packed = dpnp_pool_malloc<shape_elem_type>(       \
+                    strides_size, q, sycl::usm::alloc::host);                  \
+            }                                                                  \
                                                                                \
             /* packed vector is concatenation of result_strides,               \
              * input1_strides and input2_strides */                            \
             std::copy(result_strides, result_strides + result_ndim,            \
-                      strides_host_packed.begin());                            \
+                      strides_host_packed);                                    \
             std::copy(input1_strides, input1_strides + result_ndim,            \
-                      strides_host_packed.begin() + result_ndim);              \
+                      strides_host_packed + result_ndim);                      \
                                                                                \
-            auto copy_strides_ev = q.copy<shape_elem_type>(                    \
-                strides_host_packed.data(), dev_strides_data,                  \
-                strides_host_packed.size());                                   \
+            std::vector<sycl::event> copy_strides_ev;                          \
+            if (dev_strides_data != nullptr) {                                 \
+                copy_strides_ev.push_back(q.copy<shape_elem_type>(             \
+                    strides_host_packed, dev_strides_data, strides_size));     \
+            }                                                                  \
                                                                                \
             auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {       \
                 size_t output_id = global_id[0]; /* for (size_t i = 0; i <     \
                                                     result_size; ++i) */       \
+                if ((where != nullptr) && !where[output_id]) {                 \
+                    return;                                                    \
+                }                                                              \
                 {                                                              \
+                    const shape_elem_type *strides_data =                      \
+                        dev_strides_data ? dev_strides_data                    \
+                                         : strides_by_value.data;              \
                     const shape_elem_type *result_strides_data =               \
-                        &dev_strides_data[0];                                  \
+                        &strides_data[0];                                      \
                     const shape_elem_type *input1_strides_data =               \
-                        &dev_strides_data[result_ndim];                        \
+                        &strides_data[result_ndim];                            \
                                                                                \
                     size_t input_id = 0;                                       \
                     for (size_t i = 0; i < input1_ndim; ++i) {                 \
@@ -922,38 +1125,74 @@ constexpr T dispatch_sign_op(T elem)
                 }                                                              \
             };                                                                 \
             auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
+                cgh.depends_on(copy_strides_ev);                               \
                 cgh.parallel_for<class __name__##_strides_kernel<_DataType>>(  \
                     gws, kernel_parallel_for_func);                            \
             };                                                                 \
                                                                                \
-            q.submit(kernel_func).wait();                                      \
-                                                                               \
-            sycl::free(dev_strides_data, q);                                   \
-            return event_ref;                                                  \
+            event = q.submit(kernel_func);                                     \
+            if (dev_strides_data != nullptr) {                                 \
+                dpnp_pool_free_async(                                          \
+                    q, {dev_strides_data, strides_host_packed}, {event});      \
+            }                                                                  \
         }                                                                      \
         else {                                                                 \
-            auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {       \
-                size_t i = global_id[0]; /* for (size_t i = 0; i <             \
-                                            result_size; ++i) */               \
-                {                                                              \
+            if (dpnp_host_path(q, #__name__, result_size, dep_events)) {       \
+                for (size_t i = 0; i < result_size; ++i) {                     \
+                    if ((where != nullptr) && !where[i]) {                     \
+                        continue;                                              \
+                    }                                                          \
                     const _DataType input_elem = input1_data[i];               \
                     result[i] = __operation1__;                                \
                 }                                                              \
-            };                                                                 \
-            auto kernel_func = [&](sycl::handler &cgh) {                       \
-                cgh.parallel_for<class __name__##_kernel<_DataType>>(          \
-                    gws, kernel_parallel_for_func);                            \
-            };                                                                 \
+                                                                               \
+                event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);       \
+                return DPCTLEvent_Copy(event_ref);                             \
+            }                                                                  \
                                                                                \
             if constexpr (is_any_v<_DataType, float, double>) {                \
-                if (q.get_device().has(sycl::aspect::fp64)) {                  \
+                /* MKL VM computes all elements, masked call uses kernel */    \
+                if ((where == nullptr) &&                                      \
+                    q.get_device().has(sycl::aspect::fp64))                    \
+                {                                                              \
                     event = __operation2__;                                    \
                                                                                \
                     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);   \
                     return DPCTLEvent_Copy(event_ref);                         \
                 }                                                              \
             }                                                                  \
-            event = q.submit(kernel_func);                                     \
+                                                                               \
+            if constexpr (!is_any_v<_DataType, std::complex<float>,            \
+                                    std::complex<double>>)                     \
+            {                                                                  \
+                auto op = [=](const _DataType input_elem) {                    \
+                    return static_cast<_DataType>(__operation1__);             \
+                };                                                             \
+                event = dpnp_unary_sg_submit<                                  \
+                    class __name__##_sg_kernel<_DataType>>(                    \
+                    q, #__name__, input1_data, result, result_size, where, op, \
+                    dep_events);                                               \
+            }                                                                  \
+            else {                                                             \
+                auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {   \
+                    size_t i = global_id[0]; /* for (size_t i = 0; i <         \
+                                                result_size; ++i) */           \
+                    if ((where != nullptr) && !where[i]) {                     \
+                        return;                                                \
+                    }                                                          \
+                    {                                                          \
+                        const _DataType input_elem = input1_data[i];           \
+                        result[i] = __operation1__;                            \
+                    }                                                          \
+                };                                                             \
+                auto kernel_func = [&](sycl::handler &cgh) {                   \
+                    cgh.depends_on(dep_events);                                \
+                    cgh.parallel_for<class __name__##_kernel<_DataType>>(      \
+                        gws, kernel_parallel_for_func);                        \
+                };                                                             \
+                event = q.submit(kernel_func);                                 \
+            }                                                                  \
         }                                                                      \
                                                                                \
         event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);               \
@@ -1168,7 +1407,8 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
                                                                                \
     template <typename _KernelNameSpecialization1,                             \
               typename _KernelNameSpecialization2,                             \
-              typename _KernelNameSpecialization3>                             \
+              typename _KernelNameSpecialization3,                             \
+              typename _KernelNameSpecialization4>                             \
     class __name__##_sg_kernel;                                                \
                                                                                \
     template <typename _KernelNameSpecialization1,                             \
@@ -1181,6 +1421,16 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
               typename _KernelNameSpecialization3>                             \
     class __name__##_strides_kernel;                                           \
                                                                                \
+    template <typename _KernelNameSpecialization1,                             \
+              typename _KernelNameSpecialization2,                             \
+              typename _KernelNameSpecialization3>                             \
+    class __name__##_strides_2d_kernel;                                        \
+                                                                               \
+    template <typename _KernelNameSpecialization1,                             \
+              typename _KernelNameSpecialization2,                             \
+              typename _KernelNameSpecialization3>                             \
+    class __name__##_strides_nd_kernel;                                        \
+                                                                               \
     template <typename _DataType_output, typename _DataType_input1,            \
               typename _DataType_input2>                                       \
     DPCTLSyclEventRef __name__(                                                \
@@ -1195,10 +1445,6 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
         const shape_elem_type *input2_strides, const size_t *where,            \
         const DPCTLEventVectorRef dep_event_vec_ref)                           \
     {                                                                          \
-        /* avoid warning unused variable*/                                     \
-        (void)where;                                                           \
-        (void)dep_event_vec_ref;                                               \
-                                                                               \
         DPCTLSyclEventRef event_ref = nullptr;                                 \
                                                                                \
         if (!input1_size || !input2_size) {                                    \
@@ -1206,6 +1452,8 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
         }                                                                      \
                                                                                \
         sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));             \
+        std::vector<sycl::event> dep_events =                                  \
+            cast_event_vector(dep_event_vec_ref);                              \
                                                                                \
         _DataType_input1 *input1_data =                                        \
             static_cast<_DataType_input1 *>(const_cast<void *>(input1_in));    \
@@ -1236,10 +1484,44 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
                                         input2_shape_offsets, input2_ndim);    \
         delete[] input2_shape_offsets;                                         \
                                                                                \
+        /* strided operands often collapse into a few dimensions or even into  \
+         * contiguous ones. Operands of the space are result, input1, input2   \
+         * and the mask, which is indexed in C order of the result. Broadcast  \
+         * inputs are views with zero strides along broadcast dimensions */    \
+        dpnp_strided_space<4> space;                                           \
+        bool use_space = false;                                                \
+        if (use_broadcasting ||                                                \
+            (use_strides && (result_ndim == input1_ndim) &&                    \
+             (result_ndim == input2_ndim)))                                    \
+        {                                                                      \
+            std::vector<shape_elem_type> where_strides(result_ndim, 0);        \
+            if (where != nullptr) {                                            \
+                get_shape_offsets_inkernel(result_shape, result_ndim,          \
+                                           where_strides.data());              \
+            }                                                                  \
+            const std::vector<shape_elem_type> input1_view_strides =           \
+                get_broadcast_strides(input1_shape, input1_strides,            \
+                                      input1_ndim, result_shape, result_ndim); \
+            const std::vector<shape_elem_type> input2_view_strides =           \
+                get_broadcast_strides(input2_shape, input2_strides,            \
+                                      input2_ndim, result_shape, result_ndim); \
+            const shape_elem_type *const space_strides[4] = {                  \
+                result_strides, input1_view_strides.data(),                    \
+                input2_view_strides.data(), where_strides.data()};             \
+                                                                               \
+            use_space = dpnp_normalize_strides(result_ndim, result_shape,      \
+                                               space_strides, space);          \
+            if (use_space && space.is_contiguous(3)) {                         \
+                use_space = false;                                             \
+                use_strides = false;                                           \
+                use_broadcasting = false;                                      \
+            }                                                                  \
+        }                                                                      \
+                                                                               \
         sycl::event event;                                                     \
         sycl::range<1> gws(result_size);                                       \
                                                                                \
-        if (use_broadcasting) {                                                \
+        if (use_broadcasting && !use_space) {                                  \
             DPNPC_id<_DataType_input1> *input1_it;                             \
             const size_t input1_it_size_in_bytes =                             \
                 sizeof(DPNPC_id<_DataType_input1>);                            \
@@ -1265,6 +1547,9 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
             auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {       \
                 const size_t i = global_id[0]; /* for (size_t i = 0; i <       \
                                                   result_size; ++i) */         \
+                if ((where != nullptr) && !where[i]) {                         \
+                    return;                                                    \
+                }                                                              \
                 {                                                              \
                     const _DataType_output input1_elem = (*input1_it)[i];      \
                     const _DataType_output input2_elem = (*input2_it)[i];      \
@@ -1272,17 +1557,66 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
                 }                                                              \
             };                                                                 \
             auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
                 cgh.parallel_for<class __name__##_broadcast_kernel<            \
                     _DataType_output, _DataType_input1, _DataType_input2>>(    \
                     gws, kernel_parallel_for_func);                            \
             };                                                                 \
                                                                                \
-            q.submit(kernel_func).wait();                                      \
+            event = q.submit(kernel_func);                                     \
+            event.wait();                                                      \
                                                                                \
             input1_it->~DPNPC_id();                                            \
             input2_it->~DPNPC_id();                                            \
+        }                                                                      \
+        else if (use_space && space.as_2d()) {                                 \
+            sycl::range<2> gws_2d(space.shape[0], space.shape[1]);             \
+            auto kernel_parallel_for_func = [=](sycl::id<2> global_id) {       \
+                shape_elem_type offsets[4];                                    \
+                space.get_offsets(global_id[0], global_id[1], offsets);        \
+                if ((where != nullptr) && !where[offsets[3]]) {                \
+                    return;                                                    \
+                }                                                              \
+                {                                                              \
+                    const _DataType_output input1_elem =                       \
+                        input1_data[offsets[1]];                               \
+                    const _DataType_output input2_elem =                       \
+                        input2_data[offsets[2]];                               \
+                    result[offsets[0]] = __operation__;                        \
+                }                                                              \
+            };                                                                 \
+            auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
+                cgh.parallel_for<class __name__##_strides_2d_kernel<           \
+                    _DataType_output, _DataType_input1, _DataType_input2>>(    \
+                    gws_2d, kernel_parallel_for_func);                         \
+            };                                                                 \
                                                                                \
-            return event_ref;                                                  \
+            event = q.submit(kernel_func);                                     \
+        }                                                                      \
+        else if (use_space) {                                                  \
+            auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {       \
+                shape_elem_type offsets[4];                                    \
+                space.get_offsets(global_id[0], offsets);                      \
+                if ((where != nullptr) && !where[offsets[3]]) {                \
+                    return;                                                    \
+                }                                                              \
+                {                                                              \
+                    const _DataType_output input1_elem =                       \
+                        input1_data[offsets[1]];                               \
+                    const _DataType_output input2_elem =                       \
+                        input2_data[offsets[2]];                               \
+                    result[offsets[0]] = __operation__;                        \
+                }                                                              \
+            };                                                                 \
+            auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
+                cgh.parallel_for<class __name__##_strides_nd_kernel<           \
+                    _DataType_output, _DataType_input1, _DataType_input2>>(    \
+                    gws, kernel_parallel_for_func);                            \
+            };                                                                 \
+                                                                               \
+            event = q.submit(kernel_func);                                     \
         }                                                                      \
         else if (use_strides) {                                                \
             if ((result_ndim != input1_ndim) || (result_ndim != input2_ndim))  \
@@ -1294,45 +1628,58 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
                     " or input2 ndim=" + std::to_string(input2_ndim));         \
             }                                                                  \
                                                                                \
-            /* memory transfer optimization, use USM-host for temporary speeds \
-             * up tranfer to device */                                         \
-            using usm_host_allocatorT =                                        \
-                sycl::usm_allocator<shape_elem_type, sycl::usm::alloc::host>;  \
-                                                                               \
             size_t strides_size = 3 * result_ndim;                             \
-            shape_elem_type *dev_strides_data =                                \
-                sycl::malloc_device<shape_elem_type>(strides_size, q);         \
                                                                                \
-            /* create host temporary for packed strides managed by shared      \
-             * pointer */                                                      \
-            auto strides_host_packed =                                         \
-                std::vector<shape_elem_type, usm_host_allocatorT>(             \
-                    strides_size, usm_host_allocatorT(q));                     \
+            /* strides of up to DPNP_KERNEL_ARG_MAX_NDIM dimensions are passed \
+             * to the kernel by value, so no temporary USM memory is needed */ \
+            dpnp_kernel_array<shape_elem_type, 3 * DPNP_KERNEL_ARG_MAX_NDIM>   \
+                strides_by_value{};                                            \
+            shape_elem_type *dev_strides_data = nullptr;                       \
+            shape_elem_type *strides_host_packed = strides_by_value.data;      \
+                                                                               \
+            if (result_ndim > DPNP_KERNEL_ARG_MAX_NDIM) {                      \
+                dev_strides_data = dpnp_pool_malloc<shape_elem_type>(          \
+                    strides_size, q, sycl::usm::alloc::device);                \
+                                                                               \
+                /* memory transfer optimization, use USM-host for temporary    \
+                 * speeds up tranfer to device. Both temporaries are released  \
+                 * when the kernel is done */                                  \
+                strides_host_packed = dpnp_pool_malloc<shape_elem_type>(       \
+                    strides_size, q, sycl::usm::alloc::host);                  \
+            }                                                                  \
                                                                                \
             /* packed vector is concatenation of result_strides,               \
              * input1_strides and input2_strides */                            \
             std::copy(result_strides, result_strides + result_ndim,            \
-                      strides_host_packed.begin());                            \
+                      strides_host_packed);                                    \
             std::copy(input1_strides, input1_strides + result_ndim,            \
-                      strides_host_packed.begin() + result_ndim);              \
+                      strides_host_packed + result_ndim);                      \
             std::copy(input2_strides, input2_strides + result_ndim,            \
-                      strides_host_packed.begin() + 2 * result_ndim);          \
+                      strides_host_packed + 2 * result_ndim);                  \
                                                                                \
-            auto copy_strides_ev = q.copy<shape_elem_type>(                    \
-                strides_host_packed.data(), dev_strides_data,                  \
-                strides_host_packed.size());                                   \
+            std::vector<sycl::event> copy_strides_ev;                          \
+            if (dev_strides_data != nullptr) {                                 \
+                copy_strides_ev.push_back(q.copy<shape_elem_type>(             \
+                    strides_host_packed, dev_strides_data, strides_size));     \
+            }                                                                  \
                                                                                \
             auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {       \
                 const size_t output_id =                                       \
                     global_id[0]; /* for (size_t i = 0; i < result_size; ++i)  \
                                    */                                          \
+                if ((where != nullptr) && !where[output_id]) {                 \
+                    return;                                                    \
+                }                                                              \
                 {                                                              \
+                    const shape_elem_type *strides_data =                      \
+                        dev_strides_data ? dev_strides_data                    \
+                                         : strides_by_value.data;              \
                     const shape_elem_type *result_strides_data =               \
-                        &dev_strides_data[0];                                  \
+                        &strides_data[0];                                      \
                     const shape_elem_type *input1_strides_data =               \
-                        &dev_strides_data[result_ndim];                        \
+                        &strides_data[result_ndim];                            \
                     const shape_elem_type *input2_strides_data =               \
-                        &dev_strides_data[2 * result_ndim];                    \
+                        &strides_data[2 * result_ndim];                        \
                                                                                \
                     size_t input1_id = 0;                                      \
                     size_t input2_id = 0;                                      \
@@ -1354,25 +1701,45 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
                 }                                                              \
             };                                                                 \
             auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
                 cgh.depends_on(copy_strides_ev);                               \
                 cgh.parallel_for<class __name__##_strides_kernel<              \
                     _DataType_output, _DataType_input1, _DataType_input2>>(    \
                     gws, kernel_parallel_for_func);                            \
             };                                                                 \
                                                                                \
-            q.submit(kernel_func).wait();                                      \
-                                                                               \
-            sycl::free(dev_strides_data, q);                                   \
-            return event_ref;                                                  \
+            event = q.submit(kernel_func);                                     \
+            if (dev_strides_data != nullptr) {                                 \
+                dpnp_pool_free_async(                                          \
+                    q, {dev_strides_data, strides_host_packed}, {event});      \
+            }                                                                  \
         }                                                                      \
         else {                                                                 \
+            if (dpnp_host_path(q, #__name__, result_size, dep_events)) {       \
+                for (size_t i = 0; i < result_size; ++i) {                     \
+                    if ((where != nullptr) && !where[i]) {                     \
+                        continue;                                              \
+                    }                                                          \
+                    const _DataType_output input1_elem = input1_data[i];       \
+                    const _DataType_output input2_elem = input2_data[i];       \
+                    result[i] = __operation__;                                 \
+                }                                                              \
+                                                                               \
+                event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);       \
+                return DPCTLEvent_Copy(event_ref);                             \
+            }                                                                  \
+                                                                               \
             if constexpr (both_types_are_same<_DataType_input1,                \
                                               _DataType_input2,                \
                                               __mkl_types__>)                  \
             {                                                                  \
-                if (q.get_device().has(sycl::aspect::fp64)) {                  \
+                /* MKL VM computes all elements, masked call uses kernel */    \
+                if ((where == nullptr) &&                                      \
+                    q.get_device().has(sycl::aspect::fp64))                    \
+                {                                                              \
                     event = __mkl_operation__(q, result_size, input1_data,     \
-                                              input2_data, result);            \
+                                              input2_data, result,             \
+                                              dep_events);                     \
                                                                                \
                     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);   \
                     return DPCTLEvent_Copy(event_ref);                         \
@@ -1383,44 +1750,83 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
                               _DataType_input1, _DataType_input2,              \
                               std::complex<float>, std::complex<double>>)      \
             {                                                                  \
-                constexpr size_t lws = 64;                                     \
-                constexpr unsigned int vec_sz = 8;                             \
-                constexpr sycl::access::address_space global_space =           \
-                    sycl::access::address_space::global_space;                 \
-                                                                               \
-                auto gws_range = sycl::range<1>(                               \
-                    ((result_size + lws * vec_sz - 1) / (lws * vec_sz)) *      \
-                    lws);                                                      \
-                auto lws_range = sycl::range<1>(lws);                          \
-                                                                               \
-                auto kernel_parallel_for_func = [=](sycl::nd_item<1> nd_it) {  \
-                    auto sg = nd_it.get_sub_group();                           \
-                    const auto max_sg_size = sg.get_max_local_range()[0];      \
-                    const size_t start =                                       \
-                        vec_sz *                                               \
-                        (nd_it.get_group(0) * nd_it.get_local_range(0) +       \
-                         sg.get_group_id()[0] * max_sg_size);                  \
-                                                                               \
-                    if (start + static_cast<size_t>(vec_sz) * max_sg_size <    \
-                        result_size) {                                         \
-                        using input1_ptrT =                                    \
-                            sycl::multi_ptr<_DataType_input1, global_space>;   \
-                        using input2_ptrT =                                    \
-                            sycl::multi_ptr<_DataType_input2, global_space>;   \
-                        using result_ptrT =                                    \
-                            sycl::multi_ptr<_DataType_output, global_space>;   \
-                                                                               \
-                        sycl::vec<_DataType_output, vec_sz> res_vec;           \
-                                                                               \
-                        if constexpr (both_types_are_any_of<_DataType_input1,  \
-                                                            _DataType_input2,  \
-                                                            __vec_types__>)    \
-                        {                                                      \
-                            if constexpr (both_types_are_same<                 \
+                /* vector size is a compile-time constant, the tuned one is    \
+                 * dispatched among the supported candidates */                \
+                auto sg_submit = [&](auto vec_sz_type, const size_t lws,       \
+                                     _DataType_output *sg_result,              \
+                                     const size_t *sg_where) {                 \
+                    constexpr unsigned int vec_sz =                            \
+                        decltype(vec_sz_type)::value;                          \
+                    constexpr sycl::access::address_space global_space =       \
+                        sycl::access::address_space::global_space;             \
+                                                                               \
+                    auto gws_range = sycl::range<1>(                           \
+                        ((result_size + lws * vec_sz - 1) / (lws * vec_sz)) *  \
+                        lws);                                                  \
+                    auto lws_range = sycl::range<1>(lws);                      \
+                                                                               \
+                    auto kernel_parallel_for_func = [=](sycl::nd_item<1>       \
+                                                            nd_it) {           \
+                        auto sg = nd_it.get_sub_group();                       \
+                        const auto max_sg_size = sg.get_max_local_range()[0];  \
+                        const size_t start =                                   \
+                            vec_sz *                                           \
+                            (nd_it.get_group(0) * nd_it.get_local_range(0) +   \
+                             sg.get_group_id()[0] * max_sg_size);              \
+                                                                               \
+                        if (start + static_cast<size_t>(vec_sz) * max_sg_size <\
+                            result_size) {                                     \
+                            using input1_ptrT =                                \
+                                sycl::multi_ptr<_DataType_input1,              \
+                                                global_space>;                 \
+                            using input2_ptrT =                                \
+                                sycl::multi_ptr<_DataType_input2,              \
+                                                global_space>;                 \
+                            using result_ptrT =                                \
+                                sycl::multi_ptr<_DataType_output,              \
+                                                global_space>;                 \
+                                                                               \
+                            sycl::vec<_DataType_output, vec_sz> res_vec;       \
+                                                                               \
+                            if constexpr (both_types_are_any_of<               \
                                               _DataType_input1,                \
                                               _DataType_input2,                \
-                                              _DataType_output>)               \
+                                              __vec_types__>)                  \
                             {                                                  \
+                                if constexpr (both_types_are_same<             \
+                                                  _DataType_input1,            \
+                                                  _DataType_input2,            \
+                                                  _DataType_output>)           \
+                                {                                              \
+                                    sycl::vec<_DataType_input1, vec_sz> x1 =   \
+                                        sg.load<vec_sz>(                       \
+                                            input1_ptrT(&input1_data[start])); \
+                                    sycl::vec<_DataType_input2, vec_sz> x2 =   \
+                                        sg.load<vec_sz>(                       \
+                                            input2_ptrT(&input2_data[start])); \
+                                                                               \
+                                    res_vec = __vec_operation__;               \
+                                }                                              \
+                                else /* input types don't match result type, so\
+                                        explicit casting is required */        \
+                                {                                              \
+                                    sycl::vec<_DataType_output, vec_sz> x1 =   \
+                                        dpnp_vec_cast<_DataType_output,        \
+                                                      _DataType_input1,        \
+                                                      vec_sz>(                 \
+                                            sg.load<vec_sz>(input1_ptrT(       \
+                                                &input1_data[start])));        \
+                                    sycl::vec<_DataType_output, vec_sz> x2 =   \
+                                        dpnp_vec_cast<_DataType_output,        \
+                                                      _DataType_input2,        \
+                                                      vec_sz>(                 \
+                                            sg.load<vec_sz>(input2_ptrT(       \
+                                                &input2_data[start])));        \
+                                                                               \
+                                    res_vec = __vec_operation__;               \
+                                }                                              \
+                            }                                                  \
+                            else {                                             \
                                 sycl::vec<_DataType_input1, vec_sz> x1 =       \
                                     sg.load<vec_sz>(                           \
                                         input1_ptrT(&input1_data[start]));     \
@@ -1428,73 +1834,89 @@ static void func_map_init_elemwise_1arg_1type(func_map_t &fmap)
                                     sg.load<vec_sz>(                           \
                                         input2_ptrT(&input2_data[start]));     \
                                                                                \
-                                res_vec = __vec_operation__;                   \
+                                for (size_t k = 0; k < vec_sz; ++k) {          \
+                                    const _DataType_output input1_elem = x1[k];\
+                                    const _DataType_output input2_elem = x2[k];\
+                                    res_vec[k] = __operation__;                \
+                                }                                              \
                             }                                                  \
-                            else /* input types don't match result type, so    \
-                                    explicit casting is required */            \
-                            {                                                  \
-                                sycl::vec<_DataType_output, vec_sz> x1 =       \
-                                    dpnp_vec_cast<_DataType_output,            \
-                                                  _DataType_input1, vec_sz>(   \
-                                        sg.load<vec_sz>(input1_ptrT(           \
-                                            &input1_data[start])));            \
-                                sycl::vec<_DataType_output, vec_sz> x2 =       \
-                                    dpnp_vec_cast<_DataType_output,            \
-                                                  _DataType_input2, vec_sz>(   \
-                                        sg.load<vec_sz>(input2_ptrT(           \
-                                            &input2_data[start])));            \
-                                                                               \
-                                res_vec = __vec_operation__;                   \
+                            if (sg_where != nullptr) {                         \
+                                /* masked lanes keep the previous result,      \
+                                 * select keeps the vector load and store      \
+                                 * unbranched */                               \
+                                using where_ptrT =                             \
+                                    sycl::multi_ptr<size_t, global_space>;     \
+                                const sycl::vec<size_t, vec_sz> mask =         \
+                                    sg.load<vec_sz>(                           \
+                                        where_ptrT(const_cast<size_t *>(       \
+                                            &sg_where[start])));               \
+                                const sycl::vec<_DataType_output, vec_sz>      \
+                                    prev = sg.load<vec_sz>(                    \
+                                        result_ptrT(&sg_result[start]));       \
+                                res_vec = dpnp_vec_select(mask, res_vec, prev);\
                             }                                                  \
+                            sg.store<vec_sz>(result_ptrT(&sg_result[start]),   \
+                                             res_vec);                         \
                         }                                                      \
                         else {                                                 \
-                            sycl::vec<_DataType_input1, vec_sz> x1 =           \
-                                sg.load<vec_sz>(                               \
-                                    input1_ptrT(&input1_data[start]));         \
-                            sycl::vec<_DataType_input2, vec_sz> x2 =           \
-                                sg.load<vec_sz>(                               \
-                                    input2_ptrT(&input2_data[start]));         \
-                                                                               \
-                            for (size_t k = 0; k < vec_sz; ++k) {              \
-                                const _DataType_output input1_elem = x1[k];    \
-                                const _DataType_output input2_elem = x2[k];    \
-                                res_vec[k] = __operation__;                    \
+                            for (size_t k = start + sg.get_local_id()[0];      \
+                                 k < result_size; k += max_sg_size) {          \
+                                if ((sg_where != nullptr) && !sg_where[k]) {   \
+                                    continue;                                  \
+                                }                                              \
+                                const _DataType_output input1_elem =           \
+                                    input1_data[k];                            \
+                                const _DataType_output input2_elem =           \
+                                    input2_data[k];                            \
+                                sg_result[k] = __operation__;                  \
                             }                                                  \
                         }                                                      \
-                        sg.store<vec_sz>(result_ptrT(&result[start]),          \
-                                         res_vec);                             \
-                    }                                                          \
-                    else {                                                     \
-                        for (size_t k = start + sg.get_local_id()[0];          \
-                             k < result_size; k += max_sg_size) {              \
-                            const _DataType_output input1_elem =               \
-                                input1_data[k];                                \
-                            const _DataType_output input2_elem =               \
-                                input2_data[k];                                \
-                            result[k] = __operation__;                         \
-                        }                                                      \
-                    }                                                          \
+                    };                                                         \
+                                                                               \
+                    auto kernel_func = [&](sycl::handler &cgh) {               \
+                        cgh.depends_on(dep_events);                            \
+                        cgh.parallel_for<class __name__##_sg_kernel<           \
+                            _DataType_output, _DataType_input1,                \
+                            _DataType_input2, decltype(vec_sz_type)>>(         \
+                            sycl::nd_range<1>(gws_range, lws_range),           \
+                            kernel_parallel_for_func);                         \
+                    };                                                         \
+                    return q.submit(kernel_func);                              \
                 };                                                             \
                                                                                \
-                auto kernel_func = [&](sycl::handler &cgh) {                   \
-                    cgh.parallel_for<class __name__##_sg_kernel<               \
-                        _DataType_output, _DataType_input1,                    \
-                        _DataType_input2>>(                                    \
-                        sycl::nd_range<1>(gws_range, lws_range),               \
-                        kernel_parallel_for_func);                             \
-                };                                                             \
-                event = q.submit(kernel_func);                                 \
+                /* tuning runs store into a scratch array */                   \
+                const dpnp_launch_params launch =                              \
+                    dpnp_elemwise_launch_params<_DataType_output>(             \
+                        q, #__name__, result_size,                             \
+                        [&](const dpnp_launch_params &candidate,               \
+                            _DataType_output *scratch) {                       \
+                            return dpnp_launch_vec_sz_dispatch(                \
+                                candidate.vec_sz, [&](auto vec_sz_type) {      \
+                                    return sg_submit(vec_sz_type,              \
+                                                     candidate.lws, scratch,   \
+                                                     nullptr);                 \
+                                });                                            \
+                        });                                                    \
+                event = dpnp_launch_vec_sz_dispatch(                           \
+                    launch.vec_sz, [&](auto vec_sz_type) {                     \
+                        return sg_submit(vec_sz_type, launch.lws, result,      \
+                                         where);                               \
+                    });                                                        \
             }                                                                  \
             else /* either input1 or input2 has complex type */ {              \
                 auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {   \
                     const size_t i = global_id[0]; /* for (size_t i = 0; i <   \
                                                       result_size; ++i) */     \
+                    if ((where != nullptr) && !where[i]) {                     \
+                        return;                                                \
+                    }                                                          \
                                                                                \
                     const _DataType_output input1_elem = input1_data[i];       \
                     const _DataType_output input2_elem = input2_data[i];       \
                     result[i] = __operation__;                                 \
                 };                                                             \
                 auto kernel_func = [&](sycl::handler &cgh) {                   \
+                    cgh.depends_on(dep_events);                                \
                     cgh.parallel_for<class __name__##_kernel<                  \
                         _DataType_output, _DataType_input1,                    \
                         _DataType_input2>>(gws, kernel_parallel_for_func);     \
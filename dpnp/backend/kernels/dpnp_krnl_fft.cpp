@@ -420,6 +420,9 @@ DPCTLSyclEventRef dpnp_fft_fft_c(DPCTLSyclQueueRef q_ref,
         return event_ref;
     }
 
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
+
     const size_t result_size =
         std::accumulate(result_shape, result_shape + shape_size, 1,
                         std::multiplies<shape_elem_type>());
@@ -583,6 +586,9 @@ DPCTLSyclEventRef dpnp_fft_rfft_c(DPCTLSyclQueueRef q_ref,
         return event_ref;
     }
 
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
+
     const size_t result_size =
         std::accumulate(result_shape, result_shape + shape_size, 1,
                         std::multiplies<shape_elem_type>());
@@ -25,6 +25,7 @@
 
 #include <iostream>
 #include <list>
+#include <map>
 #include <vector>
 
 #include "dpnp_fptr.hpp"
@@ -45,9 +46,6 @@ DPCTLSyclEventRef dpnp_choose_c(DPCTLSyclQueueRef q_ref,
                                 size_t choice_size,
                                 const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if ((array1_in == nullptr) || (result1 == nullptr) || (choices1 == nullptr))
@@ -59,6 +57,7 @@ DPCTLSyclEventRef dpnp_choose_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     DPNPC_ptr_adapter<_DataType1> input1_ptr(q_ref, array1_in, size);
     _DataType1 *array_in = input1_ptr.get_ptr();
@@ -83,6 +82,7 @@ DPCTLSyclEventRef dpnp_choose_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_choose_c_kernel<_DataType1, _DataType2>>(
             gws, kernel_parallel_for_func);
     };
@@ -108,6 +108,7 @@ void dpnp_choose_c(void *result1,
         q_ref, result1, array1_in, choices1, size, choices_size, choice_size,
         dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType1, typename _DataType2>
@@ -144,6 +145,7 @@ void dpnp_diag_indices_c(void *result1, size_t size)
     DPCTLSyclEventRef event_ref =
         dpnp_diag_indices_c<_DataType>(q_ref, result1, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -168,9 +170,6 @@ DPCTLSyclEventRef dpnp_diagonal_c(DPCTLSyclQueueRef q_ref,
                                   const size_t res_ndim,
                                   const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     const size_t res_size = std::accumulate(res_shape, res_shape + res_ndim, 1,
@@ -180,6 +179,8 @@ DPCTLSyclEventRef dpnp_diagonal_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, input1_size,
                                             true);
@@ -285,6 +286,7 @@ void dpnp_diagonal_c(void *array1_in,
         q_ref, array1_in, input1_size, result1, offset, shape, res_shape,
         res_ndim, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -317,9 +319,6 @@ DPCTLSyclEventRef
                          const size_t ndim,
                          const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     const size_t result_size = std::accumulate(
@@ -329,6 +328,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<_DataType> result_ptr(q_ref, array1_in, result_size, true,
                                             true);
@@ -370,6 +371,7 @@ void dpnp_fill_diagonal_c(void *array1_in,
     DPCTLSyclEventRef event_ref = dpnp_fill_diagonal_c<_DataType>(
         q_ref, array1_in, val_in, shape, ndim, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -398,9 +400,6 @@ DPCTLSyclEventRef dpnp_nonzero_c(DPCTLSyclQueueRef q_ref,
                                  const size_t j,
                                  const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if ((in_array1 == nullptr) || (result1 == nullptr)) {
@@ -412,6 +411,8 @@ DPCTLSyclEventRef dpnp_nonzero_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     const size_t input1_size = std::accumulate(
         shape, shape + ndim, 1, std::multiplies<shape_elem_type>());
@@ -476,9 +477,6 @@ DPCTLSyclEventRef dpnp_place_c(DPCTLSyclQueueRef q_ref,
                                const size_t vals_size,
                                const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!arr_size) {
@@ -490,6 +488,8 @@ DPCTLSyclEventRef dpnp_place_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, vals_in, vals_size, true);
     DPNPC_ptr_adapter<_DataType> result_ptr(q_ref, arr_in, arr_size, true,
@@ -544,9 +544,6 @@ DPCTLSyclEventRef dpnp_put_c(DPCTLSyclQueueRef q_ref,
                              const size_t size_v,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if ((array1_in == nullptr) || (ind_in == nullptr) || (v_in == nullptr)) {
@@ -558,6 +555,8 @@ DPCTLSyclEventRef dpnp_put_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
     DPNPC_ptr_adapter<size_t> input1_ptr(q_ref, ind_in, size_ind, true);
     DPNPC_ptr_adapter<_DataType> input2_ptr(q_ref, v_in, size_v, true);
     DPNPC_ptr_adapter<_DataType> result_ptr(q_ref, array1_in, size, true, true);
@@ -591,6 +590,7 @@ void dpnp_put_c(void *array1_in,
             q_ref, array1_in, ind_in, v_in, size, size_ind, size_v,
             dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType, typename _IndecesType, typename _ValueType>
@@ -626,11 +626,10 @@ DPCTLSyclEventRef
                           size_t values_size,
                           const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     size_t res_ndim = ndim - 1;
     size_t res_shape[res_ndim];
@@ -794,6 +793,7 @@ void dpnp_put_along_axis_c(void *arr_in,
         q_ref, arr_in, indices_in, values_in, axis, shape, ndim, size_indices,
         values_size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -834,10 +834,10 @@ DPCTLSyclEventRef dpnp_take_c(DPCTLSyclQueueRef q_ref,
 {
     // avoid warning unused variable
     (void)array1_size;
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     _DataType *array_1 = reinterpret_cast<_DataType *>(array1_in);
     _IndecesType *indices = reinterpret_cast<_IndecesType *>(indices1);
@@ -850,6 +850,7 @@ DPCTLSyclEventRef dpnp_take_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_take_c_kernel<_DataType, _IndecesType>>(
             gws, kernel_parallel_for_func);
     };
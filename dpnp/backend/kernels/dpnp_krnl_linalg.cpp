@@ -29,12 +29,16 @@
 #include "dpnp_fptr.hpp"
 #include "dpnp_utils.hpp"
 #include "dpnpc_memory_adapter.hpp"
+#include "memory_pool_sycl.hpp"
 #include "queue_sycl.hpp"
 #include <dpnp_iface.hpp>
 
 namespace mkl_blas = oneapi::mkl::blas::row_major;
 namespace mkl_lapack = oneapi::mkl::lapack;
 
+template <typename _DataType>
+class dpnp_cholesky_c_kernel;
+
 template <typename _DataType>
 DPCTLSyclEventRef dpnp_cholesky_c(DPCTLSyclQueueRef q_ref,
                                   void *array1_in,
@@ -43,68 +47,64 @@ DPCTLSyclEventRef dpnp_cholesky_c(DPCTLSyclQueueRef q_ref,
                                   const size_t data_size,
                                   const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
 
-    sycl::event event;
+    if (!size || !data_size) {
+        return event_ref;
+    }
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size, true);
-    DPNPC_ptr_adapter<_DataType> result_ptr(q_ref, result1, size, true, true);
-    _DataType *in_array = input1_ptr.get_ptr();
-    _DataType *result = result_ptr.get_ptr();
+    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    size_t iters = size / (data_size * data_size);
+    _DataType *in_array = static_cast<_DataType *>(array1_in);
+    _DataType *result = static_cast<_DataType *>(result1);
 
-    // math lib func overrides input
-    _DataType *in_a = reinterpret_cast<_DataType *>(
-        sycl::malloc_shared(data_size * data_size * sizeof(_DataType), q));
+    const size_t matrix_size = data_size * data_size;
+    const size_t iters = size / matrix_size;
 
-    for (size_t k = 0; k < iters; ++k) {
-        for (size_t it = 0; it < data_size * data_size; ++it) {
-            in_a[it] = in_array[k * (data_size * data_size) + it];
-        }
+    // math lib func overrides input, so it works on the result
+    sycl::event event = q.copy<_DataType>(in_array, result, size, dep_events);
 
-        const std::int64_t n = data_size;
+    const std::int64_t n = data_size;
 
-        const std::int64_t lda = std::max<size_t>(1UL, n);
-
-        const std::int64_t scratchpad_size =
-            mkl_lapack::potrf_scratchpad_size<_DataType>(
-                q, oneapi::mkl::uplo::upper, n, lda);
+    const std::int64_t lda = std::max<size_t>(1UL, n);
 
-        _DataType *scratchpad = reinterpret_cast<_DataType *>(
-            sycl::malloc_shared(scratchpad_size * sizeof(_DataType), q));
+    const std::int64_t scratchpad_size =
+        mkl_lapack::potrf_scratchpad_size<_DataType>(
+            q, oneapi::mkl::uplo::upper, n, lda);
 
-        event = mkl_lapack::potrf(q, oneapi::mkl::uplo::upper, n, in_a, lda,
-                                  scratchpad, scratchpad_size);
+    _DataType *scratchpad = dpnp_pool_malloc<_DataType>(
+        scratchpad_size, q, sycl::usm::alloc::device);
 
-        event.wait();
+    // the scratchpad is shared, so the matrices are factorized one by one
+    for (size_t k = 0; k < iters; ++k) {
+        event = mkl_lapack::potrf(q, oneapi::mkl::uplo::upper, n,
+                                  result + k * matrix_size, lda, scratchpad,
+                                  scratchpad_size, {event});
+    }
 
-        for (size_t i = 0; i < data_size; i++) {
-            bool arg = false;
-            for (size_t j = 0; j < data_size; j++) {
-                if (i == j - 1) {
-                    arg = true;
-                }
-                if (arg) {
-                    in_a[i * data_size + j] = 0;
-                }
-            }
+    // zero elements above the diagonal
+    auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {
+        const size_t id = global_id[0];
+        const size_t i = (id % matrix_size) / data_size;
+        const size_t j = id % data_size;
+        if (j > i) {
+            result[id] = 0;
         }
+    };
 
-        sycl::free(scratchpad, q);
+    auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(event);
+        cgh.parallel_for<class dpnp_cholesky_c_kernel<_DataType>>(
+            sycl::range<1>(iters * matrix_size), kernel_parallel_for_func);
+    };
 
-        for (size_t t = 0; t < data_size * data_size; ++t) {
-            result[k * (data_size * data_size) + t] = in_a[t];
-        }
-    }
+    event = q.submit(kernel_func);
 
-    sycl::free(in_a, q);
+    dpnp_pool_free_async(q, {scratchpad}, {event});
 
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType>
@@ -134,6 +134,9 @@ DPCTLSyclEventRef (*dpnp_cholesky_ext_c)(DPCTLSyclQueueRef,
                                          const DPCTLEventVectorRef) =
     dpnp_cholesky_c<_DataType>;
 
+template <typename _DataType>
+class dpnp_det_c_kernel;
+
 template <typename _DataType>
 DPCTLSyclEventRef dpnp_det_c(DPCTLSyclQueueRef q_ref,
                              void *array1_in,
@@ -142,9 +145,6 @@ DPCTLSyclEventRef dpnp_det_c(DPCTLSyclQueueRef q_ref,
                              size_t ndim,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     const size_t input_size = std::accumulate(
@@ -154,8 +154,9 @@ DPCTLSyclEventRef dpnp_det_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    size_t n = shape[ndim - 1];
+    const size_t n = shape[ndim - 1];
     size_t size_out = 1;
     if (ndim != 2) {
         for (size_t i = 0; i < ndim - 2; i++) {
@@ -163,56 +164,43 @@ DPCTLSyclEventRef dpnp_det_c(DPCTLSyclQueueRef q_ref,
         }
     }
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, input_size, true);
-    DPNPC_ptr_adapter<_DataType> result_ptr(q_ref, result1, size_out, true,
-                                            true);
-    _DataType *array_1 = input1_ptr.get_ptr();
-    _DataType *result = result_ptr.get_ptr();
-
-    for (size_t i = 0; i < size_out; i++) {
-        _DataType matrix[n][n];
-        if (size_out > 1) {
-            _DataType elems[n * n];
-            for (size_t j = i * n * n; j < (i + 1) * n * n; j++) {
-                elems[j - i * n * n] = array_1[j];
-            }
+    _DataType *array_1 = static_cast<_DataType *>(array1_in);
+    _DataType *result = static_cast<_DataType *>(result1);
 
-            for (size_t j = 0; j < n; j++) {
-                for (size_t k = 0; k < n; k++) {
-                    matrix[j][k] = elems[j * n + k];
-                }
-            }
-        }
-        else {
-            for (size_t j = 0; j < n; j++) {
-                for (size_t k = 0; k < n; k++) {
-                    matrix[j][k] = array_1[j * n + k];
-                }
-            }
-        }
+    // the elimination overrides matrices, it works on a copy of the input
+    _DataType *matrices =
+        dpnp_pool_malloc<_DataType>(input_size, q, sycl::usm::alloc::device);
+    sycl::event copy_event =
+        q.copy<_DataType>(array_1, matrices, input_size, dep_events);
+
+    // a work item computes determinant of one matrix
+    auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {
+        const size_t i = global_id[0];
+        _DataType *matrix = matrices + i * n * n;
 
         _DataType det_val = 1;
         for (size_t l = 0; l < n; l++) {
-            if (matrix[l][l] == 0) {
+            if (matrix[l * n + l] == 0) {
                 for (size_t j = l; j < n; j++) {
-                    if (matrix[j][l] != 0) {
+                    if (matrix[j * n + l] != 0) {
                         for (size_t k = l; k < n; k++) {
-                            _DataType c = matrix[l][k];
-                            matrix[l][k] = -1 * matrix[j][k];
-                            matrix[j][k] = c;
+                            _DataType c = matrix[l * n + k];
+                            matrix[l * n + k] = -1 * matrix[j * n + k];
+                            matrix[j * n + k] = c;
                         }
                         break;
                     }
-                    if (j == n - 1 and matrix[j][l] == 0) {
+                    if (j == n - 1 and matrix[j * n + l] == 0) {
                         det_val = 0;
                     }
                 }
             }
             if (det_val != 0) {
                 for (size_t j = l + 1; j < n; j++) {
-                    _DataType quotient = -(matrix[j][l] / matrix[l][l]);
+                    _DataType quotient =
+                        -(matrix[j * n + l] / matrix[l * n + l]);
                     for (size_t k = l + 1; k < n; k++) {
-                        matrix[j][k] += quotient * matrix[l][k];
+                        matrix[j * n + k] += quotient * matrix[l * n + k];
                     }
                 }
             }
@@ -220,14 +208,25 @@ DPCTLSyclEventRef dpnp_det_c(DPCTLSyclQueueRef q_ref,
 
         if (det_val != 0) {
             for (size_t l = 0; l < n; l++) {
-                det_val *= matrix[l][l];
+                det_val *= matrix[l * n + l];
             }
         }
 
         result[i] = det_val;
-    }
+    };
 
-    return event_ref;
+    auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(copy_event);
+        cgh.parallel_for<class dpnp_det_c_kernel<_DataType>>(
+            sycl::range<1>(size_out), kernel_parallel_for_func);
+    };
+
+    sycl::event event = q.submit(kernel_func);
+
+    dpnp_pool_free_async(q, {matrices}, {event});
+
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType>
@@ -257,6 +256,9 @@ DPCTLSyclEventRef (*dpnp_det_ext_c)(DPCTLSyclQueueRef,
                                     const DPCTLEventVectorRef) =
     dpnp_det_c<_DataType>;
 
+template <typename _DataType, typename _ResultType>
+class dpnp_inv_c_kernel;
+
 template <typename _DataType, typename _ResultType>
 DPCTLSyclEventRef dpnp_inv_c(DPCTLSyclQueueRef q_ref,
                              void *array1_in,
@@ -267,7 +269,6 @@ DPCTLSyclEventRef dpnp_inv_c(DPCTLSyclQueueRef q_ref,
 {
     // avoid warning unused variable
     (void)ndim;
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
 
@@ -278,84 +279,84 @@ DPCTLSyclEventRef dpnp_inv_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, input_size, true);
-    DPNPC_ptr_adapter<_ResultType> result_ptr(q_ref, result1, input_size, true,
-                                              true);
-
-    _DataType *array_1 = input1_ptr.get_ptr();
-    _ResultType *result = result_ptr.get_ptr();
+    _DataType *array_1 = static_cast<_DataType *>(array1_in);
+    _ResultType *result = static_cast<_ResultType *>(result1);
 
-    size_t n = shape[0];
+    const size_t n = shape[0];
 
-    _ResultType a_arr[n][n];
-    _ResultType e_arr[n][n];
+    // Gauss-Jordan elimination of the matrix, the result is transformed from
+    // the identity matrix
+    _ResultType *a_arr =
+        dpnp_pool_malloc<_ResultType>(n * n, q, sycl::usm::alloc::device);
 
-    for (size_t i = 0; i < n; ++i) {
-        for (size_t j = 0; j < n; ++j) {
-            a_arr[i][j] = array_1[i * n + j];
-            if (i == j) {
-                e_arr[i][j] = 1;
-            }
-            else {
-                e_arr[i][j] = 0;
+    auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
+        cgh.single_task<class dpnp_inv_c_kernel<_DataType, _ResultType>>([=] {
+            _ResultType *e_arr = result;
+
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    a_arr[i * n + j] = array_1[i * n + j];
+                    e_arr[i * n + j] = (i == j) ? 1 : 0;
+                }
             }
-        }
-    }
 
-    for (size_t k = 0; k < n; ++k) {
-        if (a_arr[k][k] == 0) {
-            for (size_t i = k; i < n; ++i) {
-                if (a_arr[i][k] != 0) {
-                    for (size_t j = 0; j < n; ++j) {
-                        float c = a_arr[k][j];
-                        a_arr[k][j] = a_arr[i][j];
-                        a_arr[i][j] = c;
-                        float c_e = e_arr[k][j];
-                        e_arr[k][j] = e_arr[i][j];
-                        e_arr[i][j] = c_e;
+            for (size_t k = 0; k < n; ++k) {
+                if (a_arr[k * n + k] == 0) {
+                    for (size_t i = k; i < n; ++i) {
+                        if (a_arr[i * n + k] != 0) {
+                            for (size_t j = 0; j < n; ++j) {
+                                _ResultType c = a_arr[k * n + j];
+                                a_arr[k * n + j] = a_arr[i * n + j];
+                                a_arr[i * n + j] = c;
+                                _ResultType c_e = e_arr[k * n + j];
+                                e_arr[k * n + j] = e_arr[i * n + j];
+                                e_arr[i * n + j] = c_e;
+                            }
+                            break;
+                        }
                     }
-                    break;
                 }
-            }
-        }
 
-        float temp = a_arr[k][k];
+                _ResultType temp = a_arr[k * n + k];
 
-        for (size_t j = 0; j < n; ++j) {
-            a_arr[k][j] = a_arr[k][j] / temp;
-            e_arr[k][j] = e_arr[k][j] / temp;
-        }
+                for (size_t j = 0; j < n; ++j) {
+                    a_arr[k * n + j] = a_arr[k * n + j] / temp;
+                    e_arr[k * n + j] = e_arr[k * n + j] / temp;
+                }
 
-        for (size_t i = k + 1; i < n; ++i) {
-            temp = a_arr[i][k];
-            for (size_t j = 0; j < n; j++) {
-                a_arr[i][j] = a_arr[i][j] - a_arr[k][j] * temp;
-                e_arr[i][j] = e_arr[i][j] - e_arr[k][j] * temp;
+                for (size_t i = k + 1; i < n; ++i) {
+                    temp = a_arr[i * n + k];
+                    for (size_t j = 0; j < n; j++) {
+                        a_arr[i * n + j] -= a_arr[k * n + j] * temp;
+                        e_arr[i * n + j] -= e_arr[k * n + j] * temp;
+                    }
+                }
             }
-        }
-    }
 
-    for (size_t k = 0; k < n - 1; ++k) {
-        size_t ind_k = n - 1 - k;
-        for (size_t i = 0; i < ind_k; ++i) {
-            size_t ind_i = ind_k - 1 - i;
+            for (size_t k = 0; k < n - 1; ++k) {
+                size_t ind_k = n - 1 - k;
+                for (size_t i = 0; i < ind_k; ++i) {
+                    size_t ind_i = ind_k - 1 - i;
 
-            float temp = a_arr[ind_i][ind_k];
-            for (size_t j = 0; j < n; ++j) {
-                a_arr[ind_i][j] = a_arr[ind_i][j] - a_arr[ind_k][j] * temp;
-                e_arr[ind_i][j] = e_arr[ind_i][j] - e_arr[ind_k][j] * temp;
+                    _ResultType temp = a_arr[ind_i * n + ind_k];
+                    for (size_t j = 0; j < n; ++j) {
+                        a_arr[ind_i * n + j] -= a_arr[ind_k * n + j] * temp;
+                        e_arr[ind_i * n + j] -= e_arr[ind_k * n + j] * temp;
+                    }
+                }
             }
-        }
-    }
+        });
+    };
 
-    for (size_t i = 0; i < n; ++i) {
-        for (size_t j = 0; j < n; ++j) {
-            result[i * n + j] = e_arr[i][j];
-        }
-    }
+    sycl::event event = q.submit(kernel_func);
+
+    dpnp_pool_free_async(q, {a_arr}, {event});
 
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType, typename _ResultType>
@@ -399,9 +400,6 @@ DPCTLSyclEventRef dpnp_kron_c(DPCTLSyclQueueRef q_ref,
                               size_t ndim,
                               const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     const size_t input1_size = std::accumulate(
@@ -415,6 +413,7 @@ DPCTLSyclEventRef dpnp_kron_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     DPNPC_ptr_adapter<_DataType1> input1_ptr(q_ref, array1_in, input1_size);
     DPNPC_ptr_adapter<_DataType2> input2_ptr(q_ref, array2_in, input2_size);
@@ -465,6 +464,7 @@ DPCTLSyclEventRef dpnp_kron_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<
             class dpnp_kron_c_kernel<_DataType1, _DataType2, _ResultType>>(
             gws, kernel_parallel_for_func);
@@ -472,6 +472,13 @@ DPCTLSyclEventRef dpnp_kron_c(DPCTLSyclQueueRef q_ref,
 
     sycl::event event = q.submit(kernel_func);
 
+    input1_ptr.depends_on(event);
+    input2_ptr.depends_on(event);
+    result_ptr.depends_on(event);
+    dpnp_pool_free_async(
+        q, {_in1_shape, _in2_shape, in1_offsets, in2_offsets, res_offsets},
+        {event});
+
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
 
     return DPCTLEvent_Copy(event_ref);
@@ -518,6 +525,9 @@ DPCTLSyclEventRef (*dpnp_kron_ext_c)(DPCTLSyclQueueRef,
                                      const DPCTLEventVectorRef) =
     dpnp_kron_c<_DataType1, _DataType2, _ResultType>;
 
+template <typename _DataType>
+class dpnp_matrix_rank_c_kernel;
+
 template <typename _DataType>
 DPCTLSyclEventRef
     dpnp_matrix_rank_c(DPCTLSyclQueueRef q_ref,
@@ -527,9 +537,6 @@ DPCTLSyclEventRef
                        size_t ndim,
                        const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     const size_t input_size = std::accumulate(
@@ -539,11 +546,10 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, input_size, true);
-    DPNPC_ptr_adapter<_DataType> result_ptr(q_ref, result1, 1, true, true);
-    _DataType *array_1 = input1_ptr.get_ptr();
-    _DataType *result = result_ptr.get_ptr();
+    _DataType *array_1 = static_cast<_DataType *>(array1_in);
+    _DataType *result = static_cast<_DataType *>(result1);
 
     shape_elem_type elems = 1;
     if (ndim > 1) {
@@ -555,17 +561,27 @@ DPCTLSyclEventRef
         }
     }
 
-    _DataType acc = 0;
-    for (size_t i = 0; i < static_cast<size_t>(elems); i++) {
-        size_t ind = 0;
-        for (size_t j = 0; j < ndim; j++) {
-            ind += (shape[j] - 1) * i;
-        }
-        acc += array_1[ind];
+    // distance between diagonal elements
+    size_t diag_stride = 0;
+    for (size_t j = 0; j < ndim; j++) {
+        diag_stride += shape[j] - 1;
     }
-    result[0] = acc;
 
-    return event_ref;
+    auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
+        cgh.single_task<class dpnp_matrix_rank_c_kernel<_DataType>>([=] {
+            _DataType acc = 0;
+            for (size_t i = 0; i < static_cast<size_t>(elems); i++) {
+                acc += array_1[i * diag_stride];
+            }
+            result[0] = acc;
+        });
+    };
+
+    sycl::event event = q.submit(kernel_func);
+
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType>
@@ -595,6 +611,15 @@ DPCTLSyclEventRef (*dpnp_matrix_rank_ext_c)(DPCTLSyclQueueRef,
                                             const DPCTLEventVectorRef) =
     dpnp_matrix_rank_c<_DataType>;
 
+template <typename _InputDT, typename _ComputeDT>
+class dpnp_qr_transpose_c_kernel;
+
+template <typename _InputDT, typename _ComputeDT>
+class dpnp_qr_r_c_kernel;
+
+template <typename _InputDT, typename _ComputeDT>
+class dpnp_qr_q_c_kernel;
+
 template <typename _InputDT, typename _ComputeDT>
 DPCTLSyclEventRef dpnp_qr_c(DPCTLSyclQueueRef q_ref,
                             void *array1_in,
@@ -605,73 +630,70 @@ DPCTLSyclEventRef dpnp_qr_c(DPCTLSyclQueueRef q_ref,
                             size_t size_n,
                             const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
 
-    sycl::event event;
+    if (!size_m || !size_n) {
+        return event_ref;
+    }
+
+    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    DPNPC_ptr_adapter<_InputDT> input1_ptr(q_ref, array1_in, size_m * size_n,
-                                           true);
-    _InputDT *in_array = input1_ptr.get_ptr();
+    _InputDT *in_array = static_cast<_InputDT *>(array1_in);
+    _ComputeDT *res_q = static_cast<_ComputeDT *>(result1);
+    _ComputeDT *res_r = static_cast<_ComputeDT *>(result2);
+    _ComputeDT *tau = static_cast<_ComputeDT *>(result3);
 
     // math lib func overrides input
-    _ComputeDT *in_a = reinterpret_cast<_ComputeDT *>(
-        sycl::malloc_shared(size_m * size_n * sizeof(_ComputeDT), q));
+    _ComputeDT *in_a = dpnp_pool_malloc<_ComputeDT>(size_m * size_n, q,
+                                                    sycl::usm::alloc::device);
 
-    for (size_t i = 0; i < size_m; ++i) {
-        for (size_t j = 0; j < size_n; ++j) {
-            // TODO transpose? use dpnp_transpose_c()
-            in_a[j * size_m + i] = in_array[i * size_n + j];
-        }
-    }
+    // TODO transpose? use dpnp_transpose_c()
+    sycl::event event = q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
+        cgh.parallel_for<
+            class dpnp_qr_transpose_c_kernel<_InputDT, _ComputeDT>>(
+            sycl::range<2>(size_m, size_n), [=](sycl::id<2> global_id) {
+                const size_t i = global_id[0];
+                const size_t j = global_id[1];
+                in_a[j * size_m + i] = in_array[i * size_n + j];
+            });
+    });
 
     const size_t min_size_m_n = std::min<size_t>(size_m, size_n);
-    DPNPC_ptr_adapter<_ComputeDT> result1_ptr(
-        q_ref, result1, size_m * min_size_m_n, true, true);
-    DPNPC_ptr_adapter<_ComputeDT> result2_ptr(
-        q_ref, result2, min_size_m_n * size_n, true, true);
-    DPNPC_ptr_adapter<_ComputeDT> result3_ptr(q_ref, result3, min_size_m_n,
-                                              true, true);
-    _ComputeDT *res_q = result1_ptr.get_ptr();
-    _ComputeDT *res_r = result2_ptr.get_ptr();
-    _ComputeDT *tau = result3_ptr.get_ptr();
 
     const std::int64_t lda = size_m;
 
     const std::int64_t geqrf_scratchpad_size =
         mkl_lapack::geqrf_scratchpad_size<_ComputeDT>(q, size_m, size_n, lda);
 
-    _ComputeDT *geqrf_scratchpad = reinterpret_cast<_ComputeDT *>(
-        sycl::malloc_shared(geqrf_scratchpad_size * sizeof(_ComputeDT), q));
+    _ComputeDT *geqrf_scratchpad = dpnp_pool_malloc<_ComputeDT>(
+        geqrf_scratchpad_size, q, sycl::usm::alloc::device);
 
-    std::vector<sycl::event> depends(1);
+    std::vector<sycl::event> depends{event};
     set_barrier_event(q, depends);
 
     event = mkl_lapack::geqrf(q, size_m, size_n, in_a, lda, tau,
                               geqrf_scratchpad, geqrf_scratchpad_size, depends);
-    event.wait();
 
     if (!depends.empty()) {
         verbose_print("oneapi::mkl::lapack::geqrf", depends.front(), event);
     }
 
-    sycl::free(geqrf_scratchpad, q);
+    dpnp_pool_free_async(q, {geqrf_scratchpad}, {event});
 
     // R
-    size_t mrefl = min_size_m_n;
-    for (size_t i = 0; i < mrefl; ++i) {
-        for (size_t j = 0; j < size_n; ++j) {
-            if (j >= i) {
-                res_r[i * size_n + j] = in_a[j * size_m + i];
-            }
-            else {
-                res_r[i * size_n + j] = _ComputeDT(0);
-            }
-        }
-    }
+    const size_t mrefl = min_size_m_n;
+    event = q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(event);
+        cgh.parallel_for<class dpnp_qr_r_c_kernel<_InputDT, _ComputeDT>>(
+            sycl::range<2>(mrefl, size_n), [=](sycl::id<2> global_id) {
+                const size_t i = global_id[0];
+                const size_t j = global_id[1];
+                res_r[i * size_n + j] =
+                    (j >= i) ? in_a[j * size_m + i] : _ComputeDT(0);
+            });
+    });
 
     // Q
     const size_t nrefl = min_size_m_n;
@@ -679,30 +701,36 @@ DPCTLSyclEventRef dpnp_qr_c(DPCTLSyclQueueRef q_ref,
         mkl_lapack::orgqr_scratchpad_size<_ComputeDT>(q, size_m, nrefl, nrefl,
                                                       lda);
 
-    _ComputeDT *orgqr_scratchpad = reinterpret_cast<_ComputeDT *>(
-        sycl::malloc_shared(orgqr_scratchpad_size * sizeof(_ComputeDT), q));
+    _ComputeDT *orgqr_scratchpad = dpnp_pool_malloc<_ComputeDT>(
+        orgqr_scratchpad_size, q, sycl::usm::alloc::device);
 
+    // R is read from in_a before it is overridden
+    depends = {event};
     set_barrier_event(q, depends);
 
     event = mkl_lapack::orgqr(q, size_m, nrefl, nrefl, in_a, lda, tau,
                               orgqr_scratchpad, orgqr_scratchpad_size, depends);
-    event.wait();
 
     if (!depends.empty()) {
         verbose_print("oneapi::mkl::lapack::orgqr", depends.front(), event);
     }
 
-    sycl::free(orgqr_scratchpad, q);
+    dpnp_pool_free_async(q, {orgqr_scratchpad}, {event});
 
-    for (size_t i = 0; i < size_m; ++i) {
-        for (size_t j = 0; j < nrefl; ++j) {
-            res_q[i * nrefl + j] = in_a[j * size_m + i];
-        }
-    }
+    event = q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(event);
+        cgh.parallel_for<class dpnp_qr_q_c_kernel<_InputDT, _ComputeDT>>(
+            sycl::range<2>(size_m, nrefl), [=](sycl::id<2> global_id) {
+                const size_t i = global_id[0];
+                const size_t j = global_id[1];
+                res_q[i * nrefl + j] = in_a[j * size_m + i];
+            });
+    });
 
-    sycl::free(in_a, q);
+    dpnp_pool_free_async(q, {in_a}, {event});
 
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _InputDT, typename _ComputeDT>
@@ -737,6 +765,9 @@ DPCTLSyclEventRef (*dpnp_qr_ext_c)(DPCTLSyclQueueRef,
                                    const DPCTLEventVectorRef) =
     dpnp_qr_c<_InputDT, _ComputeDT>;
 
+template <typename _InputDT, typename _ComputeDT, typename _SVDT>
+class dpnp_svd_c_kernel;
+
 template <typename _InputDT, typename _ComputeDT, typename _SVDT>
 DPCTLSyclEventRef dpnp_svd_c(DPCTLSyclQueueRef q_ref,
                              void *array1_in,
@@ -747,36 +778,32 @@ DPCTLSyclEventRef dpnp_svd_c(DPCTLSyclQueueRef q_ref,
                              size_t size_n,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
 
-    sycl::event event;
+    if (!size_m || !size_n) {
+        return event_ref;
+    }
+
+    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    DPNPC_ptr_adapter<_InputDT> input1_ptr(
-        q_ref, array1_in, size_m * size_n,
-        true); // TODO no need this if use dpnp_copy_to()
-    _InputDT *in_array = input1_ptr.get_ptr();
+    _InputDT *in_array = static_cast<_InputDT *>(array1_in);
+    _ComputeDT *res_u = static_cast<_ComputeDT *>(result1);
+    _SVDT *res_s = static_cast<_SVDT *>(result2);
+    _ComputeDT *res_vt = static_cast<_ComputeDT *>(result3);
 
     // math lib gesvd func overrides input
-    _ComputeDT *in_a = reinterpret_cast<_ComputeDT *>(
-        sycl::malloc_shared(size_m * size_n * sizeof(_ComputeDT), q));
-    for (size_t it = 0; it < size_m * size_n; ++it) {
-        in_a[it] = in_array[it]; // TODO Type conversion. memcpy can not be used
-                                 // directly. dpnp_copy_to() ?
-    }
-
-    DPNPC_ptr_adapter<_ComputeDT> result1_ptr(q_ref, result1, size_m * size_m,
-                                              true, true);
-    DPNPC_ptr_adapter<_SVDT> result2_ptr(q_ref, result2,
-                                         std::min(size_m, size_n), true, true);
-    DPNPC_ptr_adapter<_ComputeDT> result3_ptr(q_ref, result3, size_n * size_n,
-                                              true, true);
-    _ComputeDT *res_u = result1_ptr.get_ptr();
-    _SVDT *res_s = result2_ptr.get_ptr();
-    _ComputeDT *res_vt = result3_ptr.get_ptr();
+    _ComputeDT *in_a = dpnp_pool_malloc<_ComputeDT>(size_m * size_n, q,
+                                                    sycl::usm::alloc::device);
+
+    // TODO Type conversion. memcpy can not be used directly. dpnp_copy_to() ?
+    sycl::event event = q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
+        cgh.parallel_for<class dpnp_svd_c_kernel<_InputDT, _ComputeDT, _SVDT>>(
+            sycl::range<1>(size_m * size_n), [=](sycl::id<1> global_id) {
+                in_a[global_id] = in_array[global_id];
+            });
+    });
 
     const std::int64_t m = size_m;
     const std::int64_t n = size_n;
@@ -790,21 +817,20 @@ DPCTLSyclEventRef dpnp_svd_c(DPCTLSyclQueueRef q_ref,
             q, oneapi::mkl::jobsvd::vectors, oneapi::mkl::jobsvd::vectors, n, m,
             lda, ldvt, ldu);
 
-    _ComputeDT *scratchpad = reinterpret_cast<_ComputeDT *>(
-        sycl::malloc_shared(scratchpad_size * sizeof(_ComputeDT), q));
+    _ComputeDT *scratchpad = dpnp_pool_malloc<_ComputeDT>(
+        scratchpad_size, q, sycl::usm::alloc::device);
 
     event =
         mkl_lapack::gesvd(q,
                           oneapi::mkl::jobsvd::vectors, // onemkl::job jobu,
                           oneapi::mkl::jobsvd::vectors, // onemkl::job jobvt,
                           n, m, in_a, lda, res_s, res_vt, ldvt, res_u, ldu,
-                          scratchpad, scratchpad_size);
-
-    event.wait();
+                          scratchpad, scratchpad_size, {event});
 
-    sycl::free(scratchpad, q);
+    dpnp_pool_free_async(q, {in_a, scratchpad}, {event});
 
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _InputDT, typename _ComputeDT, typename _SVDT>
@@ -29,6 +29,7 @@
 #include "dpnp_iface.hpp"
 #include "dpnp_iterator.hpp"
 #include "dpnpc_memory_adapter.hpp"
+#include "memory_pool_sycl.hpp"
 #include "queue_sycl.hpp"
 
 template <typename _DataType, typename _ResultType>
@@ -44,9 +45,6 @@ DPCTLSyclEventRef dpnp_all_c(DPCTLSyclQueueRef q_ref,
     static_assert(std::is_same_v<_ResultType, bool>,
                   "Boolean result type is required");
 
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!array1_in || !result1) {
@@ -54,6 +52,7 @@ DPCTLSyclEventRef dpnp_all_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     const _DataType *array_in = static_cast<const _DataType *>(array1_in);
     bool *result = static_cast<bool *>(result1);
@@ -92,6 +91,7 @@ DPCTLSyclEventRef dpnp_all_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.depends_on(fill_event);
         cgh.parallel_for<class dpnp_all_c_kernel<_DataType, _ResultType>>(
             gws, kernel_parallel_for_func);
@@ -140,9 +140,6 @@ DPCTLSyclEventRef dpnp_allclose_c(DPCTLSyclQueueRef q_ref,
                                   double atol_val,
                                   const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!array1_in || !result1) {
@@ -150,6 +147,7 @@ DPCTLSyclEventRef dpnp_allclose_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     sycl::event event;
 
     DPNPC_ptr_adapter<_DataType1> input1_ptr(q_ref, array1_in, size);
@@ -177,12 +175,16 @@ DPCTLSyclEventRef dpnp_allclose_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<
             class dpnp_allclose_c_kernel<_DataType1, _DataType2, _ResultType>>(
             gws, kernel_parallel_for_func);
     };
 
     event = q.submit(kernel_func);
+    input1_ptr.depends_on(event);
+    input2_ptr.depends_on(event);
+    result1_ptr.depends_on(event);
 
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
 
@@ -204,6 +206,7 @@ void dpnp_allclose_c(const void *array1_in,
             q_ref, array1_in, array2_in, result1, size, rtol_val, atol_val,
             dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType1, typename _DataType2, typename _ResultType>
@@ -239,9 +242,6 @@ DPCTLSyclEventRef dpnp_any_c(DPCTLSyclQueueRef q_ref,
     static_assert(std::is_same_v<_ResultType, bool>,
                   "Boolean result type is required");
 
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!array1_in || !result1) {
@@ -249,6 +249,7 @@ DPCTLSyclEventRef dpnp_any_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     const _DataType *array_in = static_cast<const _DataType *>(array1_in);
     bool *result = static_cast<bool *>(result1);
@@ -287,6 +288,7 @@ DPCTLSyclEventRef dpnp_any_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.depends_on(fill_event);
         cgh.parallel_for<class dpnp_any_c_kernel<_DataType, _ResultType>>(
             gws, kernel_parallel_for_func);
@@ -350,7 +352,6 @@ DPCTLSyclEventRef (*dpnp_any_ext_c)(DPCTLSyclQueueRef,
     {                                                                          \
         /* avoid warning unused variable*/                                     \
         (void)where;                                                           \
-        (void)dep_event_vec_ref;                                               \
                                                                                \
         DPCTLSyclEventRef event_ref = nullptr;                                 \
                                                                                \
@@ -359,6 +360,8 @@ DPCTLSyclEventRef (*dpnp_any_ext_c)(DPCTLSyclQueueRef,
         }                                                                      \
                                                                                \
         sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));             \
+        const std::vector<sycl::event> dep_events =                            \
+            cast_event_vector(dep_event_vec_ref);                              \
                                                                                \
         _DataType_input1 *input1_data =                                        \
             static_cast<_DataType_input1 *>(const_cast<void *>(input1_in));    \
@@ -425,17 +428,15 @@ DPCTLSyclEventRef (*dpnp_any_ext_c)(DPCTLSyclQueueRef,
                 }                                                              \
             };                                                                 \
             auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
                 cgh.parallel_for<class __name__##_broadcast_kernel<            \
                     _DataType_input1, _DataType_input2>>(                      \
                     gws, kernel_parallel_for_func);                            \
             };                                                                 \
                                                                                \
-            q.submit(kernel_func).wait();                                      \
-                                                                               \
-            input1_it->~DPNPC_id();                                            \
-            input2_it->~DPNPC_id();                                            \
-                                                                               \
-            return event_ref;                                                  \
+            event = q.submit(kernel_func);                                     \
+            event = dpnp_iterators_free_async(q_ref, {event}, input1_it,       \
+                                              input2_it);                      \
         }                                                                      \
         else if (use_strides) {                                                \
             if ((result_ndim != input1_ndim) || (result_ndim != input2_ndim))  \
@@ -447,45 +448,55 @@ DPCTLSyclEventRef (*dpnp_any_ext_c)(DPCTLSyclQueueRef,
                     " or input2 ndim=" + std::to_string(input2_ndim));         \
             }                                                                  \
                                                                                \
-            /* memory transfer optimization, use USM-host for temporary speeds \
-             * up tranfer to device */                                         \
-            using usm_host_allocatorT =                                        \
-                sycl::usm_allocator<shape_elem_type, sycl::usm::alloc::host>;  \
-                                                                               \
             size_t strides_size = 3 * result_ndim;                             \
-            shape_elem_type *dev_strides_data =                                \
-                sycl::malloc_device<shape_elem_type>(strides_size, q);         \
                                                                                \
-            /* create host temporary for packed strides managed by shared      \
-             * pointer */                                                      \
-            auto strides_host_packed =                                         \
-                std::vector<shape_elem_type, usm_host_allocatorT>(             \
-                    strides_size, usm_host_allocatorT(q));                     \
+            /* strides of up to DPNP_KERNEL_ARG_MAX_NDIM dimensions are passed \
+             * to the kernel by value, so no temporary USM memory is needed */ \
+            dpnp_kernel_array<shape_elem_type, 3 * DPNP_KERNEL_ARG_MAX_NDIM>   \
+                strides_by_value{};                                            \
+            shape_elem_type *dev_strides_data = nullptr;                       \
+            shape_elem_type *strides_host_packed = strides_by_value.data;      \
+                                                                               \
+            if (result_ndim > DPNP_KERNEL_ARG_MAX_NDIM) {                      \
+                dev_strides_data = dpnp_pool_malloc<shape_elem_type>(          \
+                    strides_size, q, sycl::usm::alloc::device);                \
+                                                                               \
+                /* memory transfer optimization, use USM-host for temporary    \
+                 * speeds up tranfer to device. Both temporaries are released  \
+                 * when the kernel is done */                                  \
+                strides_host_packed = dpnp_pool_malloc<shape_elem_type>(       \
+                    strides_size, q, sycl::usm::alloc::host);                  \
+            }                                                                  \
                                                                                \
             /* packed vector is concatenation of result_strides,               \
              * input1_strides and input2_strides */                            \
             std::copy(result_strides, result_strides + result_ndim,            \
-                      strides_host_packed.begin());                            \
+                      strides_host_packed);                                    \
             std::copy(input1_strides, input1_strides + result_ndim,            \
-                      strides_host_packed.begin() + result_ndim);              \
+                      strides_host_packed + result_ndim);                      \
             std::copy(input2_strides, input2_strides + result_ndim,            \
-                      strides_host_packed.begin() + 2 * result_ndim);          \
+                      strides_host_packed + 2 * result_ndim);                  \
                                                                                \
-            auto copy_strides_ev = q.copy<shape_elem_type>(                    \
-                strides_host_packed.data(), dev_strides_data,                  \
-                strides_host_packed.size());                                   \
+            std::vector<sycl::event> copy_strides_ev;                          \
+            if (dev_strides_data != nullptr) {                                 \
+                copy_strides_ev.push_back(q.copy<shape_elem_type>(             \
+                    strides_host_packed, dev_strides_data, strides_size));     \
+            }                                                                  \
                                                                                \
             auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {       \
                 const size_t output_id =                                       \
                     global_id[0]; /* for (size_t i = 0; i < result_size; ++i)  \
                                    */                                          \
                 {                                                              \
+                    const shape_elem_type *strides_data =                      \
+                        dev_strides_data ? dev_strides_data                    \
+                                         : strides_by_value.data;              \
                     const shape_elem_type *result_strides_data =               \
-                        &dev_strides_data[0];                                  \
+                        &strides_data[0];                                      \
                     const shape_elem_type *input1_strides_data =               \
-                        &dev_strides_data[result_ndim];                        \
+                        &strides_data[result_ndim];                            \
                     const shape_elem_type *input2_strides_data =               \
-                        &dev_strides_data[2 * result_ndim];                    \
+                        &strides_data[2 * result_ndim];                        \
                                                                                \
                     size_t input1_id = 0;                                      \
                     size_t input2_id = 0;                                      \
@@ -507,16 +518,18 @@ DPCTLSyclEventRef (*dpnp_any_ext_c)(DPCTLSyclQueueRef,
                 }                                                              \
             };                                                                 \
             auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
                 cgh.depends_on(copy_strides_ev);                               \
                 cgh.parallel_for<class __name__##_strides_kernel<              \
                     _DataType_input1, _DataType_input2>>(                      \
                     gws, kernel_parallel_for_func);                            \
             };                                                                 \
                                                                                \
-            q.submit(kernel_func).wait();                                      \
-                                                                               \
-            sycl::free(dev_strides_data, q);                                   \
-            return event_ref;                                                  \
+            event = q.submit(kernel_func);                                     \
+            if (dev_strides_data != nullptr) {                                 \
+                dpnp_pool_free_async(                                          \
+                    q, {dev_strides_data, strides_host_packed}, {event});      \
+            }                                                                  \
         }                                                                      \
         else {                                                                 \
             constexpr size_t lws = 64;                                         \
@@ -564,6 +577,7 @@ DPCTLSyclEventRef (*dpnp_any_ext_c)(DPCTLSyclQueueRef,
             };                                                                 \
                                                                                \
             auto kernel_func = [&](sycl::handler &cgh) {                       \
+                cgh.depends_on(dep_events);                                    \
                 cgh.parallel_for<class __name__##_kernel<_DataType_input1,     \
                                                          _DataType_input2>>(   \
                     sycl::nd_range<1>(gws_range, lws_range),                   \
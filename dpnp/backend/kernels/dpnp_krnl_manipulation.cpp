@@ -32,6 +32,7 @@
 #include "dpnp_fptr.hpp"
 #include "dpnp_utils.hpp"
 #include "dpnpc_memory_adapter.hpp"
+#include "memory_pool_sycl.hpp"
 #include "queue_sycl.hpp"
 
 template <typename _DataType>
@@ -45,9 +46,6 @@ DPCTLSyclEventRef dpnp_repeat_c(DPCTLSyclQueueRef q_ref,
                                 const size_t size,
                                 const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!array1_in || !result1) {
@@ -59,6 +57,7 @@ DPCTLSyclEventRef dpnp_repeat_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     sycl::event event;
 
     DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size);
@@ -73,11 +72,13 @@ DPCTLSyclEventRef dpnp_repeat_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_repeat_c_kernel<_DataType>>(
             gws, kernel_parallel_for_func);
     };
 
     event = q.submit(kernel_func);
+    input1_ptr.depends_on(event);
 
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
 
@@ -95,6 +96,7 @@ void dpnp_repeat_c(const void *array1_in,
     DPCTLSyclEventRef event_ref = dpnp_repeat_c<_DataType>(
         q_ref, array1_in, result1, repeats, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -127,9 +129,6 @@ DPCTLSyclEventRef
                               size_t size,
                               const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -137,23 +136,23 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     sycl::event event;
 
     DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size);
     _DataType *array1 = input1_ptr.get_ptr();
     _DataType *result = reinterpret_cast<_DataType *>(result1);
 
-    shape_elem_type *input_offset_shape = reinterpret_cast<shape_elem_type *>(
-        sycl::malloc_shared(ndim * sizeof(shape_elem_type), q));
+    shape_elem_type *input_offset_shape = dpnp_pool_malloc<shape_elem_type>(
+        ndim, q, sycl::usm::alloc::shared);
     get_shape_offsets_inkernel(input_shape, ndim, input_offset_shape);
 
-    shape_elem_type *temp_result_offset_shape =
-        reinterpret_cast<shape_elem_type *>(
-            sycl::malloc_shared(ndim * sizeof(shape_elem_type), q));
-    get_shape_offsets_inkernel(result_shape, ndim, temp_result_offset_shape);
+    std::vector<shape_elem_type> temp_result_offset_shape(ndim);
+    get_shape_offsets_inkernel(result_shape, ndim,
+                               temp_result_offset_shape.data());
 
-    shape_elem_type *result_offset_shape = reinterpret_cast<shape_elem_type *>(
-        sycl::malloc_shared(ndim * sizeof(shape_elem_type), q));
+    shape_elem_type *result_offset_shape = dpnp_pool_malloc<shape_elem_type>(
+        ndim, q, sycl::usm::alloc::shared);
     for (size_t axis = 0; axis < ndim; ++axis) {
         result_offset_shape[permute_axes[axis]] =
             temp_result_offset_shape[axis];
@@ -178,19 +177,18 @@ DPCTLSyclEventRef
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_elemwise_transpose_c_kernel<_DataType>>(
             gws, kernel_parallel_for_func);
     };
 
     event = q.submit(kernel_func);
 
-    event.wait();
+    input1_ptr.depends_on(event);
+    dpnp_pool_free_async(q, {input_offset_shape, result_offset_shape}, {event});
 
-    sycl::free(input_offset_shape, q);
-    sycl::free(temp_result_offset_shape, q);
-    sycl::free(result_offset_shape, q);
-
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType>
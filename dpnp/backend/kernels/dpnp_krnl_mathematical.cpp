@@ -47,7 +47,6 @@ DPCTLSyclEventRef dpnp_around_c(DPCTLSyclQueueRef q_ref,
                                 const DPCTLEventVectorRef dep_event_vec_ref)
 {
     (void)decimals;
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
 
@@ -56,6 +55,7 @@ DPCTLSyclEventRef dpnp_around_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     sycl::event event;
 
     DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, input_in, input_size);
@@ -65,7 +65,7 @@ DPCTLSyclEventRef dpnp_around_c(DPCTLSyclQueueRef q_ref,
     if constexpr (std::is_same<_DataType, double>::value ||
                   std::is_same<_DataType, float>::value)
     {
-        event = oneapi::mkl::vm::rint(q, input_size, input, result);
+        event = oneapi::mkl::vm::rint(q, input_size, input, result, dep_events);
     }
     else {
         sycl::range<1> gws(input_size);
@@ -77,6 +77,7 @@ DPCTLSyclEventRef dpnp_around_c(DPCTLSyclQueueRef q_ref,
         };
 
         auto kernel_func = [&](sycl::handler &cgh) {
+            cgh.depends_on(dep_events);
             cgh.parallel_for<class dpnp_around_c_kernel<_DataType>>(
                 gws, kernel_parallel_for_func);
         };
@@ -84,6 +85,7 @@ DPCTLSyclEventRef dpnp_around_c(DPCTLSyclQueueRef q_ref,
         event = q.submit(kernel_func);
     }
 
+    input1_ptr.depends_on(event);
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
 
     return DPCTLEvent_Copy(event_ref);
@@ -100,6 +102,7 @@ void dpnp_around_c(const void *input_in,
     DPCTLSyclEventRef event_ref = dpnp_around_c<_DataType>(
         q_ref, input_in, result_out, input_size, decimals, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -127,9 +130,6 @@ DPCTLSyclEventRef
                              size_t size,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -137,6 +137,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     sycl::event event;
 
     _DataType_input *array1 =
@@ -146,7 +147,7 @@ DPCTLSyclEventRef
     if constexpr (is_any_v<_DataType_input, float, double, std::complex<float>,
                            std::complex<double>>)
     {
-        event = oneapi::mkl::vm::abs(q, size, array1, result);
+        event = oneapi::mkl::vm::abs(q, size, array1, result, dep_events);
     }
     else {
         static_assert(
@@ -204,6 +205,7 @@ DPCTLSyclEventRef
         };
 
         auto kernel_func = [&](sycl::handler &cgh) {
+            cgh.depends_on(dep_events);
             cgh.parallel_for<class dpnp_elemwise_absolute_c_kernel<
                 _DataType_input, _DataType_output>>(
                 sycl::nd_range<1>(gws_range, lws_range),
@@ -263,10 +265,11 @@ DPCTLSyclEventRef dpnp_cross_c(DPCTLSyclQueueRef q_ref,
     (void)input2_shape;
     (void)input2_shape_ndim;
     (void)where;
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<_DataType_input1> input1_ptr(q_ref, input1_in,
                                                    input1_size, true);
@@ -309,6 +312,7 @@ void dpnp_cross_c(void *result_out,
             input1_shape_ndim, input2_in, input2_size, input2_shape,
             input2_shape_ndim, where, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType_output,
@@ -354,9 +358,6 @@ DPCTLSyclEventRef dpnp_cumprod_c(DPCTLSyclQueueRef q_ref,
                                  size_t size,
                                  const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -364,6 +365,8 @@ DPCTLSyclEventRef dpnp_cumprod_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<_DataType_input> input1_ptr(q_ref, array1_in, size, true);
     DPNPC_ptr_adapter<_DataType_output> result_ptr(q_ref, result1, size, true,
@@ -390,6 +393,7 @@ void dpnp_cumprod_c(void *array1_in, void *result1, size_t size)
         dpnp_cumprod_c<_DataType_input, _DataType_output>(
             q_ref, array1_in, result1, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType_input, typename _DataType_output>
@@ -415,9 +419,6 @@ DPCTLSyclEventRef dpnp_cumsum_c(DPCTLSyclQueueRef q_ref,
                                 size_t size,
                                 const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -425,6 +426,8 @@ DPCTLSyclEventRef dpnp_cumsum_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<_DataType_input> input1_ptr(q_ref, array1_in, size, true);
     DPNPC_ptr_adapter<_DataType_output> result_ptr(q_ref, result1, size, true,
@@ -451,6 +454,7 @@ void dpnp_cumsum_c(void *array1_in, void *result1, size_t size)
         dpnp_cumsum_c<_DataType_input, _DataType_output>(
             q_ref, array1_in, result1, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType_input, typename _DataType_output>
@@ -492,7 +496,6 @@ DPCTLSyclEventRef dpnp_ediff1d_c(DPCTLSyclQueueRef q_ref,
     (void)input1_shape;
     (void)input1_strides;
     (void)where;
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
 
@@ -501,6 +504,7 @@ DPCTLSyclEventRef dpnp_ediff1d_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     DPNPC_ptr_adapter<_DataType_input> input1_ptr(q_ref, input1_in,
                                                   input1_size);
@@ -523,6 +527,7 @@ DPCTLSyclEventRef dpnp_ediff1d_c(DPCTLSyclQueueRef q_ref,
         }
     };
     auto kernel_func = [&](cl::sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<
             class dpnp_ediff1d_c_kernel<_DataType_input, _DataType_output>>(
             gws, kernel_parallel_for_func);
@@ -557,6 +562,7 @@ void dpnp_ediff1d_c(void *result_out,
             result_strides, input1_in, input1_size, input1_ndim, input1_shape,
             input1_strides, where, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType_input, typename _DataType_output>
@@ -613,7 +619,6 @@ DPCTLSyclEventRef
 {
     // avoid warning unused variable
     (void)where;
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
 
@@ -622,6 +627,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     DPNPC_ptr_adapter<_DataType_input1> input1_ptr(q_ref, input1_in,
                                                    input1_size);
@@ -665,6 +671,7 @@ DPCTLSyclEventRef
         result[i] = static_cast<_DataType_output>(sycl::floor(div));
     };
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_floor_divide_c_kernel<
             _DataType_output, _DataType_input1, _DataType_input2>>(
             gws, kernel_parallel_for_func);
@@ -678,9 +685,9 @@ DPCTLSyclEventRef
                       std::is_same<_DataType_input2, _DataType_input1>::value)
         {
             event = oneapi::mkl::vm::div(q, input1_size, input1_data,
-                                         input2_data, result);
-            event.wait();
-            event = oneapi::mkl::vm::floor(q, input1_size, result, result);
+                                         input2_data, result, dep_events);
+            event =
+                oneapi::mkl::vm::floor(q, input1_size, result, result, {event});
         }
         else {
             event = q.submit(kernel_func);
@@ -698,7 +705,8 @@ DPCTLSyclEventRef
     sycl::free(input1_it, q);
     sycl::free(input2_it, q);
 
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType_output,
@@ -771,12 +779,10 @@ DPCTLSyclEventRef dpnp_modf_c(DPCTLSyclQueueRef q_ref,
                               size_t size,
                               const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
     sycl::event event;
 
     DPNPC_ptr_adapter<_DataType_input> input1_ptr(q_ref, array1_in, size);
@@ -789,7 +795,8 @@ DPCTLSyclEventRef dpnp_modf_c(DPCTLSyclQueueRef q_ref,
     if constexpr (std::is_same<_DataType_input, double>::value ||
                   std::is_same<_DataType_input, float>::value)
     {
-        event = oneapi::mkl::vm::modf(q, size, array1, result2, result1);
+        event = oneapi::mkl::vm::modf(q, size, array1, result2, result1,
+                                      dep_events);
     }
     else {
         sycl::range<1> gws(size);
@@ -802,6 +809,7 @@ DPCTLSyclEventRef dpnp_modf_c(DPCTLSyclQueueRef q_ref,
         };
 
         auto kernel_func = [&](sycl::handler &cgh) {
+            cgh.depends_on(dep_events);
             cgh.parallel_for<
                 class dpnp_modf_c_kernel<_DataType_input, _DataType_output>>(
                 gws, kernel_parallel_for_func);
@@ -810,6 +818,7 @@ DPCTLSyclEventRef dpnp_modf_c(DPCTLSyclQueueRef q_ref,
         event = q.submit(kernel_func);
     }
 
+    input1_ptr.depends_on(event);
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
 
     return DPCTLEvent_Copy(event_ref);
@@ -867,7 +876,6 @@ DPCTLSyclEventRef dpnp_remainder_c(DPCTLSyclQueueRef q_ref,
 {
     // avoid warning unused variable
     (void)where;
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
 
@@ -876,6 +884,7 @@ DPCTLSyclEventRef dpnp_remainder_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     DPNPC_ptr_adapter<_DataType_input1> input1_ptr(q_ref, input1_in,
                                                    input1_size);
@@ -918,6 +927,7 @@ DPCTLSyclEventRef dpnp_remainder_c(DPCTLSyclQueueRef q_ref,
         result[i] = sycl::fmod(add, (double)input2_elem);
     };
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<class dpnp_remainder_c_kernel<
             _DataType_output, _DataType_input1, _DataType_input2>>(
             gws, kernel_parallel_for_func);
@@ -931,13 +941,11 @@ DPCTLSyclEventRef dpnp_remainder_c(DPCTLSyclQueueRef q_ref,
                       std::is_same<_DataType_input2, _DataType_input1>::value)
         {
             event = oneapi::mkl::vm::fmod(q, input1_size, input1_data,
-                                          input2_data, result);
-            event.wait();
+                                          input2_data, result, dep_events);
             event = oneapi::mkl::vm::add(q, input1_size, result, input2_data,
-                                         result);
-            event.wait();
+                                         result, {event});
             event = oneapi::mkl::vm::fmod(q, input1_size, result, input2_data,
-                                          result);
+                                          result, {event});
         }
         else {
             event = q.submit(kernel_func);
@@ -952,7 +960,11 @@ DPCTLSyclEventRef dpnp_remainder_c(DPCTLSyclQueueRef q_ref,
     input1_it->~DPNPC_id();
     input2_it->~DPNPC_id();
 
-    return event_ref;
+    dpnp_memory_free_c(q_ref, input1_it);
+    dpnp_memory_free_c(q_ref, input2_it);
+
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType_output,
@@ -1029,9 +1041,6 @@ DPCTLSyclEventRef dpnp_trapz_c(DPCTLSyclQueueRef q_ref,
                                size_t array2_size,
                                const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if ((array1_in == nullptr) || (array2_in == nullptr && array2_size > 1)) {
@@ -1039,6 +1048,8 @@ DPCTLSyclEventRef dpnp_trapz_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
     sycl::event event;
 
     DPNPC_ptr_adapter<_DataType_input1> input1_ptr(q_ref, array1_in,
@@ -75,10 +75,12 @@ void dpnp_rng_srand_c(size_t seed)
 }
 
 template <typename _DistrType, typename _EngineType, typename _DataType>
-static inline DPCTLSyclEventRef dpnp_rng_generate(const _DistrType &distr,
-                                                  _EngineType &engine,
-                                                  const int64_t size,
-                                                  _DataType *result)
+static inline DPCTLSyclEventRef
+    dpnp_rng_generate(const _DistrType &distr,
+                      _EngineType &engine,
+                      const int64_t size,
+                      _DataType *result,
+                      const std::vector<sycl::event> &dep_events)
 {
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::event event;
@@ -86,7 +88,7 @@ static inline DPCTLSyclEventRef dpnp_rng_generate(const _DistrType &distr,
     // perform rng generation
     try {
         event = mkl_rng::generate<_DistrType, _EngineType>(distr, engine, size,
-                                                           result);
+                                                           result, dep_events);
         event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
     } catch (const std::exception &e) {
         // TODO: add error reporting
@@ -96,12 +98,14 @@ static inline DPCTLSyclEventRef dpnp_rng_generate(const _DistrType &distr,
 }
 
 template <typename _EngineType, typename _DataType>
-static inline DPCTLSyclEventRef dpnp_rng_generate_uniform(_EngineType &engine,
-                                                          sycl::queue *q,
-                                                          const _DataType a,
-                                                          const _DataType b,
-                                                          const int64_t size,
-                                                          _DataType *result)
+static inline DPCTLSyclEventRef
+    dpnp_rng_generate_uniform(_EngineType &engine,
+                              sycl::queue *q,
+                              const _DataType a,
+                              const _DataType b,
+                              const int64_t size,
+                              _DataType *result,
+                              const std::vector<sycl::event> &dep_events)
 {
     DPCTLSyclEventRef event_ref = nullptr;
 
@@ -121,8 +125,8 @@ static inline DPCTLSyclEventRef dpnp_rng_generate_uniform(_EngineType &engine,
 
             // perform generation
             try {
-                sycl::event event =
-                    mkl_rng::generate(distribution, engine, size, result);
+                sycl::event event = mkl_rng::generate(distribution, engine,
+                                                      size, result, dep_events);
 
                 event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
                 return DPCTLEvent_Copy(event_ref);
@@ -142,7 +146,7 @@ static inline DPCTLSyclEventRef dpnp_rng_generate_uniform(_EngineType &engine,
     mkl_rng::uniform<_DataType, method_type> distribution(a, b);
 
     // perform generation
-    return dpnp_rng_generate(distribution, engine, size, result);
+    return dpnp_rng_generate(distribution, engine, size, result, dep_events);
 }
 
 template <typename _DataType>
@@ -153,9 +157,6 @@ DPCTLSyclEventRef dpnp_rng_beta_c(DPCTLSyclQueueRef q_ref,
                                   const size_t size,
                                   const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -163,6 +164,7 @@ DPCTLSyclEventRef dpnp_rng_beta_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     _DataType displacement = _DataType(0.0);
 
@@ -172,8 +174,8 @@ DPCTLSyclEventRef dpnp_rng_beta_c(DPCTLSyclQueueRef q_ref,
 
     mkl_rng::beta<_DataType> distribution(a, b, displacement, scalefactor);
     // perform generation
-    auto event_out =
-        mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+    auto event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                       result1, dep_events);
 
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
 
@@ -191,6 +193,7 @@ void dpnp_rng_beta_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_beta_c<_DataType>(
         q_ref, result, a, b, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -217,9 +220,6 @@ DPCTLSyclEventRef
                         const size_t size,
                         const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (result == nullptr) {
@@ -230,6 +230,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     if (ntrial == 0 || p == 0) {
         event_ref =
@@ -248,8 +249,8 @@ DPCTLSyclEventRef
     else {
         _DataType *result1 = reinterpret_cast<_DataType *>(result);
         mkl_rng::binomial<_DataType> distribution(ntrial, p);
-        auto event_out =
-            mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+        auto event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                           result1, dep_events);
         event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
     }
     return DPCTLEvent_Copy(event_ref);
@@ -266,6 +267,7 @@ void dpnp_rng_binomial_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_binomial_c<_DataType>(
         q_ref, result, ntrial, p, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -292,9 +294,6 @@ DPCTLSyclEventRef
                          const size_t size,
                          const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -302,12 +301,13 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     _DataType *result1 = reinterpret_cast<_DataType *>(result);
 
     mkl_rng::chi_square<_DataType> distribution(df);
-    auto event_out =
-        mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+    auto event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                       result1, dep_events);
 
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
 
@@ -322,6 +322,7 @@ void dpnp_rng_chisquare_c(void *result, const int df, const size_t size)
     DPCTLSyclEventRef event_ref = dpnp_rng_chisquare_c<_DataType>(
         q_ref, result, df, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -344,9 +345,6 @@ DPCTLSyclEventRef
                            const size_t size,
                            const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -354,6 +352,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     // set displacement a
     const _DataType a = (_DataType(0.0));
@@ -362,8 +361,8 @@ DPCTLSyclEventRef
 
     mkl_rng::exponential<_DataType> distribution(a, beta);
     // perform generation
-    auto event_out =
-        mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+    auto event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                       result1, dep_events);
 
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
 
@@ -380,6 +379,7 @@ void dpnp_rng_exponential_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_exponential_c<_DataType>(
         q_ref, result, beta, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -402,9 +402,6 @@ DPCTLSyclEventRef dpnp_rng_f_c(DPCTLSyclQueueRef q_ref,
                                const size_t size,
                                const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -412,6 +409,8 @@ DPCTLSyclEventRef dpnp_rng_f_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
     std::vector<sycl::event> no_deps;
 
     const _DataType d_zero = (_DataType(0.0));
@@ -457,6 +456,7 @@ void dpnp_rng_f_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_f_c<_DataType>(
         q_ref, result, df_num, df_den, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -482,9 +482,6 @@ DPCTLSyclEventRef dpnp_rng_gamma_c(DPCTLSyclQueueRef q_ref,
                                    const size_t size,
                                    const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::event event_out;
 
@@ -493,6 +490,7 @@ DPCTLSyclEventRef dpnp_rng_gamma_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     if (shape == 0.0 || scale == 0.0) {
         event_ref =
@@ -503,8 +501,8 @@ DPCTLSyclEventRef dpnp_rng_gamma_c(DPCTLSyclQueueRef q_ref,
         const _DataType a = (_DataType(0.0));
 
         mkl_rng::gamma<_DataType> distribution(shape, a, scale);
-        event_out =
-            mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+        event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                      result1, dep_events);
         event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
     }
 
@@ -522,6 +520,7 @@ void dpnp_rng_gamma_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_gamma_c<_DataType>(
         q_ref, result, shape, scale, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -548,9 +547,6 @@ DPCTLSyclEventRef
                         const size_t size,
                         const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -558,13 +554,14 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     _DataType *result1 = reinterpret_cast<_DataType *>(result);
 
     mkl_rng::gaussian<_DataType> distribution(mean, stddev);
     // perform generation
-    auto event_out =
-        mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+    auto event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                       result1, dep_events);
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
 
     return DPCTLEvent_Copy(event_ref);
@@ -581,6 +578,7 @@ void dpnp_rng_gaussian_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_gaussian_c<_DataType>(
         q_ref, result, mean, stddev, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -607,9 +605,6 @@ DPCTLSyclEventRef
                          const size_t size,
                          const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::event event_out;
 
@@ -618,6 +613,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     if (p == 1.0) {
         event_ref =
@@ -627,8 +623,8 @@ DPCTLSyclEventRef
         _DataType *result1 = reinterpret_cast<_DataType *>(result);
         mkl_rng::geometric<_DataType> distribution(p);
         // perform generation
-        event_out =
-            mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+        event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                      result1, dep_events);
         event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
     }
     return DPCTLEvent_Copy(event_ref);
@@ -642,6 +638,7 @@ void dpnp_rng_geometric_c(void *result, const float p, const size_t size)
     DPCTLSyclEventRef event_ref = dpnp_rng_geometric_c<_DataType>(
         q_ref, result, p, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -664,9 +661,6 @@ DPCTLSyclEventRef dpnp_rng_gumbel_c(DPCTLSyclQueueRef q_ref,
                                     const size_t size,
                                     const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::event event_out;
 
@@ -675,6 +669,7 @@ DPCTLSyclEventRef dpnp_rng_gumbel_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     if (scale == 0.0) {
         _DataType *fill_value = reinterpret_cast<_DataType *>(
@@ -693,8 +688,8 @@ DPCTLSyclEventRef dpnp_rng_gumbel_c(DPCTLSyclQueueRef q_ref,
         double negloc = loc * (double(-1.0));
 
         mkl_rng::gumbel<_DataType> distribution(negloc, scale);
-        auto event_distribution =
-            mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+        auto event_distribution = mkl_rng::generate(
+            distribution, DPNP_RNG_ENGINE, size, result1, dep_events);
 
         event_out =
             mkl_blas::scal(q, size, alpha, result1, incx, {event_distribution});
@@ -714,6 +709,7 @@ void dpnp_rng_gumbel_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_gumbel_c<_DataType>(
         q_ref, result, loc, scale, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -741,9 +737,6 @@ DPCTLSyclEventRef
                               const size_t size,
                               const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::event event_out;
 
@@ -752,6 +745,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     if (m == 0) {
         event_ref =
@@ -770,8 +764,8 @@ DPCTLSyclEventRef
     else {
         _DataType *result1 = reinterpret_cast<_DataType *>(result);
         mkl_rng::hypergeometric<_DataType> distribution(l, s, m);
-        event_out =
-            mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+        event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                      result1, dep_events);
         event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
     }
     return DPCTLEvent_Copy(event_ref);
@@ -789,6 +783,7 @@ void dpnp_rng_hypergeometric_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_hypergeometric_c<_DataType>(
         q_ref, result, l, s, m, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -818,9 +813,6 @@ DPCTLSyclEventRef
                        const size_t size,
                        const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::event event_out;
 
@@ -829,6 +821,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     if (scale == 0.0) {
         event_ref =
@@ -838,8 +831,8 @@ DPCTLSyclEventRef
         _DataType *result1 = reinterpret_cast<_DataType *>(result);
         mkl_rng::laplace<_DataType> distribution(loc, scale);
         // perform generation
-        event_out =
-            mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+        event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                      result1, dep_events);
         event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
     }
     return DPCTLEvent_Copy(event_ref);
@@ -856,6 +849,7 @@ void dpnp_rng_laplace_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_laplace_c<_DataType>(
         q_ref, result, loc, scale, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -887,9 +881,6 @@ DPCTLSyclEventRef
                         const size_t size,
                         const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size || !result) {
@@ -897,6 +888,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     const _DataType d_zero = _DataType(0.0);
     const _DataType d_one = _DataType(1.0);
@@ -914,6 +907,7 @@ DPCTLSyclEventRef
         result1[i] = loc + scale * result1[i];
     };
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.depends_on({event_distribution});
         cgh.parallel_for<class dpnp_rng_logistic_c_kernel<_DataType>>(
             gws, kernel_parallel_for_func);
@@ -935,6 +929,7 @@ void dpnp_rng_logistic_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_logistic_c<_DataType>(
         q_ref, result, loc, scale, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -962,9 +957,6 @@ DPCTLSyclEventRef
                          const size_t size,
                          const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::event event_out;
 
@@ -973,6 +965,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     _DataType *result1 = reinterpret_cast<_DataType *>(result);
 
@@ -993,8 +986,8 @@ DPCTLSyclEventRef
 
         mkl_rng::lognormal<_DataType> distribution(mean, stddev, displacement,
                                                    scalefactor);
-        event_out =
-            mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+        event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                      result1, dep_events);
         event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
     }
     return DPCTLEvent_Copy(event_ref);
@@ -1011,6 +1004,7 @@ void dpnp_rng_lognormal_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_lognormal_c<_DataType>(
         q_ref, result, mean, stddev, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -1039,9 +1033,6 @@ DPCTLSyclEventRef
                            const size_t size,
                            const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::event event_out;
 
@@ -1050,6 +1041,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     if (ntrial == 0) {
         event_ref =
@@ -1149,9 +1142,6 @@ DPCTLSyclEventRef
                                    const size_t size,
                                    const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -1159,6 +1149,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<double> mean_ptr(q_ref, mean_in, mean_size, true);
     double *mean_data = mean_ptr.get_ptr();
@@ -1235,9 +1227,6 @@ DPCTLSyclEventRef
                                  const size_t size,
                                  const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -1245,11 +1234,12 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     _DataType *result1 = reinterpret_cast<_DataType *>(result);
     mkl_rng::negative_binomial<_DataType> distribution(a, p);
-    auto event_out =
-        mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+    auto event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                       result1, dep_events);
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
 
     return DPCTLEvent_Copy(event_ref);
@@ -1266,6 +1256,7 @@ void dpnp_rng_negative_binomial_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_negative_binomial_c<_DataType>(
         q_ref, result, a, p, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -1298,9 +1289,6 @@ DPCTLSyclEventRef
                                     const size_t size,
                                     const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::event event_out;
 
@@ -1309,6 +1297,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<_DataType> result1_ptr(q_ref, result, size, false, true);
     _DataType *result1 = result1_ptr.get_ptr();
@@ -1460,6 +1450,7 @@ void dpnp_rng_noncentral_chisquare_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_noncentral_chisquare_c<_DataType>(
         q_ref, result, df, nonc, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -1487,9 +1478,6 @@ DPCTLSyclEventRef dpnp_rng_normal_c(DPCTLSyclQueueRef q_ref,
                                     void *random_state_in,
                                     const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::queue *q = reinterpret_cast<sycl::queue *>(q_ref);
 
@@ -1498,6 +1486,8 @@ DPCTLSyclEventRef dpnp_rng_normal_c(DPCTLSyclQueueRef q_ref,
     }
     assert(q != nullptr);
 
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+
     _DataType *result = static_cast<_DataType *>(result_out);
 
     // set mean of distribution
@@ -1514,7 +1504,8 @@ DPCTLSyclEventRef dpnp_rng_normal_c(DPCTLSyclQueueRef q_ref,
             static_cast<mkl_rng::mt19937 *>(random_state->engine);
 
         // perform generation with MT19937 engine
-        event_ref = dpnp_rng_generate(distribution, *engine, size, result);
+        event_ref = dpnp_rng_generate(distribution, *engine, size, result,
+                                      dep_events);
     }
     else {
         mcg59_struct *random_state =
@@ -1523,7 +1514,8 @@ DPCTLSyclEventRef dpnp_rng_normal_c(DPCTLSyclQueueRef q_ref,
             static_cast<mkl_rng::mcg59 *>(random_state->engine);
 
         // perform generation with MCG59 engine
-        event_ref = dpnp_rng_generate(distribution, *engine, size, result);
+        event_ref = dpnp_rng_generate(distribution, *engine, size, result,
+                                      dep_events);
     }
     return event_ref;
 }
@@ -1588,9 +1580,6 @@ DPCTLSyclEventRef dpnp_rng_pareto_c(DPCTLSyclQueueRef q_ref,
                                     const size_t size,
                                     const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -1598,6 +1587,8 @@ DPCTLSyclEventRef dpnp_rng_pareto_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
     std::vector<sycl::event> no_deps;
 
     const _DataType d_zero = _DataType(0.0);
@@ -1626,6 +1617,7 @@ void dpnp_rng_pareto_c(void *result, const double alpha, const size_t size)
     DPCTLSyclEventRef event_ref = dpnp_rng_pareto_c<_DataType>(
         q_ref, result, alpha, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -1649,9 +1641,6 @@ DPCTLSyclEventRef
                        const size_t size,
                        const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -1659,13 +1648,14 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     _DataType *result1 = reinterpret_cast<_DataType *>(result);
 
     mkl_rng::poisson<_DataType> distribution(lambda);
     // perform generation
-    auto event_out =
-        mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+    auto event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                       result1, dep_events);
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
 
     return DPCTLEvent_Copy(event_ref);
@@ -1679,6 +1669,7 @@ void dpnp_rng_poisson_c(void *result, const double lambda, const size_t size)
     DPCTLSyclEventRef event_ref = dpnp_rng_poisson_c<_DataType>(
         q_ref, result, lambda, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -1700,9 +1691,6 @@ DPCTLSyclEventRef dpnp_rng_power_c(DPCTLSyclQueueRef q_ref,
                                    const size_t size,
                                    const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -1710,6 +1698,8 @@ DPCTLSyclEventRef dpnp_rng_power_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
     std::vector<sycl::event> no_deps;
 
     const _DataType d_zero = _DataType(0.0);
@@ -1738,6 +1728,7 @@ void dpnp_rng_power_c(void *result, const double alpha, const size_t size)
     DPCTLSyclEventRef event_ref = dpnp_rng_power_c<_DataType>(
         q_ref, result, alpha, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -1761,9 +1752,6 @@ DPCTLSyclEventRef
                         const size_t size,
                         const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -1771,6 +1759,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
     std::vector<sycl::event> no_deps;
 
     const _DataType a = 0.0;
@@ -1799,6 +1789,7 @@ void dpnp_rng_rayleigh_c(void *result, const _DataType scale, const size_t size)
     DPCTLSyclEventRef event_ref = dpnp_rng_rayleigh_c<_DataType>(
         q_ref, result, scale, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -1823,9 +1814,6 @@ DPCTLSyclEventRef
                        const size_t size,
                        const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!result) {
@@ -1837,6 +1825,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<char> result1_ptr(q_ref, result, size * itemsize, true,
                                         true);
@@ -1904,6 +1894,7 @@ void dpnp_rng_shuffle_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_shuffle_c<_DataType>(
         q_ref, result, itemsize, ndim, high_dim_size, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -1931,9 +1922,6 @@ DPCTLSyclEventRef
                                const size_t size,
                                const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -1941,6 +1929,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     _DataType *result1 = reinterpret_cast<_DataType *>(result);
 
@@ -1950,8 +1939,8 @@ DPCTLSyclEventRef
 
     mkl_rng::cauchy<_DataType> distribution(displacement, scalefactor);
     // perform generation
-    auto event_out =
-        mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+    auto event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                       result1, dep_events);
     event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
 
     return DPCTLEvent_Copy(event_ref);
@@ -1965,6 +1954,7 @@ void dpnp_rng_standard_cauchy_c(void *result, const size_t size)
     DPCTLSyclEventRef event_ref = dpnp_rng_standard_cauchy_c<_DataType>(
         q_ref, result, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -1985,9 +1975,6 @@ DPCTLSyclEventRef
                                     const size_t size,
                                     const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -1995,6 +1982,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     // set displacement a
     const _DataType beta = (_DataType(1.0));
@@ -2013,6 +2002,7 @@ void dpnp_rng_standard_exponential_c(void *result, const size_t size)
     DPCTLSyclEventRef event_ref = dpnp_rng_standard_exponential_c<_DataType>(
         q_ref, result, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -2034,9 +2024,6 @@ DPCTLSyclEventRef
                               const size_t size,
                               const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -2044,6 +2031,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     const _DataType scale = _DataType(1.0);
 
@@ -2063,6 +2052,7 @@ void dpnp_rng_standard_gamma_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_standard_gamma_c<_DataType>(
         q_ref, result, shape, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -2097,9 +2087,6 @@ DPCTLSyclEventRef
                           const size_t size,
                           const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size || !result) {
@@ -2107,6 +2094,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     _DataType *result1 = reinterpret_cast<_DataType *>(result);
     const _DataType d_zero = 0.0, d_one = 1.0;
@@ -2145,6 +2134,7 @@ void dpnp_rng_standard_t_c(void *result, const _DataType df, const size_t size)
     DPCTLSyclEventRef event_ref = dpnp_rng_standard_t_c<_DataType>(
         q_ref, result, df, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -2172,9 +2162,6 @@ DPCTLSyclEventRef
                           const size_t size,
                           const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -2182,6 +2169,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     _DataType *result1 = reinterpret_cast<_DataType *>(result);
     const _DataType d_zero = (_DataType(0));
@@ -2230,6 +2219,7 @@ DPCTLSyclEventRef
         }
     };
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.depends_on({event_uniform});
         cgh.parallel_for<
             class dpnp_rng_triangular_ration_acceptance_c_kernel<_DataType>>(
@@ -2253,6 +2243,7 @@ void dpnp_rng_triangular_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_triangular_c<_DataType>(
         q_ref, result, x_min, x_mode, x_max, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -2283,7 +2274,6 @@ DPCTLSyclEventRef
                        void *random_state_in,
                        const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
 
@@ -2292,6 +2282,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue *q = reinterpret_cast<sycl::queue *>(q_ref);
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     _DataType *result = static_cast<_DataType *>(result_out);
 
@@ -2307,7 +2298,8 @@ DPCTLSyclEventRef
             static_cast<mkl_rng::mt19937 *>(random_state->engine);
 
         // perform generation with MT19937 engine
-        event_ref = dpnp_rng_generate_uniform(*engine, q, a, b, size, result);
+        event_ref = dpnp_rng_generate_uniform(*engine, q, a, b, size, result,
+                                              dep_events);
     }
     else {
         mcg59_struct *random_state =
@@ -2316,7 +2308,8 @@ DPCTLSyclEventRef
             static_cast<mkl_rng::mcg59 *>(random_state->engine);
 
         // perform generation with MCG59 engine
-        event_ref = dpnp_rng_generate_uniform(*engine, q, a, b, size, result);
+        event_ref = dpnp_rng_generate_uniform(*engine, q, a, b, size, result,
+                                              dep_events);
     }
     return event_ref;
 }
@@ -2389,9 +2382,6 @@ DPCTLSyclEventRef
                                     const size_t size,
                                     const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size || !result) {
@@ -2399,6 +2389,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<_DataType> result1_ptr(q_ref, result, size, true, true);
     _DataType *result1 = result1_ptr.get_ptr();
@@ -2504,6 +2496,7 @@ void dpnp_rng_vonmises_large_kappa_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_vonmises_large_kappa_c<_DataType>(
         q_ref, result, mu, kappa, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -2531,9 +2524,6 @@ DPCTLSyclEventRef
                                     const size_t size,
                                     const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size || !result) {
@@ -2541,6 +2531,8 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<_DataType> result1_ptr(q_ref, result, size, true, true);
     _DataType *result1 = result1_ptr.get_ptr();
@@ -2628,6 +2620,7 @@ void dpnp_rng_vonmises_small_kappa_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_vonmises_small_kappa_c<_DataType>(
         q_ref, result, mu, kappa, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -2661,12 +2654,11 @@ DPCTLSyclEventRef
                         const size_t size,
                         const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     if (kappa > 1.0)
         dpnp_rng_vonmises_large_kappa_c<_DataType>(result, mu, kappa, size);
@@ -2687,6 +2679,7 @@ void dpnp_rng_vonmises_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_vonmises_c<_DataType>(
         q_ref, result, mu, kappa, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -2719,9 +2712,6 @@ DPCTLSyclEventRef dpnp_rng_wald_c(DPCTLSyclQueueRef q_ref,
                                   const size_t size,
                                   const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -2729,6 +2719,8 @@ DPCTLSyclEventRef dpnp_rng_wald_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     _DataType *result1 = reinterpret_cast<_DataType *>(result);
     _DataType *uvec = nullptr;
@@ -2803,6 +2795,7 @@ void dpnp_rng_wald_c(void *result,
     DPCTLSyclEventRef event_ref = dpnp_rng_wald_c<_DataType>(
         q_ref, result, mean, scale, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -2828,9 +2821,6 @@ DPCTLSyclEventRef
                        const size_t size,
                        const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::event event_out;
 
@@ -2839,6 +2829,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     if (alpha == 0) {
         event_ref =
@@ -2850,8 +2841,8 @@ DPCTLSyclEventRef
         const _DataType beta = (_DataType(1.0));
 
         mkl_rng::weibull<_DataType> distribution(alpha, a, beta);
-        event_out =
-            mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size, result1);
+        event_out = mkl_rng::generate(distribution, DPNP_RNG_ENGINE, size,
+                                      result1, dep_events);
         event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event_out);
     }
     return DPCTLEvent_Copy(event_ref);
@@ -2865,6 +2856,7 @@ void dpnp_rng_weibull_c(void *result, const double alpha, const size_t size)
     DPCTLSyclEventRef event_ref = dpnp_rng_weibull_c<_DataType>(
         q_ref, result, alpha, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -2886,9 +2878,6 @@ DPCTLSyclEventRef dpnp_rng_zipf_c(DPCTLSyclQueueRef q_ref,
                                   const size_t size,
                                   const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!size) {
@@ -2896,6 +2885,8 @@ DPCTLSyclEventRef dpnp_rng_zipf_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
     sycl::event event_out;
 
     size_t i, n_accepted, batch_size;
@@ -2957,6 +2948,7 @@ void dpnp_rng_zipf_c(void *result, const _DataType a, const size_t size)
     DPCTLSyclEventRef event_ref =
         dpnp_rng_zipf_c<_DataType>(q_ref, result, a, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
@@ -24,12 +24,16 @@
 //*****************************************************************************
 
 #include <cmath>
+#include <functional>
 #include <iostream>
 
 #include "dpnp_fptr.hpp"
 #include "dpnp_iterator.hpp"
+#include "dpnp_reduction.hpp"
 #include "dpnp_utils.hpp"
 #include "dpnpc_memory_adapter.hpp"
+#include "host_path.hpp"
+#include "memory_pool_sycl.hpp"
 #include "queue_sycl.hpp"
 #include <dpnp_iface.hpp>
 
@@ -72,10 +76,6 @@ DPCTLSyclEventRef
                const long *where,
                const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)where;
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if ((input_in == nullptr) || (result_out == nullptr)) {
@@ -83,6 +83,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     const _DataType_output init =
         get_initial_value<_DataType_output>(initial, 0);
@@ -91,22 +92,41 @@ DPCTLSyclEventRef
         std::accumulate(input_shape, input_shape + input_shape_ndim, 1,
                         std::multiplies<shape_elem_type>());
 
-    DPNPC_ptr_adapter<_DataType_input> input1_ptr(q_ref, input_in, input_size,
-                                                  true);
-    _DataType_input *input = input1_ptr.get_ptr();
+    _DataType_input *input = get_array_ptr<_DataType_input>(input_in);
     _DataType_output *result = get_array_ptr<_DataType_output>(result_out);
 
+    // taken only if the dependencies are complete
+    const bool use_host_path =
+        dpnp_host_path(q, "dpnp_sum_c", input_size, dep_events);
+
     if (!input_shape && !input_shape_ndim) { // it is a scalar
-        // result[0] = input[0];
-        _DataType_input input_elem = 0;
-        _DataType_output result_elem = 0;
-        q.memcpy(&input_elem, input, sizeof(_DataType_input)).wait();
-        result_elem = input_elem;
-        q.memcpy(result, &result_elem, sizeof(_DataType_output)).wait();
+        if (use_host_path) {
+            result[0] = ((where == nullptr) || where[0])
+                            ? init + static_cast<_DataType_output>(input[0])
+                            : init;
+            return event_ref;
+        }
 
-        return event_ref;
+        sycl::event event = q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dep_events);
+            cgh.single_task<
+                dpnp_sum_c_kernel<_DataType_output, _DataType_input>>([=] {
+                result[0] = ((where == nullptr) || where[0])
+                                ? init + static_cast<_DataType_output>(input[0])
+                                : init;
+            });
+        });
+
+        event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+        return DPCTLEvent_Copy(event_ref);
     }
 
+    // where has the layout of the input, masked out elements are summed as
+    // zeros
+    auto is_summed = [=](const _DataType_input &x) {
+        return (where == nullptr) || where[&x - input];
+    };
+
     if constexpr ((std::is_same<_DataType_input, double>::value ||
                    std::is_same<_DataType_input, float>::value) &&
                   std::is_same<_DataType_input, _DataType_output>::value)
@@ -115,36 +135,58 @@ DPCTLSyclEventRef
         // - 1D array (no axes)
         // - same types for input and output
         // - float64 and float32 types only
-        if (axes_ndim < 1) {
+        // - no mask
+        // - no initial value
+        if ((axes_ndim < 1) && (where == nullptr) && (initial == nullptr) &&
+            !use_host_path)
+        {
             auto dataset =
                 mkl_stats::make_dataset<mkl_stats::layout::row_major>(
                     1, input_size, input);
-            sycl::event event = mkl_stats::raw_sum(q, dataset, result);
-            event.wait();
+            sycl::event event =
+                mkl_stats::raw_sum(q, dataset, result, dep_events);
 
-            return event_ref;
+            event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+            return DPCTLEvent_Copy(event_ref);
         }
     }
 
-    DPNPC_id<_DataType_input> input_it(q_ref, input, input_shape,
-                                       input_shape_ndim);
-    input_it.set_axes(axes, axes_ndim);
-
-    const size_t output_size = input_it.get_output_size();
-    auto policy = oneapi::dpl::execution::make_device_policy<
-        dpnp_sum_c_kernel<_DataType_output, _DataType_input>>(q);
-    for (size_t output_id = 0; output_id < output_size; ++output_id) {
-        // type of "init" determine internal algorithm accumulator type
-        _DataType_output accumulator = std::reduce(
-            policy, input_it.begin(output_id), input_it.end(output_id), init,
-            std::plus<_DataType_output>());
-        policy.queue().wait(); // TODO move out of the loop
-
-        q.memcpy(result + output_id, &accumulator, sizeof(_DataType_output))
-            .wait(); // result[output_id] = accumulator;
+    if (use_host_path) {
+        DPNPC_id<_DataType_input> input_it(q_ref, input, input_shape,
+                                           input_shape_ndim);
+        input_it.set_axes(axes, axes_ndim);
+
+        const size_t output_size = input_it.get_output_size();
+        for (size_t output_id = 0; output_id < output_size; ++output_id) {
+            _DataType_output acc = init;
+            for (auto it = input_it.begin(output_id),
+                      end = input_it.end(output_id);
+                 it != end; ++it)
+            {
+                if (is_summed(*it)) {
+                    acc += *it;
+                }
+            }
+            result[output_id] = acc;
+        }
+
+        return event_ref;
     }
 
-    return event_ref;
+    // all outputs in one launch, "initial" is applied once per output
+    sycl::event event = dpnp_reduce_over_axes<
+        dpnp_sum_c_kernel<_DataType_output, _DataType_input>>(
+        q_ref, result, input, input_shape, input_shape_ndim, axes, axes_ndim,
+        _DataType_output(0),
+        [=](const _DataType_input &x) {
+            return is_summed(x) ? static_cast<_DataType_output>(x)
+                                : _DataType_output(0);
+        },
+        std::plus<_DataType_output>(),
+        [init](const _DataType_output acc) { return init + acc; }, dep_events);
+
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType_output, typename _DataType_input>
@@ -190,6 +232,65 @@ DPCTLSyclEventRef (*dpnp_sum_ext_c)(DPCTLSyclQueueRef,
                                     const DPCTLEventVectorRef) =
     dpnp_sum_c<_DataType_output, _DataType_input>;
 
+template <typename _KernelNameSpecialization1,
+          typename _KernelNameSpecialization2>
+class dpnp_nansum_c_kernel;
+
+template <typename _DataType_output, typename _DataType_input>
+DPCTLSyclEventRef
+    dpnp_nansum_c(DPCTLSyclQueueRef q_ref,
+                  void *result_out,
+                  const void *input_in,
+                  const shape_elem_type *input_shape,
+                  const size_t input_shape_ndim,
+                  const shape_elem_type *axes,
+                  const size_t axes_ndim,
+                  const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    DPCTLSyclEventRef event_ref = nullptr;
+
+    if ((input_in == nullptr) || (result_out == nullptr)) {
+        return event_ref;
+    }
+
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+
+    const _DataType_input *input =
+        static_cast<const _DataType_input *>(input_in);
+    _DataType_output *result = static_cast<_DataType_output *>(result_out);
+
+    // NaN are summed as zeros, no mask or compacted copy is made
+    sycl::event event = dpnp_reduce_over_axes<
+        dpnp_nansum_c_kernel<_DataType_output, _DataType_input>>(
+        q_ref, result, input, input_shape, input_shape_ndim, axes, axes_ndim,
+        _DataType_output(0),
+        [](const _DataType_input x) {
+            if constexpr (std::is_floating_point_v<_DataType_input>) {
+                if (sycl::isnan(x)) {
+                    return _DataType_output(0);
+                }
+            }
+            return static_cast<_DataType_output>(x);
+        },
+        std::plus<_DataType_output>(),
+        [](const _DataType_output acc) { return acc; }, dep_events);
+
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+
+    return DPCTLEvent_Copy(event_ref);
+}
+
+template <typename _DataType_output, typename _DataType_input>
+DPCTLSyclEventRef (*dpnp_nansum_ext_c)(DPCTLSyclQueueRef,
+                                       void *,
+                                       const void *,
+                                       const shape_elem_type *,
+                                       const size_t,
+                                       const shape_elem_type *,
+                                       const size_t,
+                                       const DPCTLEventVectorRef) =
+    dpnp_nansum_c<_DataType_output, _DataType_input>;
+
 template <typename _KernelNameSpecialization1,
           typename _KernelNameSpecialization2>
 class dpnp_prod_c_kernel;
@@ -209,7 +310,6 @@ DPCTLSyclEventRef
 {
     // avoid warning unused variable
     (void)where;
-    (void)dep_event_vec_ref;
 
     DPCTLSyclEventRef event_ref = nullptr;
 
@@ -218,6 +318,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     const _DataType_output init =
         get_initial_value<_DataType_output>(initial, 1);
@@ -226,41 +327,60 @@ DPCTLSyclEventRef
         std::accumulate(input_shape, input_shape + input_shape_ndim, 1,
                         std::multiplies<shape_elem_type>());
 
-    DPNPC_ptr_adapter<_DataType_input> input1_ptr(q_ref, input_in, input_size,
-                                                  true);
-    _DataType_input *input = input1_ptr.get_ptr();
+    _DataType_input *input = get_array_ptr<_DataType_input>(input_in);
     _DataType_output *result = get_array_ptr<_DataType_output>(result_out);
 
+    // taken only if the dependencies are complete
+    const bool use_host_path =
+        dpnp_host_path(q, "dpnp_prod_c", input_size, dep_events);
+
     if (!input_shape && !input_shape_ndim) { // it is a scalar
-        // result[0] = input[0];
-        _DataType_input input_elem = 0;
-        _DataType_output result_elem = 0;
-        q.memcpy(&input_elem, input, sizeof(_DataType_input)).wait();
-        result_elem = input_elem;
-        q.memcpy(result, &result_elem, sizeof(_DataType_output)).wait();
+        if (use_host_path) {
+            result[0] = init * static_cast<_DataType_output>(input[0]);
+            return event_ref;
+        }
 
-        return event_ref;
+        sycl::event event = q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dep_events);
+            cgh.single_task<
+                dpnp_prod_c_kernel<_DataType_output, _DataType_input>>(
+                [=] {
+                    result[0] = init * static_cast<_DataType_output>(input[0]);
+                });
+        });
+
+        event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+        return DPCTLEvent_Copy(event_ref);
     }
 
-    DPNPC_id<_DataType_input> input_it(q_ref, input, input_shape,
-                                       input_shape_ndim);
-    input_it.set_axes(axes, axes_ndim);
-
-    const size_t output_size = input_it.get_output_size();
-    auto policy = oneapi::dpl::execution::make_device_policy<
-        dpnp_prod_c_kernel<_DataType_output, _DataType_input>>(q);
-    for (size_t output_id = 0; output_id < output_size; ++output_id) {
-        // type of "init" determine internal algorithm accumulator type
-        _DataType_output accumulator = std::reduce(
-            policy, input_it.begin(output_id), input_it.end(output_id), init,
-            std::multiplies<_DataType_output>());
-        policy.queue().wait(); // TODO move out of the loop
-
-        q.memcpy(result + output_id, &accumulator, sizeof(_DataType_output))
-            .wait(); // result[output_id] = accumulator;
+    if (use_host_path) {
+        DPNPC_id<_DataType_input> input_it(q_ref, input, input_shape,
+                                           input_shape_ndim);
+        input_it.set_axes(axes, axes_ndim);
+
+        const size_t output_size = input_it.get_output_size();
+        for (size_t output_id = 0; output_id < output_size; ++output_id) {
+            result[output_id] = std::accumulate(
+                input_it.begin(output_id), input_it.end(output_id), init,
+                std::multiplies<_DataType_output>());
+        }
+
+        return event_ref;
     }
 
-    return event_ref;
+    // all outputs in one launch, "initial" is applied once per output
+    sycl::event event = dpnp_reduce_over_axes<
+        dpnp_prod_c_kernel<_DataType_output, _DataType_input>>(
+        q_ref, result, input, input_shape, input_shape_ndim, axes, axes_ndim,
+        _DataType_output(1),
+        [](const _DataType_input x) {
+            return static_cast<_DataType_output>(x);
+        },
+        std::multiplies<_DataType_output>(),
+        [init](const _DataType_output acc) { return init * acc; }, dep_events);
+
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType_output, typename _DataType_input>
@@ -457,5 +577,41 @@ void func_map_init_reduction(func_map_t &fmap)
     fmap[DPNPFuncName::DPNP_FN_SUM_EXT][eft_DBL][eft_DBL] = {
         eft_DBL, (void *)dpnp_sum_ext_c<double, double>};
 
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_INT][eft_INT] = {
+        eft_LNG, (void *)dpnp_nansum_ext_c<int64_t, int32_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_INT][eft_LNG] = {
+        eft_LNG, (void *)dpnp_nansum_ext_c<int64_t, int32_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_INT][eft_FLT] = {
+        eft_FLT, (void *)dpnp_nansum_ext_c<float, int32_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_INT][eft_DBL] = {
+        eft_DBL, (void *)dpnp_nansum_ext_c<double, int32_t>};
+
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_LNG][eft_INT] = {
+        eft_INT, (void *)dpnp_nansum_ext_c<int32_t, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_LNG][eft_LNG] = {
+        eft_LNG, (void *)dpnp_nansum_ext_c<int64_t, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_LNG][eft_FLT] = {
+        eft_FLT, (void *)dpnp_nansum_ext_c<float, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_LNG][eft_DBL] = {
+        eft_DBL, (void *)dpnp_nansum_ext_c<double, int64_t>};
+
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_FLT][eft_INT] = {
+        eft_INT, (void *)dpnp_nansum_ext_c<int32_t, float>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_FLT][eft_LNG] = {
+        eft_LNG, (void *)dpnp_nansum_ext_c<int64_t, float>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_FLT][eft_FLT] = {
+        eft_FLT, (void *)dpnp_nansum_ext_c<float, float>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_FLT][eft_DBL] = {
+        eft_DBL, (void *)dpnp_nansum_ext_c<double, float>};
+
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_DBL][eft_INT] = {
+        eft_INT, (void *)dpnp_nansum_ext_c<int32_t, double>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_DBL][eft_LNG] = {
+        eft_LNG, (void *)dpnp_nansum_ext_c<int64_t, double>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_DBL][eft_FLT] = {
+        eft_FLT, (void *)dpnp_nansum_ext_c<float, double>};
+    fmap[DPNPFuncName::DPNP_FN_NANSUM_EXT][eft_DBL][eft_DBL] = {
+        eft_DBL, (void *)dpnp_nansum_ext_c<double, double>};
+
     return;
 }
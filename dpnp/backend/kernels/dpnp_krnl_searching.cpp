@@ -23,13 +23,84 @@
 // THE POSSIBILITY OF SUCH DAMAGE.
 //*****************************************************************************
 
+#include <functional>
 #include <iostream>
+#include <numeric>
 
 #include "dpnp_fptr.hpp"
+#include "dpnp_reduction.hpp"
 #include "dpnpc_memory_adapter.hpp"
 #include "queue_sycl.hpp"
 #include <dpnp_iface.hpp>
 
+/**
+ * Index of the extremum over an axis, or of the flattened array if @ref naxis
+ * is 0, selected by @ref _Compare as in @ref dpnp_arg_extremum. NaN are
+ * ignored if @ref skip_nan is set, the index is -1 if a reduction has no
+ * element left.
+ */
+template <typename _KernelName,
+          typename _DataType,
+          typename _idx_DataType,
+          typename _Compare>
+static DPCTLSyclEventRef
+    dpnp_arg_extremum_c(DPCTLSyclQueueRef q_ref,
+                        void *array1_in,
+                        void *result1,
+                        const shape_elem_type *shape,
+                        size_t ndim,
+                        const shape_elem_type *axis,
+                        size_t naxis,
+                        const _DataType identity,
+                        const bool skip_nan,
+                        const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    using arg_value = dpnp_arg_value<_DataType>;
+
+    DPCTLSyclEventRef event_ref = nullptr;
+
+    if (naxis > 1) {
+        throw std::runtime_error(
+            "DPNP Error: argmax and argmin reduce over a single axis");
+    }
+
+    const size_t size_input = std::accumulate(
+        shape, shape + ndim, 1, std::multiplies<shape_elem_type>());
+    if (!size_input) {
+        return event_ref;
+    }
+
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+
+    _DataType *array_1 = static_cast<_DataType *>(array1_in);
+    _idx_DataType *result = static_cast<_idx_DataType *>(result1);
+
+    const arg_value identity_value = {identity, arg_value::no_index};
+
+    auto map = [=](const _DataType x, const size_t index) {
+        if constexpr (std::is_floating_point_v<_DataType>) {
+            if (skip_nan && sycl::isnan(x)) {
+                return identity_value;
+            }
+        }
+        return arg_value{x, index};
+    };
+
+    auto finalize = [](const arg_value &acc) {
+        return (acc.index == arg_value::no_index)
+                   ? _idx_DataType(-1)
+                   : static_cast<_idx_DataType>(acc.index);
+    };
+
+    sycl::event event = dpnp_reduce_over_axes<_KernelName>(
+        q_ref, result, array_1, shape, ndim, axis, naxis, identity_value, map,
+        dpnp_arg_extremum<_DataType, _Compare>(), finalize, dep_events);
+
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+
+    return DPCTLEvent_Copy(event_ref);
+}
+
 template <typename _DataType, typename _idx_DataType>
 class dpnp_argmax_c_kernel;
 
@@ -40,27 +111,12 @@ DPCTLSyclEventRef dpnp_argmax_c(DPCTLSyclQueueRef q_ref,
                                 size_t size,
                                 const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
-    DPCTLSyclEventRef event_ref = nullptr;
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
-
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size);
-    _DataType *array_1 = input1_ptr.get_ptr();
-    _idx_DataType *result = reinterpret_cast<_idx_DataType *>(result1);
-
-    auto policy = oneapi::dpl::execution::make_device_policy<
-        class dpnp_argmax_c_kernel<_DataType, _idx_DataType>>(q);
-
-    _DataType *res = std::max_element(policy, array_1, array_1 + size);
-    policy.queue().wait();
-
-    _idx_DataType result_val = std::distance(array_1, res);
-    q.memcpy(result, &result_val, sizeof(_idx_DataType))
-        .wait(); // result[0] = std::distance(array_1, res);
-
-    return event_ref;
+    const shape_elem_type shape = size;
+    return dpnp_arg_extremum_c<
+        class dpnp_argmax_c_kernel<_DataType, _idx_DataType>, _DataType,
+        _idx_DataType, std::greater<_DataType>>(
+        q_ref, array1_in, result1, &shape, 1, nullptr, 0,
+        dpnp_maximum<_DataType>::identity(), false, dep_event_vec_ref);
 }
 
 template <typename _DataType, typename _idx_DataType>
@@ -71,6 +127,7 @@ void dpnp_argmax_c(void *array1_in, void *result1, size_t size)
     DPCTLSyclEventRef event_ref = dpnp_argmax_c<_DataType, _idx_DataType>(
         q_ref, array1_in, result1, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType, typename _idx_DataType>
@@ -86,6 +143,38 @@ DPCTLSyclEventRef (*dpnp_argmax_ext_c)(DPCTLSyclQueueRef,
                                        const DPCTLEventVectorRef) =
     dpnp_argmax_c<_DataType, _idx_DataType>;
 
+template <typename _DataType, typename _idx_DataType>
+class dpnp_argmax_axis_c_kernel;
+
+template <typename _DataType, typename _idx_DataType>
+DPCTLSyclEventRef
+    dpnp_argmax_axis_c(DPCTLSyclQueueRef q_ref,
+                    void *array1_in,
+                    void *result1,
+                    const shape_elem_type *shape,
+                    size_t ndim,
+                    const shape_elem_type *axis,
+                    size_t naxis,
+                    const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    return dpnp_arg_extremum_c<
+        class dpnp_argmax_axis_c_kernel<_DataType, _idx_DataType>, _DataType,
+        _idx_DataType, std::greater<_DataType>>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis,
+        dpnp_maximum<_DataType>::identity(), false, dep_event_vec_ref);
+}
+
+template <typename _DataType, typename _idx_DataType>
+DPCTLSyclEventRef (*dpnp_argmax_axis_ext_c)(DPCTLSyclQueueRef,
+                                            void *,
+                                            void *,
+                                            const shape_elem_type *,
+                                            size_t,
+                                            const shape_elem_type *,
+                                            size_t,
+                                            const DPCTLEventVectorRef) =
+    dpnp_argmax_axis_c<_DataType, _idx_DataType>;
+
 template <typename _DataType, typename _idx_DataType>
 class dpnp_argmin_c_kernel;
 
@@ -96,26 +185,12 @@ DPCTLSyclEventRef dpnp_argmin_c(DPCTLSyclQueueRef q_ref,
                                 size_t size,
                                 const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
-    DPCTLSyclEventRef event_ref = nullptr;
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size);
-    _DataType *array_1 = input1_ptr.get_ptr();
-    _idx_DataType *result = reinterpret_cast<_idx_DataType *>(result1);
-
-    auto policy = oneapi::dpl::execution::make_device_policy<
-        class dpnp_argmin_c_kernel<_DataType, _idx_DataType>>(q);
-
-    _DataType *res = std::min_element(policy, array_1, array_1 + size);
-    policy.queue().wait();
-
-    _idx_DataType result_val = std::distance(array_1, res);
-    q.memcpy(result, &result_val, sizeof(_idx_DataType))
-        .wait(); // result[0] = std::distance(array_1, res);
-
-    return event_ref;
+    const shape_elem_type shape = size;
+    return dpnp_arg_extremum_c<
+        class dpnp_argmin_c_kernel<_DataType, _idx_DataType>, _DataType,
+        _idx_DataType, std::less<_DataType>>(
+        q_ref, array1_in, result1, &shape, 1, nullptr, 0,
+        dpnp_minimum<_DataType>::identity(), false, dep_event_vec_ref);
 }
 
 template <typename _DataType, typename _idx_DataType>
@@ -126,6 +201,7 @@ void dpnp_argmin_c(void *array1_in, void *result1, size_t size)
     DPCTLSyclEventRef event_ref = dpnp_argmin_c<_DataType, _idx_DataType>(
         q_ref, array1_in, result1, size, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType, typename _idx_DataType>
@@ -141,6 +217,102 @@ DPCTLSyclEventRef (*dpnp_argmin_ext_c)(DPCTLSyclQueueRef,
                                        const DPCTLEventVectorRef) =
     dpnp_argmin_c<_DataType, _idx_DataType>;
 
+template <typename _DataType, typename _idx_DataType>
+class dpnp_argmin_axis_c_kernel;
+
+template <typename _DataType, typename _idx_DataType>
+DPCTLSyclEventRef
+    dpnp_argmin_axis_c(DPCTLSyclQueueRef q_ref,
+                    void *array1_in,
+                    void *result1,
+                    const shape_elem_type *shape,
+                    size_t ndim,
+                    const shape_elem_type *axis,
+                    size_t naxis,
+                    const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    return dpnp_arg_extremum_c<
+        class dpnp_argmin_axis_c_kernel<_DataType, _idx_DataType>, _DataType,
+        _idx_DataType, std::less<_DataType>>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis,
+        dpnp_minimum<_DataType>::identity(), false, dep_event_vec_ref);
+}
+
+template <typename _DataType, typename _idx_DataType>
+DPCTLSyclEventRef (*dpnp_argmin_axis_ext_c)(DPCTLSyclQueueRef,
+                                            void *,
+                                            void *,
+                                            const shape_elem_type *,
+                                            size_t,
+                                            const shape_elem_type *,
+                                            size_t,
+                                            const DPCTLEventVectorRef) =
+    dpnp_argmin_axis_c<_DataType, _idx_DataType>;
+
+template <typename _DataType, typename _idx_DataType>
+class dpnp_nanargmax_axis_c_kernel;
+
+template <typename _DataType, typename _idx_DataType>
+DPCTLSyclEventRef
+    dpnp_nanargmax_axis_c(DPCTLSyclQueueRef q_ref,
+                    void *array1_in,
+                    void *result1,
+                    const shape_elem_type *shape,
+                    size_t ndim,
+                    const shape_elem_type *axis,
+                    size_t naxis,
+                    const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    return dpnp_arg_extremum_c<
+        class dpnp_nanargmax_axis_c_kernel<_DataType, _idx_DataType>, _DataType,
+        _idx_DataType, std::greater<_DataType>>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis,
+        dpnp_maximum<_DataType>::identity(), true, dep_event_vec_ref);
+}
+
+template <typename _DataType, typename _idx_DataType>
+DPCTLSyclEventRef (*dpnp_nanargmax_axis_ext_c)(DPCTLSyclQueueRef,
+                                               void *,
+                                               void *,
+                                               const shape_elem_type *,
+                                               size_t,
+                                               const shape_elem_type *,
+                                               size_t,
+                                               const DPCTLEventVectorRef) =
+    dpnp_nanargmax_axis_c<_DataType, _idx_DataType>;
+
+template <typename _DataType, typename _idx_DataType>
+class dpnp_nanargmin_axis_c_kernel;
+
+template <typename _DataType, typename _idx_DataType>
+DPCTLSyclEventRef
+    dpnp_nanargmin_axis_c(DPCTLSyclQueueRef q_ref,
+                    void *array1_in,
+                    void *result1,
+                    const shape_elem_type *shape,
+                    size_t ndim,
+                    const shape_elem_type *axis,
+                    size_t naxis,
+                    const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    return dpnp_arg_extremum_c<
+        class dpnp_nanargmin_axis_c_kernel<_DataType, _idx_DataType>, _DataType,
+        _idx_DataType, std::less<_DataType>>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis,
+        dpnp_minimum<_DataType>::identity(), true, dep_event_vec_ref);
+}
+
+template <typename _DataType, typename _idx_DataType>
+DPCTLSyclEventRef (*dpnp_nanargmin_axis_ext_c)(DPCTLSyclQueueRef,
+                                               void *,
+                                               void *,
+                                               const shape_elem_type *,
+                                               size_t,
+                                               const shape_elem_type *,
+                                               size_t,
+                                               const DPCTLEventVectorRef) =
+    dpnp_nanargmin_axis_c<_DataType, _idx_DataType>;
+
 void func_map_init_searching(func_map_t &fmap)
 {
     fmap[DPNPFuncName::DPNP_FN_ARGMAX][eft_INT][eft_INT] = {
@@ -211,5 +383,41 @@ void func_map_init_searching(func_map_t &fmap)
     fmap[DPNPFuncName::DPNP_FN_ARGMIN_EXT][eft_DBL][eft_LNG] = {
         eft_LNG, (void *)dpnp_argmin_ext_c<double, int64_t>};
 
+    fmap[DPNPFuncName::DPNP_FN_ARGMAX_AXIS_EXT][eft_INT][eft_INT] = {
+        eft_LNG, (void *)dpnp_argmax_axis_ext_c<int32_t, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_ARGMAX_AXIS_EXT][eft_LNG][eft_LNG] = {
+        eft_LNG, (void *)dpnp_argmax_axis_ext_c<int64_t, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_ARGMAX_AXIS_EXT][eft_FLT][eft_FLT] = {
+        eft_LNG, (void *)dpnp_argmax_axis_ext_c<float, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_ARGMAX_AXIS_EXT][eft_DBL][eft_DBL] = {
+        eft_LNG, (void *)dpnp_argmax_axis_ext_c<double, int64_t>};
+
+    fmap[DPNPFuncName::DPNP_FN_ARGMIN_AXIS_EXT][eft_INT][eft_INT] = {
+        eft_LNG, (void *)dpnp_argmin_axis_ext_c<int32_t, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_ARGMIN_AXIS_EXT][eft_LNG][eft_LNG] = {
+        eft_LNG, (void *)dpnp_argmin_axis_ext_c<int64_t, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_ARGMIN_AXIS_EXT][eft_FLT][eft_FLT] = {
+        eft_LNG, (void *)dpnp_argmin_axis_ext_c<float, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_ARGMIN_AXIS_EXT][eft_DBL][eft_DBL] = {
+        eft_LNG, (void *)dpnp_argmin_axis_ext_c<double, int64_t>};
+
+    fmap[DPNPFuncName::DPNP_FN_NANARGMAX_AXIS_EXT][eft_INT][eft_INT] = {
+        eft_LNG, (void *)dpnp_nanargmax_axis_ext_c<int32_t, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANARGMAX_AXIS_EXT][eft_LNG][eft_LNG] = {
+        eft_LNG, (void *)dpnp_nanargmax_axis_ext_c<int64_t, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANARGMAX_AXIS_EXT][eft_FLT][eft_FLT] = {
+        eft_LNG, (void *)dpnp_nanargmax_axis_ext_c<float, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANARGMAX_AXIS_EXT][eft_DBL][eft_DBL] = {
+        eft_LNG, (void *)dpnp_nanargmax_axis_ext_c<double, int64_t>};
+
+    fmap[DPNPFuncName::DPNP_FN_NANARGMIN_AXIS_EXT][eft_INT][eft_INT] = {
+        eft_LNG, (void *)dpnp_nanargmin_axis_ext_c<int32_t, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANARGMIN_AXIS_EXT][eft_LNG][eft_LNG] = {
+        eft_LNG, (void *)dpnp_nanargmin_axis_ext_c<int64_t, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANARGMIN_AXIS_EXT][eft_FLT][eft_FLT] = {
+        eft_LNG, (void *)dpnp_nanargmin_axis_ext_c<float, int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANARGMIN_AXIS_EXT][eft_DBL][eft_DBL] = {
+        eft_LNG, (void *)dpnp_nanargmin_axis_ext_c<double, int64_t>};
+
     return;
 }
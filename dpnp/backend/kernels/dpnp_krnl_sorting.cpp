@@ -50,6 +50,9 @@ private:
 template <typename _DataType, typename _idx_DataType>
 class dpnp_argsort_c_kernel;
 
+template <typename _DataType, typename _idx_DataType>
+class dpnp_argsort_iota_c_kernel;
+
 template <typename _DataType, typename _idx_DataType>
 DPCTLSyclEventRef dpnp_argsort_c(DPCTLSyclQueueRef q_ref,
                                  void *array1_in,
@@ -57,29 +60,32 @@ DPCTLSyclEventRef dpnp_argsort_c(DPCTLSyclQueueRef q_ref,
                                  size_t size,
                                  const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size, true);
-    DPNPC_ptr_adapter<_idx_DataType> result1_ptr(q_ref, result1, size, true,
-                                                 true);
-    _DataType *array_1 = input1_ptr.get_ptr();
-    _idx_DataType *result = result1_ptr.get_ptr();
+    _DataType *array_1 = static_cast<_DataType *>(array1_in);
+    _idx_DataType *result = static_cast<_idx_DataType *>(result1);
 
-    std::iota(result, result + size, 0);
+    // result[i] = i
+    sycl::event iota_event = q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
+        cgh.parallel_for<
+            class dpnp_argsort_iota_c_kernel<_DataType, _idx_DataType>>(
+            sycl::range<1>(size), [=](sycl::id<1> global_id) {
+                result[global_id[0]] = global_id[0];
+            });
+    });
 
     auto policy = oneapi::dpl::execution::make_device_policy<
         class dpnp_argsort_c_kernel<_DataType, _idx_DataType>>(q);
 
-    std::sort(policy, result, result + size,
-              _argsort_less<_DataType, _idx_DataType>(array_1));
-
-    policy.queue().wait();
+    sycl::event event = oneapi::dpl::experimental::sort_async(
+        policy, result, result + size,
+        _argsort_less<_DataType, _idx_DataType>(array_1), iota_event);
 
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType, typename _idx_DataType>
@@ -128,6 +134,9 @@ struct _sort_less
 template <typename _DataType>
 class dpnp_partition_c_kernel;
 
+template <typename _DataType>
+class dpnp_partition_rows_c_kernel;
+
 template <typename _DataType>
 DPCTLSyclEventRef dpnp_partition_c(DPCTLSyclQueueRef q_ref,
                                    void *array1_in,
@@ -138,9 +147,6 @@ DPCTLSyclEventRef dpnp_partition_c(DPCTLSyclQueueRef q_ref,
                                    const size_t ndim,
                                    const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if ((array1_in == nullptr) || (array2_in == nullptr) ||
@@ -161,90 +167,60 @@ DPCTLSyclEventRef dpnp_partition_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+
+    // array2_in is a copy of the input, partitioning of the result needs no
+    // other memory
+    _DataType *arr = static_cast<_DataType *>(array1_in);
+    _DataType *result = static_cast<_DataType *>(result1);
+
+    // fill the result array with data from input one
+    sycl::event copy_event = q.copy<_DataType>(arr, result, size, dep_events);
 
+    sycl::event event;
     if (ndim == 1) // 1d array with C-contiguous data
     {
-        _DataType *arr = static_cast<_DataType *>(array1_in);
-        _DataType *result = static_cast<_DataType *>(result1);
-
         auto policy = oneapi::dpl::execution::make_device_policy<
             dpnp_partition_c_kernel<_DataType>>(q);
 
-        // fill the result array with data from input one
-        q.memcpy(result, arr, size * sizeof(_DataType)).wait();
-
-        // make a partial sorting such that:
+        // a sorted array satisfies the partition:
         // 1. result[0 <= i < kth]    <= result[kth]
         // 2. result[kth <= i < size] >= result[kth]
-        // event-blocking call, no need for wait()
-        std::nth_element(policy, result, result + kth, result + size,
-                         dpnp_less_comp());
-        return event_ref;
-    }
-
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size, true);
-    DPNPC_ptr_adapter<_DataType> input2_ptr(q_ref, array2_in, size, true);
-    DPNPC_ptr_adapter<_DataType> result1_ptr(q_ref, result1, size, true, true);
-    _DataType *arr = input1_ptr.get_ptr();
-    _DataType *arr2 = input2_ptr.get_ptr();
-    _DataType *result = result1_ptr.get_ptr();
-
-    auto arr_to_result_event = q.memcpy(result, arr, size * sizeof(_DataType));
-    arr_to_result_event.wait();
-
-    for (size_t i = 0; i < size_; ++i) {
-        size_t ind_begin = i * shape_[ndim - 1];
-        size_t ind_end = (i + 1) * shape_[ndim - 1] - 1;
-
-        _DataType matrix[shape_[ndim - 1]];
-        for (size_t j = ind_begin; j < ind_end + 1; ++j) {
-            size_t ind = j - ind_begin;
-            matrix[ind] = arr2[j];
-        }
-        std::partial_sort(matrix, matrix + shape_[ndim - 1],
-                          matrix + shape_[ndim - 1], dpnp_less_comp());
-        for (size_t j = ind_begin; j < ind_end + 1; ++j) {
-            size_t ind = j - ind_begin;
-            arr2[j] = matrix[ind];
-        }
+        event = oneapi::dpl::experimental::sort_async(
+            policy, result, result + size, dpnp_less_comp(), copy_event);
     }
-
-    shape_elem_type *shape = reinterpret_cast<shape_elem_type *>(
-        sycl::malloc_shared(ndim * sizeof(shape_elem_type), q));
-    auto memcpy_event = q.memcpy(shape, shape_, ndim * sizeof(shape_elem_type));
-
-    memcpy_event.wait();
-
-    sycl::range<2> gws(size_, kth + 1);
-    auto kernel_parallel_for_func = [=](sycl::id<2> global_id) {
-        size_t j = global_id[0];
-        size_t k = global_id[1];
-
-        _DataType val = arr2[j * shape[ndim - 1] + k];
-
-        for (size_t i = 0; i < static_cast<size_t>(shape[ndim - 1]); ++i) {
-            if (result[j * shape[ndim - 1] + i] == val) {
-                _DataType change_val1 = result[j * shape[ndim - 1] + i];
-                _DataType change_val2 = result[j * shape[ndim - 1] + k];
-                result[j * shape[ndim - 1] + k] = change_val1;
-                result[j * shape[ndim - 1] + i] = change_val2;
+    else {
+        // each work item moves kth + 1 smallest elements of its row to the
+        // beginning of the row in ascending order
+        const size_t row_size = shape_[ndim - 1];
+        const size_t selected = std::min(kth + 1, row_size);
+
+        auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {
+            _DataType *row = result + global_id[0] * row_size;
+            for (size_t i = 0; i < selected; ++i) {
+                size_t min_id = i;
+                for (size_t j = i + 1; j < row_size; ++j) {
+                    if (dpnp_less_comp()(row[j], row[min_id])) {
+                        min_id = j;
+                    }
+                }
+                const _DataType val = row[min_id];
+                row[min_id] = row[i];
+                row[i] = val;
             }
-        }
-    };
+        };
 
-    auto kernel_func = [&](sycl::handler &cgh) {
-        cgh.depends_on({memcpy_event});
-        cgh.parallel_for<class dpnp_partition_c_kernel<_DataType>>(
-            gws, kernel_parallel_for_func);
-    };
-
-    auto event = q.submit(kernel_func);
-
-    event.wait();
+        auto kernel_func = [&](sycl::handler &cgh) {
+            cgh.depends_on(copy_event);
+            cgh.parallel_for<class dpnp_partition_rows_c_kernel<_DataType>>(
+                sycl::range<1>(size_), kernel_parallel_for_func);
+        };
 
-    sycl::free(shape, q);
+        event = q.submit(kernel_func);
+    }
 
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType>
@@ -297,9 +273,6 @@ DPCTLSyclEventRef
                         const size_t v_size,
                         const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if ((array1_in == nullptr) || (v1_in == nullptr) || (result1 == nullptr)) {
@@ -315,6 +288,7 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
     DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, arr_size);
     DPNPC_ptr_adapter<_DataType> input2_ptr(q_ref, v1_in, v_size);
@@ -371,16 +345,19 @@ DPCTLSyclEventRef
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
         cgh.parallel_for<
             class dpnp_searchsorted_c_kernel<_DataType, _IndexingType>>(
             gws, kernel_parallel_for_func);
     };
 
-    auto event = q.submit(kernel_func);
+    sycl::event event = q.submit(kernel_func);
 
-    event.wait();
+    input1_ptr.depends_on(event);
+    input2_ptr.depends_on(event);
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
 
-    return event_ref;
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType, typename _IndexingType>
@@ -430,29 +407,26 @@ DPCTLSyclEventRef dpnp_sort_c(DPCTLSyclQueueRef q_ref,
                               size_t size,
                               const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size, true);
-    DPNPC_ptr_adapter<_DataType> result1_ptr(q_ref, result1, size, true, true);
-    _DataType *array_1 = input1_ptr.get_ptr();
-    _DataType *result = result1_ptr.get_ptr();
+    _DataType *array_1 = static_cast<_DataType *>(array1_in);
+    _DataType *result = static_cast<_DataType *>(result1);
 
-    std::copy(array_1, array_1 + size, result);
+    sycl::event copy_event =
+        q.copy<_DataType>(array_1, result, size, dep_events);
 
     auto policy = oneapi::dpl::execution::make_device_policy<
         class dpnp_sort_c_kernel<_DataType>>(q);
 
     // fails without explicitly specifying of comparator or with std::less
     // during kernels compilation affects other kernels
-    std::sort(policy, result, result + size, _sort_less<_DataType>());
-
-    policy.queue().wait();
+    sycl::event event = oneapi::dpl::experimental::sort_async(
+        policy, result, result + size, _sort_less<_DataType>(), copy_event);
 
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType>
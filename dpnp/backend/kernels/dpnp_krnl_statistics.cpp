@@ -26,13 +26,14 @@
 #include <iostream>
 
 #include "dpnp_fptr.hpp"
+#include "dpnp_reduction.hpp"
 #include "dpnp_utils.hpp"
 #include "dpnpc_memory_adapter.hpp"
+#include "memory_pool_sycl.hpp"
 #include "queue_sycl.hpp"
 #include <dpnp_iface.hpp>
 
 namespace mkl_blas = oneapi::mkl::blas::row_major;
-namespace mkl_stats = oneapi::mkl::stats;
 
 template <typename _KernelNameSpecialization1,
           typename _KernelNameSpecialization2,
@@ -134,6 +135,9 @@ class dpnp_cov_c_kernel1;
 template <typename _DataType>
 class dpnp_cov_c_kernel2;
 
+template <typename _DataType>
+class dpnp_cov_c_kernel3;
+
 template <typename _DataType>
 DPCTLSyclEventRef dpnp_cov_c(DPCTLSyclQueueRef q_ref,
                              void *array1_in,
@@ -142,9 +146,6 @@ DPCTLSyclEventRef dpnp_cov_c(DPCTLSyclQueueRef q_ref,
                              size_t ncols,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (!nrows || !ncols) {
@@ -152,33 +153,38 @@ DPCTLSyclEventRef dpnp_cov_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, nrows * ncols);
-    _DataType *array_1 = input1_ptr.get_ptr();
+    _DataType *array_1 = reinterpret_cast<_DataType *>(array1_in);
     _DataType *result = reinterpret_cast<_DataType *>(result1);
 
-    auto policy = oneapi::dpl::execution::make_device_policy<
-        class dpnp_cov_c_kernel1<_DataType>>(q);
-
-    _DataType *mean = reinterpret_cast<_DataType *>(
-        sycl::malloc_shared(nrows * sizeof(_DataType), q));
-    for (size_t i = 0; i < nrows; ++i) {
-        _DataType *row_start = array_1 + ncols * i;
-        mean[i] = std::reduce(policy, row_start, row_start + ncols,
-                              _DataType(0), std::plus<_DataType>()) /
-                  ncols;
-    }
-    policy.queue().wait();
-
-    _DataType *temp = reinterpret_cast<_DataType *>(
-        sycl::malloc_shared(nrows * ncols * sizeof(_DataType), q));
-    for (size_t i = 0; i < nrows; ++i) {
-        size_t offset = ncols * i;
-        _DataType *row_start = array_1 + offset;
-        std::transform(policy, row_start, row_start + ncols, temp + offset,
-                       [=](_DataType x) { return x - mean[i]; });
-    }
-    policy.queue().wait();
+    // means of all rows in one reduction
+    const shape_elem_type shape[] = {static_cast<shape_elem_type>(nrows),
+                                     static_cast<shape_elem_type>(ncols)};
+    const shape_elem_type axis[] = {1};
+    dpnp_reduction_space space;
+    dpnp_make_reduction_space(shape, 2, axis, 1, space);
+
+    _DataType *mean =
+        dpnp_pool_malloc<_DataType>(nrows, q, sycl::usm::alloc::device);
+    sycl::event event_mean = dpnp_reduce<class dpnp_cov_c_kernel1<_DataType>>(
+        q, mean, array_1, space, _DataType(0),
+        [](const _DataType x) { return x; }, std::plus<_DataType>(),
+        [ncols](const _DataType acc) { return acc / ncols; }, dep_events);
+
+    // center all rows in one kernel
+    _DataType *temp =
+        dpnp_pool_malloc<_DataType>(nrows * ncols, q, sycl::usm::alloc::device);
+    auto center_func = [=](sycl::id<1> global_id) {
+        const size_t idx = global_id[0];
+        temp[idx] = array_1[idx] - mean[idx / ncols];
+    };
+    auto center_kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(event_mean);
+        cgh.parallel_for<class dpnp_cov_c_kernel3<_DataType>>(
+            sycl::range<1>(nrows * ncols), center_func);
+    };
+    sycl::event event_center = q.submit(center_kernel_func);
 
     sycl::event event_syrk;
 
@@ -196,8 +202,8 @@ DPCTLSyclEventRef dpnp_cov_c(DPCTLSyclQueueRef q_ref,
                        ncols,                            // std::int64_t lda,
                        beta,                             // T beta,
                        result,                           // T* c,
-                       nrows);                           // std::int64_t ldc);
-    event_syrk.wait();
+                       nrows,                            // std::int64_t ldc,
+                       {event_center});                  // dependencies);
 
     // fill lower elements
     sycl::event event;
@@ -212,18 +218,17 @@ DPCTLSyclEventRef dpnp_cov_c(DPCTLSyclQueueRef q_ref,
     };
 
     auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(event_syrk);
         cgh.parallel_for<class dpnp_cov_c_kernel2<_DataType>>(
             gws, kernel_parallel_for_func);
     };
 
     event = q.submit(kernel_func);
 
-    event.wait();
-
-    sycl::free(mean, q);
-    sycl::free(temp, q);
+    dpnp_pool_free_async(q, {mean, temp}, {event_syrk});
 
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType>
@@ -234,12 +239,17 @@ void dpnp_cov_c(void *array1_in, void *result1, size_t nrows, size_t ncols)
     DPCTLSyclEventRef event_ref = dpnp_cov_c<_DataType>(
         q_ref, array1_in, result1, nrows, ncols, dep_event_vec_ref);
     DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
 }
 
 template <typename _DataType>
 void (*dpnp_cov_default_c)(void *, void *, size_t, size_t) =
     dpnp_cov_c<_DataType>;
 
+template <typename _KernelNameSpecialization1,
+          typename _KernelNameSpecialization2>
+class dpnp_count_nonzero_c_kernel;
+
 template <typename _DataType_input, typename _DataType_output>
 DPCTLSyclEventRef
     dpnp_count_nonzero_c(DPCTLSyclQueueRef q_ref,
@@ -248,9 +258,6 @@ DPCTLSyclEventRef
                          size_t size,
                          const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     DPCTLSyclEventRef event_ref = nullptr;
 
     if (array1_in == nullptr) {
@@ -258,22 +265,27 @@ DPCTLSyclEventRef
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    DPNPC_ptr_adapter<_DataType_input> input1_ptr(q_ref, array1_in, size, true);
-    DPNPC_ptr_adapter<_DataType_output> result_ptr(q_ref, result1_out, 1, true,
-                                                   true);
-    _DataType_input *array1 = input1_ptr.get_ptr();
-    _DataType_output *result1 = result_ptr.get_ptr();
+    _DataType_input *array1 = static_cast<_DataType_input *>(array1_in);
+    _DataType_output *result1 = static_cast<_DataType_output *>(result1_out);
 
-    result1[0] = 0;
+    const shape_elem_type shape[] = {static_cast<shape_elem_type>(size)};
+    dpnp_reduction_space space;
+    dpnp_make_reduction_space(shape, 1, nullptr, 0, space);
 
-    for (size_t i = 0; i < size; ++i) {
-        if (array1[i] != 0) {
-            result1[0] += 1;
-        }
-    }
+    sycl::event event = dpnp_reduce<
+        class dpnp_count_nonzero_c_kernel<_DataType_input, _DataType_output>>(
+        q, result1, array1, space, _DataType_output(0),
+        [](const _DataType_input x) {
+            return static_cast<_DataType_output>(x != _DataType_input(0));
+        },
+        std::plus<_DataType_output>(),
+        [](const _DataType_output acc) { return acc; }, dep_events);
 
-    return event_ref;
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+
+    return DPCTLEvent_Copy(event_ref);
 }
 
 template <typename _DataType_input, typename _DataType_output>
@@ -300,22 +312,25 @@ DPCTLSyclEventRef (*dpnp_count_nonzero_ext_c)(DPCTLSyclQueueRef,
                                               const DPCTLEventVectorRef) =
     dpnp_count_nonzero_c<_DataType_input, _DataType_output>;
 
-template <typename _DataType>
-class dpnp_max_c_kernel;
-
-template <typename _DataType>
-DPCTLSyclEventRef dpnp_max_c(DPCTLSyclQueueRef q_ref,
-                             void *array1_in,
-                             void *result1,
-                             const size_t result_size,
-                             const shape_elem_type *shape,
-                             size_t ndim,
-                             const shape_elem_type *axis,
-                             size_t naxis,
-                             const DPCTLEventVectorRef dep_event_vec_ref)
+/**
+ * Reduce an array over axes by maximum or minimum @ref op, all axes are
+ * reduced if @ref naxis is 0.
+ */
+template <typename _KernelName, typename _DataType, typename _BinaryOp>
+static DPCTLSyclEventRef
+    dpnp_extremum_c(DPCTLSyclQueueRef q_ref,
+                    void *array1_in,
+                    void *result1,
+                    const size_t result_size,
+                    const shape_elem_type *shape,
+                    size_t ndim,
+                    const shape_elem_type *axis,
+                    size_t naxis,
+                    const _BinaryOp op,
+                    const DPCTLEventVectorRef dep_event_vec_ref)
 {
     // avoid warning unused variable
-    (void)dep_event_vec_ref;
+    (void)result_size;
 
     DPCTLSyclEventRef event_ref = nullptr;
 
@@ -325,163 +340,38 @@ DPCTLSyclEventRef dpnp_max_c(DPCTLSyclQueueRef q_ref,
         return event_ref;
     }
 
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size_input, true);
-    DPNPC_ptr_adapter<_DataType> result_ptr(q_ref, result1, result_size, true,
-                                            true);
-    _DataType *array_1 = input1_ptr.get_ptr();
-    _DataType *result = result_ptr.get_ptr();
+    _DataType *array_1 = static_cast<_DataType *>(array1_in);
+    _DataType *result = static_cast<_DataType *>(result1);
 
-    if (naxis == 0) {
-        __attribute__((unused)) void *tmp = (void *)(axis + naxis);
+    sycl::event event = dpnp_reduce_over_axes<_KernelName>(
+        q_ref, result, array_1, shape, ndim, axis, naxis, op.identity(),
+        [](const _DataType x) { return x; }, op,
+        [](const _DataType acc) { return acc; }, dep_events);
 
-        size_t size = 1;
-        for (size_t i = 0; i < ndim; ++i) {
-            size *= shape[i];
-        }
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
 
-        if constexpr (std::is_same<_DataType, double>::value ||
-                      std::is_same<_DataType, float>::value)
-        {
-            // Required initializing the result before call the function
-            result[0] = array_1[0];
-
-            auto dataset =
-                mkl_stats::make_dataset<mkl_stats::layout::row_major>(1, size,
-                                                                      array_1);
-
-            sycl::event event = mkl_stats::max(q, dataset, result);
-
-            event.wait();
-        }
-        else {
-            auto policy = oneapi::dpl::execution::make_device_policy<
-                class dpnp_max_c_kernel<_DataType>>(q);
-
-            _DataType *res = std::max_element(policy, array_1, array_1 + size);
-            policy.queue().wait();
-
-            result[0] = *res;
-        }
-    }
-    else {
-        size_t res_ndim = ndim - naxis;
-        size_t res_shape[res_ndim];
-        int ind = 0;
-        for (size_t i = 0; i < ndim; ++i) {
-            bool found = false;
-            for (size_t j = 0; j < naxis; ++j) {
-                if (static_cast<size_t>(axis[j]) == i) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                res_shape[ind] = shape[i];
-                ind++;
-            }
-        }
-
-        size_t input_shape_offsets[ndim];
-        size_t acc = 1;
-        for (size_t i = ndim - 1; i > 0; --i) {
-            input_shape_offsets[i] = acc;
-            acc *= shape[i];
-        }
-        input_shape_offsets[0] = acc;
-
-        size_t output_shape_offsets[res_ndim];
-        acc = 1;
-        if (res_ndim > 0) {
-            for (size_t i = res_ndim - 1; i > 0; --i) {
-                output_shape_offsets[i] = acc;
-                acc *= res_shape[i];
-            }
-        }
-        output_shape_offsets[0] = acc;
-
-        size_t size_result = 1;
-        for (size_t i = 0; i < res_ndim; ++i) {
-            size_result *= res_shape[i];
-        }
-
-        // init result array
-        for (size_t result_idx = 0; result_idx < size_result; ++result_idx) {
-            size_t xyz[res_ndim];
-            size_t remainder = result_idx;
-            for (size_t i = 0; i < res_ndim; ++i) {
-                xyz[i] = remainder / output_shape_offsets[i];
-                remainder = remainder - xyz[i] * output_shape_offsets[i];
-            }
-
-            size_t source_axis[ndim];
-            size_t result_axis_idx = 0;
-            for (size_t idx = 0; idx < ndim; ++idx) {
-                bool found = false;
-                for (size_t i = 0; i < naxis; ++i) {
-                    if (static_cast<size_t>(axis[i]) == idx) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (found) {
-                    source_axis[idx] = 0;
-                }
-                else {
-                    source_axis[idx] = xyz[result_axis_idx];
-                    result_axis_idx++;
-                }
-            }
-
-            size_t source_idx = 0;
-            for (size_t i = 0; i < ndim; ++i) {
-                source_idx += input_shape_offsets[i] * source_axis[i];
-            }
-
-            result[result_idx] = array_1[source_idx];
-        }
-
-        for (size_t source_idx = 0; source_idx < size_input; ++source_idx) {
-            // reconstruct x,y,z from linear source_idx
-            size_t xyz[ndim];
-            size_t remainder = source_idx;
-            for (size_t i = 0; i < ndim; ++i) {
-                xyz[i] = remainder / input_shape_offsets[i];
-                remainder = remainder - xyz[i] * input_shape_offsets[i];
-            }
-
-            // extract result axis
-            size_t result_axis[res_ndim];
-            size_t result_idx = 0;
-            for (size_t idx = 0; idx < ndim; ++idx) {
-                // try to find current idx in axis array
-                bool found = false;
-                for (size_t i = 0; i < naxis; ++i) {
-                    if (static_cast<size_t>(axis[i]) == idx) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
-                    result_axis[result_idx] = xyz[idx];
-                    result_idx++;
-                }
-            }
-
-            // Construct result offset
-            size_t result_offset = 0;
-            for (size_t i = 0; i < res_ndim; ++i) {
-                result_offset += output_shape_offsets[i] * result_axis[i];
-            }
+    return DPCTLEvent_Copy(event_ref);
+}
 
-            if (result[result_offset] < array_1[source_idx]) {
-                result[result_offset] = array_1[source_idx];
-            }
-        }
-    }
+template <typename _DataType>
+class dpnp_max_c_kernel;
 
-    return event_ref;
+template <typename _DataType>
+DPCTLSyclEventRef dpnp_max_c(DPCTLSyclQueueRef q_ref,
+                             void *array1_in,
+                             void *result1,
+                             const size_t result_size,
+                             const shape_elem_type *shape,
+                             size_t ndim,
+                             const shape_elem_type *axis,
+                             size_t naxis,
+                             const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    return dpnp_extremum_c<class dpnp_max_c_kernel<_DataType>, _DataType>(
+        q_ref, array1_in, result1, result_size, shape, ndim, axis, naxis,
+        dpnp_maximum<_DataType>(), dep_event_vec_ref);
 }
 
 template <typename _DataType>
@@ -523,63 +413,99 @@ DPCTLSyclEventRef (*dpnp_max_ext_c)(DPCTLSyclQueueRef,
                                     const DPCTLEventVectorRef) =
     dpnp_max_c<_DataType>;
 
-template <typename _DataType, typename _ResultType>
-DPCTLSyclEventRef dpnp_mean_c(DPCTLSyclQueueRef q_ref,
-                              void *array1_in,
-                              void *result1,
-                              const shape_elem_type *shape,
-                              size_t ndim,
-                              const shape_elem_type *axis,
-                              size_t naxis,
-                              const DPCTLEventVectorRef dep_event_vec_ref)
+/**
+ * Moments of an array over axes, all axes are reduced if @ref naxis is 0, in
+ * a single pass. NaN are ignored if @ref skip_nan is set. @ref finalize
+ * converts the moments of an output into the result element.
+ */
+template <typename _KernelName,
+          typename _DataType,
+          typename _ResultType,
+          typename _Finalize>
+static DPCTLSyclEventRef
+    dpnp_moments_c(DPCTLSyclQueueRef q_ref,
+                   void *array1_in,
+                   void *result1,
+                   const shape_elem_type *shape,
+                   size_t ndim,
+                   const shape_elem_type *axis,
+                   size_t naxis,
+                   const bool skip_nan,
+                   const _Finalize finalize,
+                   const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
-    __attribute__((unused)) void *tmp = (void *)(axis + naxis);
+    using moments = dpnp_moments<_ResultType>;
 
     DPCTLSyclEventRef event_ref = nullptr;
 
-    const size_t size = std::accumulate(shape, shape + ndim, 1,
-                                        std::multiplies<shape_elem_type>());
-    if (!size) {
+    const size_t size_input = std::accumulate(
+        shape, shape + ndim, 1, std::multiplies<shape_elem_type>());
+    if (!size_input) {
         return event_ref;
     }
 
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size, true);
-    DPNPC_ptr_adapter<_ResultType> result_ptr(q_ref, result1, 1, true, true);
-    _DataType *array = input1_ptr.get_ptr();
-    _ResultType *result = result_ptr.get_ptr();
+    _DataType *array_1 = static_cast<_DataType *>(array1_in);
+    _ResultType *result = static_cast<_ResultType *>(result1);
 
-    if constexpr (std::is_same<_DataType, double>::value ||
-                  std::is_same<_DataType, float>::value)
-    {
-        auto dataset = mkl_stats::make_dataset<
-            mkl_stats::layout::row_major /*, _ResultType*/>(1, size, array);
+    const moments identity = {0, _ResultType(0), _ResultType(0)};
 
-        sycl::event event = mkl_stats::mean(q, dataset, result);
+    auto map = [=](const _DataType x) {
+        if constexpr (std::is_floating_point_v<_DataType>) {
+            if (skip_nan && sycl::isnan(x)) {
+                return identity;
+            }
+        }
+        return moments{1, static_cast<_ResultType>(x), _ResultType(0)};
+    };
 
-        event.wait();
+    sycl::event event = dpnp_reduce_over_axes<_KernelName>(
+        q_ref, result, array_1, shape, ndim, axis, naxis, identity, map,
+        dpnp_moments_merge<_ResultType>(), finalize, dep_events);
 
-        event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
 
-        return DPCTLEvent_Copy(event_ref);
-    }
-    else {
-        _ResultType *sum = reinterpret_cast<_ResultType *>(
-            sycl::malloc_shared(1 * sizeof(_ResultType), q));
+    return DPCTLEvent_Copy(event_ref);
+}
 
-        dpnp_sum_c<_ResultType, _DataType>(sum, array, shape, ndim, axis, naxis,
-                                           nullptr, nullptr);
+/// Mean from moments, NaN if there is no value
+template <typename _ResultType>
+static _ResultType dpnp_moments_mean(const dpnp_moments<_ResultType> &acc)
+{
+    return acc.count ? acc.mean : std::numeric_limits<_ResultType>::quiet_NaN();
+}
 
-        result[0] = sum[0] / static_cast<_ResultType>(size);
+/// Variance from moments with @ref ddof delta degrees of freedom, inf or NaN
+/// if there are not more values than @ref ddof
+template <typename _ResultType>
+static _ResultType dpnp_moments_var(const dpnp_moments<_ResultType> &acc,
+                                    const size_t ddof)
+{
+    const size_t dof = (acc.count > ddof) ? acc.count - ddof : 0;
+    return acc.m2 / static_cast<_ResultType>(dof);
+}
 
-        sycl::free(sum, q);
+template <typename _DataType, typename _ResultType>
+class dpnp_mean_c_kernel;
 
-        return event_ref;
-    }
+template <typename _DataType, typename _ResultType>
+DPCTLSyclEventRef dpnp_mean_c(DPCTLSyclQueueRef q_ref,
+                              void *array1_in,
+                              void *result1,
+                              const shape_elem_type *shape,
+                              size_t ndim,
+                              const shape_elem_type *axis,
+                              size_t naxis,
+                              const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    return dpnp_moments_c<class dpnp_mean_c_kernel<_DataType, _ResultType>,
+                          _DataType, _ResultType>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis, false,
+        [](const dpnp_moments<_ResultType> &acc) {
+            return dpnp_moments_mean(acc);
+        },
+        dep_event_vec_ref);
 }
 
 template <typename _DataType, typename _ResultType>
@@ -616,9 +542,6 @@ DPCTLSyclEventRef dpnp_median_c(DPCTLSyclQueueRef q_ref,
                                 size_t naxis,
                                 const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
     __attribute__((unused)) void *tmp = (void *)(axis + naxis);
 
     DPCTLSyclEventRef event_ref = nullptr;
@@ -630,6 +553,8 @@ DPCTLSyclEventRef dpnp_median_c(DPCTLSyclQueueRef q_ref,
     }
 
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    std::vector<sycl::event> dep_events = cast_event_vector(dep_event_vec_ref);
+    sycl::event::wait(dep_events);
 
     DPNPC_ptr_adapter<_ResultType> result_ptr(q_ref, result1, 1, true, true);
     _ResultType *result = result_ptr.get_ptr();
@@ -702,170 +627,9 @@ DPCTLSyclEventRef dpnp_min_c(DPCTLSyclQueueRef q_ref,
                              size_t naxis,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
-    __attribute__((unused)) void *tmp = (void *)(axis + naxis);
-
-    DPCTLSyclEventRef event_ref = nullptr;
-
-    const size_t size_input = std::accumulate(
-        shape, shape + ndim, 1, std::multiplies<shape_elem_type>());
-    if (!size_input) {
-        return event_ref;
-    }
-
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
-
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size_input, true);
-    DPNPC_ptr_adapter<_DataType> result_ptr(q_ref, result1, result_size, true,
-                                            true);
-    _DataType *array_1 = input1_ptr.get_ptr();
-    _DataType *result = result_ptr.get_ptr();
-
-    if (naxis == 0) {
-        if constexpr (std::is_same<_DataType, double>::value ||
-                      std::is_same<_DataType, float>::value)
-        {
-            // Required initializing the result before call the function
-            result[0] = array_1[0];
-
-            auto dataset =
-                mkl_stats::make_dataset<mkl_stats::layout::row_major>(
-                    1, size_input, array_1);
-
-            sycl::event event = mkl_stats::min(q, dataset, result);
-
-            event.wait();
-        }
-        else {
-            auto policy = oneapi::dpl::execution::make_device_policy<
-                class dpnp_min_c_kernel<_DataType>>(q);
-
-            _DataType *res =
-                std::min_element(policy, array_1, array_1 + size_input);
-            policy.queue().wait();
-
-            result[0] = *res;
-        }
-    }
-    else {
-        size_t res_ndim = ndim - naxis;
-        size_t res_shape[res_ndim];
-        int ind = 0;
-        for (size_t i = 0; i < ndim; i++) {
-            bool found = false;
-            for (size_t j = 0; j < naxis; j++) {
-                if (static_cast<size_t>(axis[j]) == i) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                res_shape[ind] = shape[i];
-                ind++;
-            }
-        }
-
-        size_t input_shape_offsets[ndim];
-        size_t acc = 1;
-        for (size_t i = ndim - 1; i > 0; --i) {
-            input_shape_offsets[i] = acc;
-            acc *= shape[i];
-        }
-        input_shape_offsets[0] = acc;
-
-        size_t output_shape_offsets[res_ndim];
-        acc = 1;
-        if (res_ndim > 0) {
-            for (size_t i = res_ndim - 1; i > 0; --i) {
-                output_shape_offsets[i] = acc;
-                acc *= res_shape[i];
-            }
-        }
-        output_shape_offsets[0] = acc;
-
-        size_t size_result = 1;
-        for (size_t i = 0; i < res_ndim; ++i) {
-            size_result *= res_shape[i];
-        }
-
-        // init result array
-        for (size_t result_idx = 0; result_idx < size_result; ++result_idx) {
-            size_t xyz[res_ndim];
-            size_t remainder = result_idx;
-            for (size_t i = 0; i < res_ndim; ++i) {
-                xyz[i] = remainder / output_shape_offsets[i];
-                remainder = remainder - xyz[i] * output_shape_offsets[i];
-            }
-
-            size_t source_axis[ndim];
-            size_t result_axis_idx = 0;
-            for (size_t idx = 0; idx < ndim; ++idx) {
-                bool found = false;
-                for (size_t i = 0; i < naxis; ++i) {
-                    if (static_cast<size_t>(axis[i]) == idx) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (found) {
-                    source_axis[idx] = 0;
-                }
-                else {
-                    source_axis[idx] = xyz[result_axis_idx];
-                    result_axis_idx++;
-                }
-            }
-
-            size_t source_idx = 0;
-            for (size_t i = 0; i < ndim; ++i) {
-                source_idx += input_shape_offsets[i] * source_axis[i];
-            }
-
-            result[result_idx] = array_1[source_idx];
-        }
-
-        for (size_t source_idx = 0; source_idx < size_input; ++source_idx) {
-            // reconstruct x,y,z from linear source_idx
-            size_t xyz[ndim];
-            size_t remainder = source_idx;
-            for (size_t i = 0; i < ndim; ++i) {
-                xyz[i] = remainder / input_shape_offsets[i];
-                remainder = remainder - xyz[i] * input_shape_offsets[i];
-            }
-
-            // extract result axis
-            size_t result_axis[res_ndim];
-            size_t result_idx = 0;
-            for (size_t idx = 0; idx < ndim; ++idx) {
-                // try to find current idx in axis array
-                bool found = false;
-                for (size_t i = 0; i < naxis; ++i) {
-                    if (static_cast<size_t>(axis[i]) == idx) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
-                    result_axis[result_idx] = xyz[idx];
-                    result_idx++;
-                }
-            }
-
-            // Construct result offset
-            size_t result_offset = 0;
-            for (size_t i = 0; i < res_ndim; ++i) {
-                result_offset += output_shape_offsets[i] * result_axis[i];
-            }
-
-            if (result[result_offset] > array_1[source_idx]) {
-                result[result_offset] = array_1[source_idx];
-            }
-        }
-    }
-
-    return event_ref;
+    return dpnp_extremum_c<class dpnp_min_c_kernel<_DataType>, _DataType>(
+        q_ref, array1_in, result1, result_size, shape, ndim, axis, naxis,
+        dpnp_minimum<_DataType>(), dep_event_vec_ref);
 }
 
 template <typename _DataType>
@@ -908,78 +672,69 @@ DPCTLSyclEventRef (*dpnp_min_ext_c)(DPCTLSyclQueueRef,
     dpnp_min_c<_DataType>;
 
 template <typename _DataType>
-DPCTLSyclEventRef dpnp_nanvar_c(DPCTLSyclQueueRef q_ref,
+class dpnp_nanmax_c_kernel;
+
+template <typename _DataType>
+DPCTLSyclEventRef dpnp_nanmax_c(DPCTLSyclQueueRef q_ref,
                                 void *array1_in,
-                                void *mask_arr1,
                                 void *result1,
                                 const size_t result_size,
-                                size_t arr_size,
+                                const shape_elem_type *shape,
+                                size_t ndim,
+                                const shape_elem_type *axis,
+                                size_t naxis,
                                 const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
-    DPCTLSyclEventRef event_ref = nullptr;
-
-    if ((array1_in == nullptr) || (mask_arr1 == nullptr) ||
-        (result1 == nullptr)) {
-        return event_ref;
-    }
-
-    if (arr_size == 0) {
-        return event_ref;
-    }
-
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    return dpnp_extremum_c<class dpnp_nanmax_c_kernel<_DataType>, _DataType>(
+        q_ref, array1_in, result1, result_size, shape, ndim, axis, naxis,
+        dpnp_nan_maximum<_DataType>(), dep_event_vec_ref);
+}
 
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, arr_size, true);
-    DPNPC_ptr_adapter<bool> input2_ptr(q_ref, mask_arr1, arr_size, true);
-    DPNPC_ptr_adapter<_DataType> result_ptr(q_ref, result1, result_size, true,
-                                            true);
-    _DataType *array1 = input1_ptr.get_ptr();
-    bool *mask_arr = input2_ptr.get_ptr();
-    _DataType *result = result_ptr.get_ptr();
-
-    size_t ind = 0;
-    for (size_t i = 0; i < arr_size; ++i) {
-        if (!mask_arr[i]) {
-            result[ind] = array1[i];
-            ind += 1;
-        }
-    }
+template <typename _DataType>
+DPCTLSyclEventRef (*dpnp_nanmax_ext_c)(DPCTLSyclQueueRef,
+                                       void *,
+                                       void *,
+                                       const size_t,
+                                       const shape_elem_type *,
+                                       size_t,
+                                       const shape_elem_type *,
+                                       size_t,
+                                       const DPCTLEventVectorRef) =
+    dpnp_nanmax_c<_DataType>;
 
-    return event_ref;
-}
+template <typename _DataType>
+class dpnp_nanmin_c_kernel;
 
 template <typename _DataType>
-void dpnp_nanvar_c(void *array1_in,
-                   void *mask_arr1,
-                   void *result1,
-                   const size_t result_size,
-                   size_t arr_size)
+DPCTLSyclEventRef dpnp_nanmin_c(DPCTLSyclQueueRef q_ref,
+                                void *array1_in,
+                                void *result1,
+                                const size_t result_size,
+                                const shape_elem_type *shape,
+                                size_t ndim,
+                                const shape_elem_type *axis,
+                                size_t naxis,
+                                const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&DPNP_QUEUE);
-    DPCTLEventVectorRef dep_event_vec_ref = nullptr;
-    DPCTLSyclEventRef event_ref =
-        dpnp_nanvar_c<_DataType>(q_ref, array1_in, mask_arr1, result1,
-                                 result_size, arr_size, dep_event_vec_ref);
-    DPCTLEvent_WaitAndThrow(event_ref);
-    DPCTLEvent_Delete(event_ref);
+    return dpnp_extremum_c<class dpnp_nanmin_c_kernel<_DataType>, _DataType>(
+        q_ref, array1_in, result1, result_size, shape, ndim, axis, naxis,
+        dpnp_nan_minimum<_DataType>(), dep_event_vec_ref);
 }
 
 template <typename _DataType>
-void (*dpnp_nanvar_default_c)(void *, void *, void *, const size_t, size_t) =
-    dpnp_nanvar_c<_DataType>;
-
-template <typename _DataType>
-DPCTLSyclEventRef (*dpnp_nanvar_ext_c)(DPCTLSyclQueueRef,
-                                       void *,
+DPCTLSyclEventRef (*dpnp_nanmin_ext_c)(DPCTLSyclQueueRef,
                                        void *,
                                        void *,
                                        const size_t,
+                                       const shape_elem_type *,
+                                       size_t,
+                                       const shape_elem_type *,
                                        size_t,
                                        const DPCTLEventVectorRef) =
-    dpnp_nanvar_c<_DataType>;
+    dpnp_nanmin_c<_DataType>;
+
+template <typename _DataType, typename _ResultType>
+class dpnp_std_c_kernel;
 
 template <typename _DataType, typename _ResultType>
 DPCTLSyclEventRef dpnp_std_c(DPCTLSyclQueueRef q_ref,
@@ -992,56 +747,13 @@ DPCTLSyclEventRef dpnp_std_c(DPCTLSyclQueueRef q_ref,
                              size_t ddof,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
-    DPCTLSyclEventRef event_ref = nullptr;
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
-
-    _ResultType *var = reinterpret_cast<_ResultType *>(
-        sycl::malloc_shared(1 * sizeof(_ResultType), q));
-
-    dpnp_var_c<_DataType, _ResultType>(array1_in, var, shape, ndim, axis, naxis,
-                                       ddof);
-
-    const size_t result1_size = 1;
-    const size_t result1_ndim = 1;
-    const size_t result1_shape_size_in_bytes =
-        result1_ndim * sizeof(shape_elem_type);
-    const size_t result1_strides_size_in_bytes =
-        result1_ndim * sizeof(shape_elem_type);
-    shape_elem_type *result1_shape = reinterpret_cast<shape_elem_type *>(
-        sycl::malloc_shared(result1_shape_size_in_bytes, q));
-    *result1_shape = 1;
-    shape_elem_type *result1_strides = reinterpret_cast<shape_elem_type *>(
-        sycl::malloc_shared(result1_strides_size_in_bytes, q));
-    *result1_strides = 1;
-
-    const size_t var_size = 1;
-    const size_t var_ndim = 1;
-    const size_t var_shape_size_in_bytes = var_ndim * sizeof(shape_elem_type);
-    const size_t var_strides_size_in_bytes = var_ndim * sizeof(shape_elem_type);
-    shape_elem_type *var_shape = reinterpret_cast<shape_elem_type *>(
-        sycl::malloc_shared(var_shape_size_in_bytes, q));
-    *var_shape = 1;
-    shape_elem_type *var_strides = reinterpret_cast<shape_elem_type *>(
-        sycl::malloc_shared(var_strides_size_in_bytes, q));
-    *var_strides = 1;
-
-    DPCTLSyclEventRef e_sqrt_ref = dpnp_sqrt_c<_ResultType, _ResultType>(
-        q_ref, result1, result1_size, result1_ndim, result1_shape,
-        result1_strides, var, var_size, var_ndim, var_shape, var_strides, NULL,
-        NULL);
-    DPCTLEvent_WaitAndThrow(e_sqrt_ref);
-    DPCTLEvent_Delete(e_sqrt_ref);
-
-    sycl::free(var, q);
-    sycl::free(result1_shape, q);
-    sycl::free(result1_strides, q);
-    sycl::free(var_shape, q);
-    sycl::free(var_strides, q);
-
-    return event_ref;
+    return dpnp_moments_c<class dpnp_std_c_kernel<_DataType, _ResultType>,
+                          _DataType, _ResultType>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis, false,
+        [ddof](const dpnp_moments<_ResultType> &acc) {
+            return sycl::sqrt(dpnp_moments_var(acc, ddof));
+        },
+        dep_event_vec_ref);
 }
 
 template <typename _DataType, typename _ResultType>
@@ -1097,62 +809,13 @@ DPCTLSyclEventRef dpnp_var_c(DPCTLSyclQueueRef q_ref,
                              size_t ddof,
                              const DPCTLEventVectorRef dep_event_vec_ref)
 {
-    // avoid warning unused variable
-    (void)dep_event_vec_ref;
-
-    DPCTLSyclEventRef event_ref = nullptr;
-
-    const size_t size = std::accumulate(shape, shape + ndim, 1,
-                                        std::multiplies<shape_elem_type>());
-    if (!size) {
-        return event_ref;
-    }
-
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
-    sycl::event event;
-
-    DPNPC_ptr_adapter<_DataType> input1_ptr(q_ref, array1_in, size);
-    DPNPC_ptr_adapter<_ResultType> result_ptr(q_ref, result1, 1, true, true);
-    _DataType *array1 = input1_ptr.get_ptr();
-    _ResultType *result = result_ptr.get_ptr();
-
-    _ResultType *mean = reinterpret_cast<_ResultType *>(
-        sycl::malloc_shared(1 * sizeof(_ResultType), q));
-    dpnp_mean_c<_DataType, _ResultType>(array1, mean, shape, ndim, axis, naxis);
-    _ResultType mean_val = mean[0];
-
-    _ResultType *squared_deviations = reinterpret_cast<_ResultType *>(
-        sycl::malloc_shared(size * sizeof(_ResultType), q));
-
-    sycl::range<1> gws(size);
-    auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {
-        size_t i = global_id[0]; /*for (size_t i = 0; i < size; ++i)*/
-        {
-            _ResultType deviation =
-                static_cast<_ResultType>(array1[i]) - mean_val;
-            squared_deviations[i] = deviation * deviation;
-        }
-    };
-
-    auto kernel_func = [&](sycl::handler &cgh) {
-        cgh.parallel_for<class dpnp_var_c_kernel<_DataType, _ResultType>>(
-            gws, kernel_parallel_for_func);
-    };
-
-    event = q.submit(kernel_func);
-
-    event.wait();
-
-    dpnp_mean_c<_ResultType, _ResultType>(squared_deviations, mean, shape, ndim,
-                                          axis, naxis);
-    mean_val = mean[0];
-
-    result[0] = mean_val * size / static_cast<_ResultType>(size - ddof);
-
-    sycl::free(mean, q);
-    sycl::free(squared_deviations, q);
-
-    return event_ref;
+    return dpnp_moments_c<class dpnp_var_c_kernel<_DataType, _ResultType>,
+                          _DataType, _ResultType>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis, false,
+        [ddof](const dpnp_moments<_ResultType> &acc) {
+            return dpnp_moments_var(acc, ddof);
+        },
+        dep_event_vec_ref);
 }
 
 template <typename _DataType, typename _ResultType>
@@ -1194,6 +857,136 @@ DPCTLSyclEventRef (*dpnp_var_ext_c)(DPCTLSyclQueueRef,
                                     const DPCTLEventVectorRef) =
     dpnp_var_c<_DataType, _ResultType>;
 
+template <typename _DataType, typename _ResultType>
+class dpnp_nanmean_c_kernel;
+
+template <typename _DataType, typename _ResultType>
+DPCTLSyclEventRef dpnp_nanmean_c(DPCTLSyclQueueRef q_ref,
+                                 void *array1_in,
+                                 void *result1,
+                                 const shape_elem_type *shape,
+                                 size_t ndim,
+                                 const shape_elem_type *axis,
+                                 size_t naxis,
+                                 const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    return dpnp_moments_c<class dpnp_nanmean_c_kernel<_DataType, _ResultType>,
+                          _DataType, _ResultType>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis, true,
+        [](const dpnp_moments<_ResultType> &acc) {
+            return dpnp_moments_mean(acc);
+        },
+        dep_event_vec_ref);
+}
+
+template <typename _DataType, typename _ResultType>
+DPCTLSyclEventRef (*dpnp_nanmean_ext_c)(DPCTLSyclQueueRef,
+                                        void *,
+                                        void *,
+                                        const shape_elem_type *,
+                                        size_t,
+                                        const shape_elem_type *,
+                                        size_t,
+                                        const DPCTLEventVectorRef) =
+    dpnp_nanmean_c<_DataType, _ResultType>;
+
+template <typename _DataType, typename _ResultType>
+class dpnp_nanvar_c_kernel;
+
+template <typename _DataType, typename _ResultType>
+DPCTLSyclEventRef dpnp_nanvar_c(DPCTLSyclQueueRef q_ref,
+                                void *array1_in,
+                                void *result1,
+                                const shape_elem_type *shape,
+                                size_t ndim,
+                                const shape_elem_type *axis,
+                                size_t naxis,
+                                size_t ddof,
+                                const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    return dpnp_moments_c<class dpnp_nanvar_c_kernel<_DataType, _ResultType>,
+                          _DataType, _ResultType>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis, true,
+        [ddof](const dpnp_moments<_ResultType> &acc) {
+            return dpnp_moments_var(acc, ddof);
+        },
+        dep_event_vec_ref);
+}
+
+template <typename _DataType, typename _ResultType>
+void dpnp_nanvar_c(void *array1_in,
+                   void *result1,
+                   const shape_elem_type *shape,
+                   size_t ndim,
+                   const shape_elem_type *axis,
+                   size_t naxis,
+                   size_t ddof)
+{
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&DPNP_QUEUE);
+    DPCTLEventVectorRef dep_event_vec_ref = nullptr;
+    DPCTLSyclEventRef event_ref = dpnp_nanvar_c<_DataType, _ResultType>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis, ddof,
+        dep_event_vec_ref);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+}
+
+template <typename _DataType, typename _ResultType>
+void (*dpnp_nanvar_default_c)(void *,
+                              void *,
+                              const shape_elem_type *,
+                              size_t,
+                              const shape_elem_type *,
+                              size_t,
+                              size_t) = dpnp_nanvar_c<_DataType, _ResultType>;
+
+template <typename _DataType, typename _ResultType>
+DPCTLSyclEventRef (*dpnp_nanvar_ext_c)(DPCTLSyclQueueRef,
+                                       void *,
+                                       void *,
+                                       const shape_elem_type *,
+                                       size_t,
+                                       const shape_elem_type *,
+                                       size_t,
+                                       size_t,
+                                       const DPCTLEventVectorRef) =
+    dpnp_nanvar_c<_DataType, _ResultType>;
+
+template <typename _DataType, typename _ResultType>
+class dpnp_nanstd_c_kernel;
+
+template <typename _DataType, typename _ResultType>
+DPCTLSyclEventRef dpnp_nanstd_c(DPCTLSyclQueueRef q_ref,
+                                void *array1_in,
+                                void *result1,
+                                const shape_elem_type *shape,
+                                size_t ndim,
+                                const shape_elem_type *axis,
+                                size_t naxis,
+                                size_t ddof,
+                                const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    return dpnp_moments_c<class dpnp_nanstd_c_kernel<_DataType, _ResultType>,
+                          _DataType, _ResultType>(
+        q_ref, array1_in, result1, shape, ndim, axis, naxis, true,
+        [ddof](const dpnp_moments<_ResultType> &acc) {
+            return sycl::sqrt(dpnp_moments_var(acc, ddof));
+        },
+        dep_event_vec_ref);
+}
+
+template <typename _DataType, typename _ResultType>
+DPCTLSyclEventRef (*dpnp_nanstd_ext_c)(DPCTLSyclQueueRef,
+                                       void *,
+                                       void *,
+                                       const shape_elem_type *,
+                                       size_t,
+                                       const shape_elem_type *,
+                                       size_t,
+                                       size_t,
+                                       const DPCTLEventVectorRef) =
+    dpnp_nanstd_c<_DataType, _ResultType>;
+
 void func_map_init_statistics(func_map_t &fmap)
 {
     fmap[DPNPFuncName::DPNP_FN_CORRELATE][eft_INT][eft_INT] = {
@@ -1356,23 +1149,59 @@ void func_map_init_statistics(func_map_t &fmap)
     fmap[DPNPFuncName::DPNP_FN_MIN_EXT][eft_DBL][eft_DBL] = {
         eft_DBL, (void *)dpnp_min_ext_c<double>};
 
+    fmap[DPNPFuncName::DPNP_FN_NANMAX_EXT][eft_INT][eft_INT] = {
+        eft_INT, (void *)dpnp_nanmax_ext_c<int32_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANMAX_EXT][eft_LNG][eft_LNG] = {
+        eft_LNG, (void *)dpnp_nanmax_ext_c<int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANMAX_EXT][eft_FLT][eft_FLT] = {
+        eft_FLT, (void *)dpnp_nanmax_ext_c<float>};
+    fmap[DPNPFuncName::DPNP_FN_NANMAX_EXT][eft_DBL][eft_DBL] = {
+        eft_DBL, (void *)dpnp_nanmax_ext_c<double>};
+
+    fmap[DPNPFuncName::DPNP_FN_NANMIN_EXT][eft_INT][eft_INT] = {
+        eft_INT, (void *)dpnp_nanmin_ext_c<int32_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANMIN_EXT][eft_LNG][eft_LNG] = {
+        eft_LNG, (void *)dpnp_nanmin_ext_c<int64_t>};
+    fmap[DPNPFuncName::DPNP_FN_NANMIN_EXT][eft_FLT][eft_FLT] = {
+        eft_FLT, (void *)dpnp_nanmin_ext_c<float>};
+    fmap[DPNPFuncName::DPNP_FN_NANMIN_EXT][eft_DBL][eft_DBL] = {
+        eft_DBL, (void *)dpnp_nanmin_ext_c<double>};
+
+    fmap[DPNPFuncName::DPNP_FN_NANMEAN_EXT][eft_INT][eft_INT] = {
+        eft_DBL, (void *)dpnp_nanmean_ext_c<int32_t, double>};
+    fmap[DPNPFuncName::DPNP_FN_NANMEAN_EXT][eft_LNG][eft_LNG] = {
+        eft_DBL, (void *)dpnp_nanmean_ext_c<int64_t, double>};
+    fmap[DPNPFuncName::DPNP_FN_NANMEAN_EXT][eft_FLT][eft_FLT] = {
+        eft_FLT, (void *)dpnp_nanmean_ext_c<float, float>};
+    fmap[DPNPFuncName::DPNP_FN_NANMEAN_EXT][eft_DBL][eft_DBL] = {
+        eft_DBL, (void *)dpnp_nanmean_ext_c<double, double>};
+
+    fmap[DPNPFuncName::DPNP_FN_NANSTD_EXT][eft_INT][eft_INT] = {
+        eft_DBL, (void *)dpnp_nanstd_ext_c<int32_t, double>};
+    fmap[DPNPFuncName::DPNP_FN_NANSTD_EXT][eft_LNG][eft_LNG] = {
+        eft_DBL, (void *)dpnp_nanstd_ext_c<int64_t, double>};
+    fmap[DPNPFuncName::DPNP_FN_NANSTD_EXT][eft_FLT][eft_FLT] = {
+        eft_FLT, (void *)dpnp_nanstd_ext_c<float, float>};
+    fmap[DPNPFuncName::DPNP_FN_NANSTD_EXT][eft_DBL][eft_DBL] = {
+        eft_DBL, (void *)dpnp_nanstd_ext_c<double, double>};
+
     fmap[DPNPFuncName::DPNP_FN_NANVAR][eft_INT][eft_INT] = {
-        eft_INT, (void *)dpnp_nanvar_default_c<int32_t>};
+        eft_DBL, (void *)dpnp_nanvar_default_c<int32_t, double>};
     fmap[DPNPFuncName::DPNP_FN_NANVAR][eft_LNG][eft_LNG] = {
-        eft_LNG, (void *)dpnp_nanvar_default_c<int64_t>};
+        eft_DBL, (void *)dpnp_nanvar_default_c<int64_t, double>};
     fmap[DPNPFuncName::DPNP_FN_NANVAR][eft_FLT][eft_FLT] = {
-        eft_FLT, (void *)dpnp_nanvar_default_c<float>};
+        eft_FLT, (void *)dpnp_nanvar_default_c<float, float>};
     fmap[DPNPFuncName::DPNP_FN_NANVAR][eft_DBL][eft_DBL] = {
-        eft_DBL, (void *)dpnp_nanvar_default_c<double>};
+        eft_DBL, (void *)dpnp_nanvar_default_c<double, double>};
 
     fmap[DPNPFuncName::DPNP_FN_NANVAR_EXT][eft_INT][eft_INT] = {
-        eft_INT, (void *)dpnp_nanvar_ext_c<int32_t>};
+        eft_DBL, (void *)dpnp_nanvar_ext_c<int32_t, double>};
     fmap[DPNPFuncName::DPNP_FN_NANVAR_EXT][eft_LNG][eft_LNG] = {
-        eft_LNG, (void *)dpnp_nanvar_ext_c<int64_t>};
+        eft_DBL, (void *)dpnp_nanvar_ext_c<int64_t, double>};
     fmap[DPNPFuncName::DPNP_FN_NANVAR_EXT][eft_FLT][eft_FLT] = {
-        eft_FLT, (void *)dpnp_nanvar_ext_c<float>};
+        eft_FLT, (void *)dpnp_nanvar_ext_c<float, float>};
     fmap[DPNPFuncName::DPNP_FN_NANVAR_EXT][eft_DBL][eft_DBL] = {
-        eft_DBL, (void *)dpnp_nanvar_ext_c<double>};
+        eft_DBL, (void *)dpnp_nanvar_ext_c<double, double>};
 
     fmap[DPNPFuncName::DPNP_FN_STD][eft_INT][eft_INT] = {
         eft_DBL, (void *)dpnp_std_default_c<int32_t, double>};
@@ -33,29 +33,69 @@
 #define BACKEND_FPTR_H
 
 #include <complex>
-#include <map>
 
 #include <CL/sycl.hpp>
 
 #include <dpnp_iface_fptr.hpp>
 
+/**
+ * Array indexed by the values of enumeration @ref _Key.
+ *
+ * Unlike std::map the lookup is an offset computation. Entries not assigned
+ * keep the default value.
+ */
+template <typename _Key, typename _Value, size_t _Size>
+class dpnp_enum_table
+{
+public:
+    static constexpr size_t size = _Size;
+
+    static bool contains(_Key key)
+    {
+        return static_cast<size_t>(key) < _Size;
+    }
+
+    _Value &operator[](_Key key)
+    {
+        return data[static_cast<size_t>(key)];
+    }
+
+    const _Value &operator[](_Key key) const
+    {
+        return data[static_cast<size_t>(key)];
+    }
+
+private:
+    _Value data[_Size];
+};
+
+/**
+ * Number of values of enum DPNPFuncType
+ */
+constexpr size_t DPNP_FT_COUNT =
+    static_cast<size_t>(DPNPFuncType::DPNP_FT_CMPLX128) + 1;
+
 /**
  * Data storage type of the FPTR interface
  *
- * map[FunctionName][InputType2][InputType2]
+ * map[FunctionName][InputType1][InputType2]
  *
  * Function name is enum DPNPFuncName
  * InputTypes are presented as enum DPNPFuncType
  *
- * contains structure with kernel information
+ * contains structure with kernel information, not registered combinations
+ * have nullptr in DPNPFuncData_t::ptr
  *
  * if the kernel requires only one input type - use same type for both
  * parameters
  *
  */
-typedef std::map<DPNPFuncType, DPNPFuncData_t> map_2p_t;
-typedef std::map<DPNPFuncType, map_2p_t> map_1p_t;
-typedef std::map<DPNPFuncName, map_1p_t> func_map_t;
+typedef dpnp_enum_table<DPNPFuncType, DPNPFuncData_t, DPNP_FT_COUNT> map_2p_t;
+typedef dpnp_enum_table<DPNPFuncType, map_2p_t, DPNP_FT_COUNT> map_1p_t;
+typedef dpnp_enum_table<DPNPFuncName,
+                        map_1p_t,
+                        static_cast<size_t>(DPNPFuncName::DPNP_FN_LAST)>
+    func_map_t;
 
 /**
  * Internal shortcuts for Data type enum values
@@ -155,6 +195,30 @@ static auto dpnp_vec_cast(const sycl::vec<srcT, N> &s)
         s, Indices{});
 }
 
+/**
+ * @brief Per element selection between two SYCL vectors.
+ *
+ * @tparam T A type of the vector elements.
+ * @tparam maskT A type of the mask elements, nonzero selects @ref a.
+ * @tparam N A number of elements with the vector.
+ * @param mask A mask vector.
+ * @param a Elements selected by nonzero mask elements.
+ * @param b Elements selected by zero mask elements.
+ * @return SYCL vector of selected elements.
+ */
+template <typename T, typename maskT, int N>
+static sycl::vec<T, N> dpnp_vec_select(const sycl::vec<maskT, N> &mask,
+                                       const sycl::vec<T, N> &a,
+                                       const sycl::vec<T, N> &b)
+{
+    sycl::vec<T, N> res;
+    for (int k = 0; k < N; ++k) {
+        res[k] = mask[k] ? a[k] : b[k];
+    }
+
+    return res;
+}
+
 /**
  * Removes parentheses for a passed list of types separated by comma.
  * It's intended to be used in operations macro.
@@ -260,6 +324,39 @@ public:
     }
 };
 
+/**
+ * Per element erf operation, integer elements are computed in float.
+ */
+template <typename T>
+constexpr T dispatch_erf_op(T elem)
+{
+    if constexpr (is_any_v<T, std::int32_t, std::int64_t>) {
+        // TODO: need to convert to double when possible
+        return sycl::erf((float)elem);
+    }
+    else {
+        return sycl::erf(elem);
+    }
+}
+
+/**
+ * Per element sign operation, there is no sycl::sign for integer types.
+ */
+template <typename T>
+constexpr T dispatch_sign_op(T elem)
+{
+    if constexpr (is_any_v<T, std::int32_t, std::int64_t>) {
+        if (elem > 0)
+            return T(1);
+        if (elem < 0)
+            return T(-1);
+        return elem; // elem is 0
+    }
+    else {
+        return sycl::sign(elem);
+    }
+}
+
 /**
  * FPTR interface initialization functions
  */
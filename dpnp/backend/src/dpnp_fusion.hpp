@@ -0,0 +1,382 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+/*
+ * This header file contains expression templates which fuse chains of
+ * elementwise operations into a single SYCL kernel.
+ */
+
+#pragma once
+#ifndef BACKEND_FUSION_H // Cython compatibility
+#define BACKEND_FUSION_H
+
+#include <type_traits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "dpnp_fptr.hpp"
+#include "queue_sycl.hpp"
+
+/**
+ * @defgroup BACKEND_FUSION Fusion of elementwise operations
+ * @{
+ * Expressions over arrays are built with the operations listed in
+ * dpnp_gen_1arg_1type_tbl.hpp, dpnp_gen_1arg_2type_tbl.hpp and
+ * dpnp_gen_2arg_3type_tbl.hpp, the same per element operations as used by
+ * the corresponding backend functions. Every operation of the tables is a
+ * function with the same name in namespace @ref dpnp_fusion, `+`, `-`, `*`
+ * and `/` are available as operators.
+ *
+ * @ref dpnp_fusion::evaluate computes any number of expressions over
+ * contiguous arrays of the same size in one kernel with a single pass over
+ * memory and without temporary arrays:
+ *
+ * @code
+ * using namespace dpnp_fusion;
+ *
+ * const auto a = dpnp_log_c(input(price) / input(strike));
+ * sycl::event event = evaluate(q, size, dep_events,
+ *                              assign(x, a + 0.5), assign(y, a * 2.0));
+ * @endcode
+ *
+ * Expressions are values, a subexpression used more than once is a copy of
+ * the same expression. The compiler eliminates repeated computation of such
+ * copies after inlining as operations are free of side effects.
+ * @}
+ */
+
+namespace dpnp_fusion
+{
+/**
+ * @ingroup BACKEND_FUSION
+ * @brief Base of all expressions.
+ */
+struct expr_base
+{
+};
+
+template <typename _Type>
+constexpr bool is_expr_v = std::is_base_of_v<expr_base, _Type>;
+
+/**
+ * @ingroup BACKEND_FUSION
+ * @brief Expression reading elements of a contiguous array.
+ */
+template <typename _DataType>
+struct input_expr : public expr_base
+{
+    using value_type = _DataType;
+
+    const _DataType *data;
+
+    inline value_type operator()(const size_t i) const
+    {
+        return data[i];
+    }
+};
+
+/**
+ * @ingroup BACKEND_FUSION
+ * @brief Expression with the same value for every element.
+ */
+template <typename _DataType>
+struct scalar_expr : public expr_base
+{
+    using value_type = _DataType;
+
+    _DataType value;
+
+    inline value_type operator()(const size_t) const
+    {
+        return value;
+    }
+};
+
+/**
+ * @ingroup BACKEND_FUSION
+ * @brief Expression applying operation @ref _Op to an expression.
+ *
+ * Element of the argument is converted to the result type before the
+ * operation, as the backend kernels do.
+ */
+template <typename _Op, typename _Expr>
+struct unary_expr : public expr_base
+{
+    using value_type =
+        typename _Op::template result_type<typename _Expr::value_type>;
+
+    _Expr expr;
+
+    inline value_type operator()(const size_t i) const
+    {
+        return _Op::template apply<value_type>(expr(i));
+    }
+};
+
+/**
+ * @ingroup BACKEND_FUSION
+ * @brief Expression applying operation @ref _Op to two expressions.
+ *
+ * Elements of the arguments are converted to the result type before the
+ * operation, as the backend kernels do.
+ */
+template <typename _Op, typename _Expr1, typename _Expr2>
+struct binary_expr : public expr_base
+{
+    using value_type =
+        typename _Op::template result_type<typename _Expr1::value_type,
+                                           typename _Expr2::value_type>;
+
+    _Expr1 expr1;
+    _Expr2 expr2;
+
+    inline value_type operator()(const size_t i) const
+    {
+        return _Op::template apply<value_type>(expr1(i), expr2(i));
+    }
+};
+
+/**
+ * @ingroup BACKEND_FUSION
+ * @brief Expression reading elements of a contiguous array.
+ */
+template <typename _DataType>
+inline input_expr<_DataType> input(const _DataType *data)
+{
+    return {{}, data};
+}
+
+/**
+ * Arithmetic scalars are wrapped into @ref scalar_expr, expressions are
+ * passed as is.
+ */
+template <typename _Type>
+inline auto as_expr(const _Type &value)
+{
+    if constexpr (is_expr_v<_Type>) {
+        return value;
+    }
+    else {
+        static_assert(std::is_arithmetic_v<_Type>,
+                      "DPNP Error: fusion operand must be an expression or "
+                      "an arithmetic scalar");
+        return scalar_expr<_Type>{{}, value};
+    }
+}
+
+template <typename _Type>
+using as_expr_t = decltype(as_expr(std::declval<_Type>()));
+
+template <typename _Type1, typename _Type2>
+using enable_if_expr_t =
+    std::enable_if_t<is_expr_v<_Type1> || is_expr_v<_Type2>>;
+
+#define MACRO_1ARG_1TYPE_OP(__name__, __operation1__, __operation2__)          \
+    struct __name__##_op                                                       \
+    {                                                                          \
+        template <typename _DataType_input>                                    \
+        using result_type = _DataType_input;                                   \
+                                                                               \
+        template <typename _DataType>                                          \
+        static inline _DataType apply(const _DataType input_elem)              \
+        {                                                                      \
+            return __operation1__;                                             \
+        }                                                                      \
+    };                                                                         \
+                                                                               \
+    template <typename _Expr, typename = std::enable_if_t<is_expr_v<_Expr>>>   \
+    inline unary_expr<__name__##_op, _Expr> __name__(const _Expr &expr)        \
+    {                                                                          \
+        return {{}, expr};                                                     \
+    }
+
+#include <dpnp_gen_1arg_1type_tbl.hpp>
+
+#define MACRO_1ARG_2TYPES_OP(__name__, __operation1__, __operation2__)         \
+    struct __name__##_op                                                       \
+    {                                                                          \
+        template <typename _DataType_input>                                    \
+        using result_type =                                                    \
+            std::conditional_t<std::is_floating_point_v<_DataType_input>,      \
+                               _DataType_input, double>;                       \
+                                                                               \
+        template <typename _DataType_output>                                   \
+        static inline _DataType_output                                         \
+            apply(const _DataType_output input_elem)                           \
+        {                                                                      \
+            return __operation1__;                                             \
+        }                                                                      \
+    };                                                                         \
+                                                                               \
+    template <typename _Expr, typename = std::enable_if_t<is_expr_v<_Expr>>>   \
+    inline unary_expr<__name__##_op, _Expr> __name__(const _Expr &expr)        \
+    {                                                                          \
+        return {{}, expr};                                                     \
+    }
+
+#include <dpnp_gen_1arg_2type_tbl.hpp>
+
+#define MACRO_2ARG_3TYPES_OP(__name__, __operation__, __vec_operation__,       \
+                             __vec_types__, __mkl_operation__, __mkl_types__)  \
+    struct __name__##_op                                                       \
+    {                                                                          \
+        template <typename _DataType_input1, typename _DataType_input2>        \
+        using result_type =                                                    \
+            std::common_type_t<_DataType_input1, _DataType_input2>;            \
+                                                                               \
+        template <typename _DataType_output>                                   \
+        static inline _DataType_output                                         \
+            apply(const _DataType_output input1_elem,                          \
+                  const _DataType_output input2_elem)                          \
+        {                                                                      \
+            return __operation__;                                              \
+        }                                                                      \
+    };                                                                         \
+                                                                               \
+    template <typename _Type1, typename _Type2,                                \
+              typename = enable_if_expr_t<_Type1, _Type2>>                     \
+    inline binary_expr<__name__##_op, as_expr_t<_Type1>, as_expr_t<_Type2>>    \
+        __name__(const _Type1 &value1, const _Type2 &value2)                   \
+    {                                                                          \
+        return {{}, as_expr(value1), as_expr(value2)};                         \
+    }
+
+#include <dpnp_gen_2arg_3type_tbl.hpp>
+
+template <typename _Type1,
+          typename _Type2,
+          typename = enable_if_expr_t<_Type1, _Type2>>
+inline auto operator+(const _Type1 &value1, const _Type2 &value2)
+{
+    return dpnp_add_c(value1, value2);
+}
+
+template <typename _Type1,
+          typename _Type2,
+          typename = enable_if_expr_t<_Type1, _Type2>>
+inline auto operator-(const _Type1 &value1, const _Type2 &value2)
+{
+    return dpnp_subtract_c(value1, value2);
+}
+
+template <typename _Type1,
+          typename _Type2,
+          typename = enable_if_expr_t<_Type1, _Type2>>
+inline auto operator*(const _Type1 &value1, const _Type2 &value2)
+{
+    return dpnp_multiply_c(value1, value2);
+}
+
+template <typename _Type1,
+          typename _Type2,
+          typename = enable_if_expr_t<_Type1, _Type2>>
+inline auto operator/(const _Type1 &value1, const _Type2 &value2)
+{
+    return dpnp_divide_c(value1, value2);
+}
+
+template <typename _Expr, typename = std::enable_if_t<is_expr_v<_Expr>>>
+inline auto operator-(const _Expr &expr)
+{
+    return dpnp_negative_c(expr);
+}
+
+/**
+ * @ingroup BACKEND_FUSION
+ * @brief Store of an expression into a contiguous array.
+ */
+template <typename _DataType, typename _Expr>
+struct assign_expr
+{
+    _DataType *result;
+    _Expr expr;
+
+    inline void operator()(const size_t i) const
+    {
+        result[i] = expr(i);
+    }
+};
+
+/**
+ * @ingroup BACKEND_FUSION
+ * @brief Store of an expression into a contiguous array.
+ */
+template <typename _DataType, typename _Expr>
+inline assign_expr<_DataType, as_expr_t<_Expr>> assign(_DataType *result,
+                                                       const _Expr &expr)
+{
+    return {result, as_expr(expr)};
+}
+
+template <typename... _Assigns>
+class evaluate_kernel;
+
+/**
+ * @ingroup BACKEND_FUSION
+ * @brief Compute expressions over arrays of @ref size elements in one kernel.
+ *
+ * Stores are made per element in the order of @ref assigns. An array may be
+ * both read and stored as an expression reads only the element it computes.
+ *
+ * @param [in]  q           SYCL queue.
+ * @param [in]  size        Number of elements of the arrays.
+ * @param [in]  dep_events  Events the kernel depends on.
+ * @param [in]  assigns     Stores made with @ref assign.
+ *
+ * @return Event of the kernel.
+ */
+template <typename... _Assigns>
+sycl::event evaluate(sycl::queue &q,
+                     const size_t size,
+                     const std::vector<sycl::event> &dep_events,
+                     const _Assigns &...assigns)
+{
+    auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {
+        const size_t i = global_id[0]; /* for (size_t i = 0; i < size; ++i) */
+        (assigns(i), ...);
+    };
+    auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
+        cgh.parallel_for<class evaluate_kernel<_Assigns...>>(
+            sycl::range<1>(size), kernel_parallel_for_func);
+    };
+
+    return q.submit(kernel_func);
+}
+
+/**
+ * @ingroup BACKEND_FUSION
+ * @brief Compute expressions over arrays of @ref size elements in one kernel
+ * on the default queue and wait for the result.
+ */
+template <typename... _Assigns>
+void evaluate(const size_t size, const _Assigns &...assigns)
+{
+    evaluate(DPNP_QUEUE, size, {}, assigns...).wait();
+}
+} // namespace dpnp_fusion
+
+#endif // BACKEND_FUSION_H
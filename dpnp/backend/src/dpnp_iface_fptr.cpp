@@ -33,14 +33,126 @@
  * which are used in the interface
  */
 
+#include <atomic>
 #include <cstring>
+#include <mutex>
 #include <stdexcept>
 
 #include "dpnp_fptr.hpp"
 
-static func_map_t func_map_init();
+static bool is_registered(const map_1p_t &type1_map);
 
-func_map_t func_map = func_map_init();
+typedef void (*func_map_init_t)(func_map_t &fmap);
+
+/**
+ * Kernel families in the order of registration. The most used families go
+ * first because a lookup registers families one by one until the function
+ * is found.
+ */
+static const func_map_init_t func_map_families[] = {
+    func_map_init_elemwise,      func_map_init_mathematical,
+    func_map_init_reduction,     func_map_init_arraycreation,
+    func_map_init_logic,         func_map_init_bitwise,
+    func_map_init_manipulation,  func_map_init_statistics,
+    func_map_init_searching,     func_map_init_sorting,
+    func_map_init_indexing_func, func_map_init_linalg,
+    func_map_init_linalg_func,   func_map_init_random,
+    func_map_init_fft_func};
+
+static constexpr size_t func_map_families_count =
+    sizeof(func_map_families) / sizeof(func_map_families[0]);
+
+/**
+ * Storage filled lazily by kernel families.
+ *
+ * Each DPNPFuncName is registered by one family. A name is marked ready when
+ * the family registering it is done, so ready entries of the table are
+ * read without lock.
+ */
+class func_map_registry
+{
+public:
+    func_map_registry()
+    {
+        for (std::atomic<bool> &flag : ready) {
+            flag.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    const func_map_t &get_table(DPNPFuncName func_name)
+    {
+        const size_t idx = static_cast<size_t>(func_name);
+        if (!ready[idx].load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (!ready[idx].load(std::memory_order_relaxed) &&
+                   (families_done < func_map_families_count))
+            {
+                register_family(func_map_families[families_done++]);
+            }
+        }
+
+        return table;
+    }
+
+    const func_map_t &get_table_all()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        while (families_done < func_map_families_count) {
+            register_family(func_map_families[families_done++]);
+        }
+
+        return table;
+    }
+
+private:
+    void register_family(func_map_init_t family)
+    {
+        family(table);
+
+        for (size_t i = 0; i < func_map_t::size; ++i) {
+            if (!ready[i].load(std::memory_order_relaxed) &&
+                is_registered(table[static_cast<DPNPFuncName>(i)]))
+            {
+                ready[i].store(true, std::memory_order_release);
+            }
+        }
+    }
+
+    func_map_t table;
+    std::atomic<bool> ready[func_map_t::size];
+    size_t families_done = 0;
+    std::mutex mutex;
+};
+
+static func_map_registry &get_func_map_registry()
+{
+    // The registry is intentionally leaked to avoid dependency on the order of
+    // global objects destruction at program exit.
+    static func_map_registry *registry = new func_map_registry();
+    return *registry;
+}
+
+static bool is_registered(const map_2p_t &type2_map)
+{
+    for (size_t i = 0; i < map_2p_t::size; ++i) {
+        if (type2_map[static_cast<DPNPFuncType>(i)].ptr != nullptr) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool is_registered(const map_1p_t &type1_map)
+{
+    for (size_t i = 0; i < map_1p_t::size; ++i) {
+        if (is_registered(type1_map[static_cast<DPNPFuncType>(i)])) {
+            return true;
+        }
+    }
+
+    return false;
+}
 
 DPNPFuncData_t get_dpnp_function_ptr(DPNPFuncName func_name,
                                      DPNPFuncType first_type,
@@ -49,31 +161,40 @@ DPNPFuncData_t get_dpnp_function_ptr(DPNPFuncName func_name,
     DPNPFuncType local_second_type =
         (second_type == DPNPFuncType::DPNP_FT_NONE) ? first_type : second_type;
 
-    func_map_t::const_iterator func_it = func_map.find(func_name);
-    if (func_it == func_map.cend()) {
+    if (!func_map_t::contains(func_name)) {
         throw std::runtime_error(
             "DPNP Error: Unsupported function call."); // TODO print Function ID
     }
 
-    const map_1p_t &type1_map = func_it->second;
-    map_1p_t::const_iterator type1_map_it = type1_map.find(first_type);
-    if (type1_map_it == type1_map.cend()) {
-        throw std::runtime_error("DPNP Error: Function ID with unsupported "
-                                 "first parameter type."); // TODO print
-                                                           // Function ID
+    const func_map_t &func_map = get_func_map_registry().get_table(func_name);
+
+    if (map_1p_t::contains(first_type) && map_2p_t::contains(local_second_type))
+    {
+        const DPNPFuncData_t &func_info =
+            func_map[func_name][first_type][local_second_type];
+        if (func_info.ptr != nullptr) {
+            return func_info;
+        }
     }
 
-    const map_2p_t &type2_map = type1_map_it->second;
-    map_2p_t::const_iterator type2_map_it = type2_map.find(local_second_type);
-    if (type2_map_it == type2_map.cend()) {
-        throw std::runtime_error("DPNP Error: Function ID with unsupported "
-                                 "second parameter type."); // TODO print
-                                                            // Function ID
+    // slow path only to report which parameter is not supported
+    if (!is_registered(func_map[func_name])) {
+        throw std::runtime_error(
+            "DPNP Error: Unsupported function call."); // TODO print Function ID
     }
 
-    DPNPFuncData_t func_info = type2_map_it->second;
+    const map_1p_t &type1_map = func_map[func_name];
+    if (!map_1p_t::contains(first_type) ||
+        !is_registered(type1_map[first_type]))
+    {
+        throw std::runtime_error("DPNP Error: Function ID with unsupported "
+                                 "first parameter type."); // TODO print
+                                                           // Function ID
+    }
 
-    return func_info;
+    throw std::runtime_error("DPNP Error: Function ID with unsupported "
+                             "second parameter type."); // TODO print
+                                                        // Function ID
 }
 
 template <typename _DataType_output,
@@ -162,25 +283,16 @@ void *get_dpnp_function_ptr1(DPNPFuncType &result_type,
     return result.ptr;
 }
 
-static func_map_t func_map_init()
+size_t dpnp_func_map_register_all_c()
 {
-    func_map_t fmap;
-
-    func_map_init_arraycreation(fmap);
-    func_map_init_bitwise(fmap);
-    func_map_init_elemwise(fmap);
-    func_map_init_fft_func(fmap);
-    func_map_init_indexing_func(fmap);
-    func_map_init_linalg(fmap);
-    func_map_init_linalg_func(fmap);
-    func_map_init_logic(fmap);
-    func_map_init_manipulation(fmap);
-    func_map_init_mathematical(fmap);
-    func_map_init_random(fmap);
-    func_map_init_reduction(fmap);
-    func_map_init_searching(fmap);
-    func_map_init_sorting(fmap);
-    func_map_init_statistics(fmap);
-
-    return fmap;
-};
+    const func_map_t &func_map = get_func_map_registry().get_table_all();
+
+    size_t count = 0;
+    for (size_t i = 0; i < func_map_t::size; ++i) {
+        if (is_registered(func_map[static_cast<DPNPFuncName>(i)])) {
+            ++count;
+        }
+    }
+
+    return count;
+}
@@ -29,12 +29,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <numeric>
 #include <vector>
 
 #include <dpnp_utils.hpp>
+#include <graph_sycl.hpp>
 
 /**
  * @ingroup BACKEND_UTILS
@@ -316,10 +318,7 @@ public:
             broadcast_use = true;
 
             output_shape_size = __shape.size();
-            const size_type output_shape_size_in_bytes =
-                output_shape_size * sizeof(size_type);
-            output_shape = reinterpret_cast<size_type *>(
-                dpnp_memory_alloc_c(queue_ref, output_shape_size_in_bytes));
+            output_shape = metadata_alloc(output_shape_size);
 
             for (int irit = input_shape_size - 1, orit = output_shape_size - 1;
                  orit >= 0; --irit, --orit)
@@ -334,18 +333,14 @@ public:
             }
 
             broadcast_axes_size = valid_axes.size();
-            const size_type broadcast_axes_size_in_bytes =
-                broadcast_axes_size * sizeof(size_type);
-            broadcast_axes = reinterpret_cast<size_type *>(
-                dpnp_memory_alloc_c(queue_ref, broadcast_axes_size_in_bytes));
+            broadcast_axes = metadata_alloc(broadcast_axes_size);
             std::copy(valid_axes.begin(), valid_axes.end(), broadcast_axes);
 
             output_size =
                 std::accumulate(output_shape, output_shape + output_shape_size,
                                 size_type(1), std::multiplies<size_type>());
 
-            output_shape_strides = reinterpret_cast<size_type *>(
-                dpnp_memory_alloc_c(queue_ref, output_shape_size_in_bytes));
+            output_shape_strides = metadata_alloc(output_shape_size);
             get_shape_offsets_inkernel<size_type>(
                 output_shape, output_shape_size, output_shape_strides);
 
@@ -413,16 +408,10 @@ public:
             axis_use = true;
 
             output_shape_size = input_shape_size - axes.size();
-            const size_type output_shape_size_in_bytes =
-                output_shape_size * sizeof(size_type);
-
             iteration_shape_size = axes.size();
-            const size_type iteration_shape_size_in_bytes =
-                iteration_shape_size * sizeof(size_type);
             std::vector<size_type> iteration_shape;
 
-            output_shape = reinterpret_cast<size_type *>(
-                dpnp_memory_alloc_c(queue_ref, output_shape_size_in_bytes));
+            output_shape = metadata_alloc(output_shape_size);
             size_type *output_shape_it = output_shape;
             for (size_type i = 0; i < input_shape_size; ++i) {
                 if (std::find(axes.begin(), axes.end(), i) == axes.end()) {
@@ -435,8 +424,7 @@ public:
                 std::accumulate(output_shape, output_shape + output_shape_size,
                                 size_type(1), std::multiplies<size_type>());
 
-            output_shape_strides = reinterpret_cast<size_type *>(
-                dpnp_memory_alloc_c(queue_ref, output_shape_size_in_bytes));
+            output_shape_strides = metadata_alloc(output_shape_size);
             get_shape_offsets_inkernel<size_type>(
                 output_shape, output_shape_size, output_shape_strides);
 
@@ -448,14 +436,12 @@ public:
                 iteration_size *= axis_dim;
             }
 
-            iteration_shape_strides = reinterpret_cast<size_type *>(
-                dpnp_memory_alloc_c(queue_ref, iteration_shape_size_in_bytes));
+            iteration_shape_strides = metadata_alloc(iteration_shape_size);
             get_shape_offsets_inkernel<size_type>(iteration_shape.data(),
                                                   iteration_shape.size(),
                                                   iteration_shape_strides);
 
-            axes_shape_strides = reinterpret_cast<size_type *>(
-                dpnp_memory_alloc_c(queue_ref, iteration_shape_size_in_bytes));
+            axes_shape_strides = metadata_alloc(iteration_shape_size);
             for (size_t i = 0; i < static_cast<size_t>(iteration_shape_size);
                  ++i) {
                 axes_shape_strides[i] = input_shape_strides[axes[i]];
@@ -519,13 +505,10 @@ private:
             }
 
             input_shape_size = __shape.size();
-            input_shape = reinterpret_cast<size_type *>(dpnp_memory_alloc_c(
-                queue_ref, input_shape_size * sizeof(size_type)));
+            input_shape = metadata_alloc(input_shape_size);
             std::copy(__shape.begin(), __shape.end(), input_shape);
 
-            input_shape_strides =
-                reinterpret_cast<size_type *>(dpnp_memory_alloc_c(
-                    queue_ref, input_shape_size * sizeof(size_type)));
+            input_shape_strides = metadata_alloc(input_shape_size);
             get_shape_offsets_inkernel<size_type>(input_shape, input_shape_size,
                                                   input_shape_strides);
         }
@@ -560,18 +543,64 @@ private:
             }
 
             input_shape_size = __shape.size();
-            input_shape = reinterpret_cast<size_type *>(dpnp_memory_alloc_c(
-                queue_ref, input_shape_size * sizeof(size_type)));
+            input_shape = metadata_alloc(input_shape_size);
             std::copy(__shape.begin(), __shape.end(), input_shape);
 
-            input_shape_strides =
-                reinterpret_cast<size_type *>(dpnp_memory_alloc_c(
-                    queue_ref, input_shape_size * sizeof(size_type)));
+            input_shape_strides = metadata_alloc(input_shape_size);
             std::copy(__strides.begin(), __strides.end(), input_shape_strides);
         }
         iteration_size = input_size;
     }
 
+    /**
+     * @ingroup BACKEND_UTILS
+     * @brief Get memory for shape metadata.
+     *
+     * All shape, strides and axes arrays of the object are carved out of a
+     * single USM block allocated on first use. The block is sized for arrays
+     * of up to @ref DPNP_KERNEL_ARG_MAX_NDIM dimensions (or the requested
+     * size if it is bigger), so typical reduction and broadcasting setups cost
+     * one allocation instead of one per array. Requests which do not fit
+     * into the block get a dedicated allocation.
+     *
+     * @note this function is designed for non-SYCL environment execution
+     *
+     * @param [in]  count  Number of elements requested.
+     *
+     * @return Pointer to memory for @ref count elements of @ref size_type.
+     */
+    size_type *metadata_alloc(const size_type count)
+    {
+        if (metadata == nullptr) {
+            // input shape and strides, output shape and strides, iteration
+            // and axes strides or broadcast axes
+            metadata_capacity =
+                6 * std::max(count, size_type(DPNP_KERNEL_ARG_MAX_NDIM));
+            metadata = reinterpret_cast<size_type *>(dpnp_memory_alloc_c(
+                queue_ref, metadata_capacity * sizeof(size_type)));
+        }
+
+        if (metadata_used + count <= metadata_capacity) {
+            size_type *result = metadata + metadata_used;
+            metadata_used += count;
+            return result;
+        }
+
+        return reinterpret_cast<size_type *>(
+            dpnp_memory_alloc_c(queue_ref, count * sizeof(size_type)));
+    }
+
+    /// release memory returned by @ref metadata_alloc
+    void metadata_free(size_type *ptr)
+    {
+        const std::less<const size_type *> less;
+        if ((ptr != nullptr) &&
+            (less(ptr, metadata) || !less(ptr, metadata + metadata_capacity)))
+        {
+            dpnp_memory_free_c(queue_ref, ptr);
+        }
+    }
+
     /// this function is designed for SYCL environment execution
     size_type get_input_begin_offset(size_type output_global_id) const
     {
@@ -624,14 +653,14 @@ private:
     void free_axes_memory()
     {
         axes.clear();
-        dpnp_memory_free_c(queue_ref, axes_shape_strides);
+        metadata_free(axes_shape_strides);
         axes_shape_strides = nullptr;
     }
 
     void free_broadcast_axes_memory()
     {
         broadcast_axes_size = size_type{};
-        dpnp_memory_free_c(queue_ref, broadcast_axes);
+        metadata_free(broadcast_axes);
         broadcast_axes = nullptr;
     }
 
@@ -639,8 +668,8 @@ private:
     {
         input_size = size_type{};
         input_shape_size = size_type{};
-        dpnp_memory_free_c(queue_ref, input_shape);
-        dpnp_memory_free_c(queue_ref, input_shape_strides);
+        metadata_free(input_shape);
+        metadata_free(input_shape_strides);
         input_shape = nullptr;
         input_shape_strides = nullptr;
     }
@@ -649,7 +678,7 @@ private:
     {
         iteration_size = size_type{};
         iteration_shape_size = size_type{};
-        dpnp_memory_free_c(queue_ref, iteration_shape_strides);
+        metadata_free(iteration_shape_strides);
         iteration_shape_strides = nullptr;
     }
 
@@ -657,8 +686,8 @@ private:
     {
         output_size = size_type{};
         output_shape_size = size_type{};
-        dpnp_memory_free_c(queue_ref, output_shape);
-        dpnp_memory_free_c(queue_ref, output_shape_strides);
+        metadata_free(output_shape);
+        metadata_free(output_shape_strides);
         output_shape = nullptr;
         output_shape_strides = nullptr;
     }
@@ -670,6 +699,11 @@ private:
         free_input_memory();
         free_iteration_memory();
         free_output_memory();
+
+        dpnp_memory_free_c(queue_ref, metadata);
+        metadata = nullptr;
+        metadata_capacity = size_type{};
+        metadata_used = size_type{};
     }
 
     DPCTLSyclQueueRef queue_ref = nullptr; /**< reference to SYCL queue */
@@ -701,6 +735,50 @@ private:
     size_type iteration_shape_size = size_type{};
     size_type *iteration_shape_strides = nullptr;
     size_type *axes_shape_strides = nullptr;
+
+    size_type *metadata = nullptr; /**< USM block for all shape metadata */
+    size_type metadata_capacity =
+        size_type{}; /**< size of the metadata block in elements */
+    size_type metadata_used =
+        size_type{}; /**< elements of the metadata block handed out */
 };
 
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Destroy USM allocated @ref DPNPC_id objects after the kernels using
+ * them are done.
+ *
+ * The iterators must be constructed by placement new in memory returned by
+ * @ref dpnp_memory_alloc_c. Their destruction is not recorded into a command
+ * graph because a replay would release them again.
+ *
+ * @param [in]  q_ref  DPCtl reference to the queue the iterators belong to.
+ * @param [in]  deps   Events of the kernels using the iterators.
+ * @param [in]  its    Iterators to destroy.
+ *
+ * @return Event of the release.
+ *
+ * @exception std::runtime_error  Queue is capturing a command graph.
+ */
+template <typename... _Tps>
+sycl::event dpnp_iterators_free_async(DPCTLSyclQueueRef q_ref,
+                                      const std::vector<sycl::event> &deps,
+                                      DPNPC_id<_Tps> *...its)
+{
+    sycl::queue &q = *(reinterpret_cast<sycl::queue *>(q_ref));
+
+    if (DPNPC_command_graph::get_capturing(q)) {
+        throw std::runtime_error(
+            "DPNP Error: broadcasting iterators can't be captured");
+    }
+
+    return q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(deps);
+        cgh.host_task([=]() {
+            ((its->~DPNPC_id(), dpnp_memory_free_c(q_ref, its)), ...);
+        });
+    });
+}
+
 #endif // DPNP_ITERATOR_H
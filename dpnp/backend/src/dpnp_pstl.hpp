@@ -49,6 +49,7 @@
 #pragma clang diagnostic ignored "-Wunused-variable"
 
 #include <oneapi/dpl/algorithm>
+#include <oneapi/dpl/async>
 #include <oneapi/dpl/execution>
 #include <oneapi/dpl/numeric>
 
@@ -0,0 +1,755 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#pragma once
+#ifndef DPNP_REDUCTION_H // Cython compatibility
+#define DPNP_REDUCTION_H
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "dpnp_iterator.hpp"
+#include "dpnp_utils.hpp"
+#include "memory_pool_sycl.hpp"
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Iteration spaces of a reduction of a C-contiguous array over axes.
+ *
+ * Kept axes form the output space with the result (operand 0) and the input
+ * (operand 1) strides, reduced axes form the reduced space with the input
+ * strides. Both are collapsed by @ref dpnp_normalize_strides.
+ *
+ * The result is C-contiguous over the kept axes. It is also the layout of
+ * the result with the reduced dimensions kept (keepdims), as those have
+ * size 1.
+ */
+struct dpnp_reduction_space
+{
+    dpnp_strided_space<2> output;  /**< result and input over kept axes */
+    dpnp_strided_space<1> reduced; /**< input over reduced axes */
+    size_t output_size;            /**< number of result elements */
+    size_t reduced_size;           /**< number of reduced elements */
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Build iteration spaces of a reduction.
+ *
+ * @param [in]  shape  Shape of the C-contiguous input.
+ * @param [in]  ndim   Number of dimensions of the input.
+ * @param [in]  axes   Reduced axes, negative ones count from the end.
+ * @param [in]  naxes  Number of reduced axes, all axes are reduced if 0.
+ * @param [out] space  Iteration spaces.
+ *
+ * @return false if a collapsed space has more than
+ *         @ref DPNP_KERNEL_ARG_MAX_NDIM dimensions, @ref space is undefined
+ *         then.
+ *
+ * @exception std::range_error  an axis is out of range or duplicated.
+ */
+static inline bool dpnp_make_reduction_space(const shape_elem_type *shape,
+                                             const size_t ndim,
+                                             const shape_elem_type *axes,
+                                             const size_t naxes,
+                                             dpnp_reduction_space &space)
+{
+    std::vector<bool> is_reduced(ndim, naxes == 0);
+    for (const shape_elem_type axis : get_validated_axes(
+             std::vector<shape_elem_type>(axes, axes + naxes), ndim))
+    {
+        is_reduced[axis] = true;
+    }
+
+    std::vector<shape_elem_type> input_strides(ndim);
+    get_shape_offsets_inkernel(shape, ndim, input_strides.data());
+
+    std::vector<shape_elem_type> output_shape;
+    std::vector<shape_elem_type> output_input_strides;
+    std::vector<shape_elem_type> reduced_shape;
+    std::vector<shape_elem_type> reduced_input_strides;
+    space.output_size = 1;
+    space.reduced_size = 1;
+    for (size_t i = 0; i < ndim; ++i) {
+        if (is_reduced[i]) {
+            reduced_shape.push_back(shape[i]);
+            reduced_input_strides.push_back(input_strides[i]);
+            space.reduced_size *= shape[i];
+        }
+        else {
+            output_shape.push_back(shape[i]);
+            output_input_strides.push_back(input_strides[i]);
+            space.output_size *= shape[i];
+        }
+    }
+
+    std::vector<shape_elem_type> output_result_strides(output_shape.size());
+    get_shape_offsets_inkernel(output_shape.data(), output_shape.size(),
+                               output_result_strides.data());
+
+    const shape_elem_type *const output_strides[2] = {
+        output_result_strides.data(), output_input_strides.data()};
+    const shape_elem_type *const reduced_strides[1] = {
+        reduced_input_strides.data()};
+
+    return dpnp_normalize_strides(output_shape.size(), output_shape.data(),
+                                  output_strides, space.output) &&
+           dpnp_normalize_strides(reduced_shape.size(), reduced_shape.data(),
+                                  reduced_strides, space.reduced);
+}
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Maximum of two values propagating NaN, as numpy.maximum.
+ */
+template <typename _DataType>
+struct dpnp_maximum
+{
+    /// identity element, -inf for floating types
+    static constexpr _DataType identity()
+    {
+        if constexpr (std::numeric_limits<_DataType>::has_infinity) {
+            return -std::numeric_limits<_DataType>::infinity();
+        }
+        else {
+            return std::numeric_limits<_DataType>::lowest();
+        }
+    }
+
+    _DataType operator()(const _DataType &x, const _DataType &y) const
+    {
+        if constexpr (std::is_floating_point_v<_DataType>) {
+            return (sycl::isnan(x) || (x > y)) ? x : y;
+        }
+        else {
+            return (x > y) ? x : y;
+        }
+    }
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Minimum of two values propagating NaN, as numpy.minimum.
+ */
+template <typename _DataType>
+struct dpnp_minimum
+{
+    /// identity element, +inf for floating types
+    static constexpr _DataType identity()
+    {
+        if constexpr (std::numeric_limits<_DataType>::has_infinity) {
+            return std::numeric_limits<_DataType>::infinity();
+        }
+        else {
+            return std::numeric_limits<_DataType>::max();
+        }
+    }
+
+    _DataType operator()(const _DataType &x, const _DataType &y) const
+    {
+        if constexpr (std::is_floating_point_v<_DataType>) {
+            return (sycl::isnan(x) || (x < y)) ? x : y;
+        }
+        else {
+            return (x < y) ? x : y;
+        }
+    }
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Maximum of two values ignoring NaN, as numpy.fmax.
+ */
+template <typename _DataType>
+struct dpnp_nan_maximum
+{
+    /// identity element, NaN for floating types
+    static constexpr _DataType identity()
+    {
+        if constexpr (std::numeric_limits<_DataType>::has_quiet_NaN) {
+            return std::numeric_limits<_DataType>::quiet_NaN();
+        }
+        else {
+            return std::numeric_limits<_DataType>::lowest();
+        }
+    }
+
+    _DataType operator()(const _DataType &x, const _DataType &y) const
+    {
+        if constexpr (std::is_floating_point_v<_DataType>) {
+            return (sycl::isnan(y) || (x > y)) ? x : y;
+        }
+        else {
+            return (x > y) ? x : y;
+        }
+    }
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Minimum of two values ignoring NaN, as numpy.fmin.
+ */
+template <typename _DataType>
+struct dpnp_nan_minimum
+{
+    /// identity element, NaN for floating types
+    static constexpr _DataType identity()
+    {
+        if constexpr (std::numeric_limits<_DataType>::has_quiet_NaN) {
+            return std::numeric_limits<_DataType>::quiet_NaN();
+        }
+        else {
+            return std::numeric_limits<_DataType>::max();
+        }
+    }
+
+    _DataType operator()(const _DataType &x, const _DataType &y) const
+    {
+        if constexpr (std::is_floating_point_v<_DataType>) {
+            return (sycl::isnan(y) || (x < y)) ? x : y;
+        }
+        else {
+            return (x < y) ? x : y;
+        }
+    }
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Value and index of a reduced element, accumulator of argmax.
+ */
+template <typename _DataType>
+struct dpnp_arg_value
+{
+    /// index of no element, the one of the identity
+    static constexpr size_t no_index = std::numeric_limits<size_t>::max();
+
+    _DataType value; /**< element value */
+    size_t index;    /**< index of the element among the reduced ones */
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Select the extremum of two indexed values, as numpy.argmax.
+ *
+ * The value preferred by @ref _Compare wins, the first index on ties. NaN
+ * wins over any number, so the first NaN is selected if any.
+ *
+ * @tparam _Compare  Strict order, std::greater for argmax, std::less for
+ *                   argmin. The identity element has the extremum value
+ *                   that order prefers least and @ref dpnp_arg_value::no_index.
+ */
+template <typename _DataType, typename _Compare>
+struct dpnp_arg_extremum
+{
+    dpnp_arg_value<_DataType>
+        operator()(const dpnp_arg_value<_DataType> &x,
+                   const dpnp_arg_value<_DataType> &y) const
+    {
+        if constexpr (std::is_floating_point_v<_DataType>) {
+            const bool x_is_nan = sycl::isnan(x.value);
+            const bool y_is_nan = sycl::isnan(y.value);
+            if (x_is_nan || y_is_nan) {
+                return (x_is_nan && (!y_is_nan || (x.index < y.index))) ? x
+                                                                         : y;
+            }
+        }
+
+        const _Compare compare;
+        if (compare(x.value, y.value)) {
+            return x;
+        }
+        if (compare(y.value, x.value)) {
+            return y;
+        }
+        return (x.index < y.index) ? x : y;
+    }
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Count, mean and sum of squared deviations from the mean of values,
+ *        accumulator of mean, var and std.
+ */
+template <typename _DataType>
+struct dpnp_moments
+{
+    size_t count;   /**< number of values */
+    _DataType mean; /**< mean of the values */
+    _DataType m2;   /**< sum of squared deviations from the mean */
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Merge moments of two sets of values.
+ *
+ * Parallel form of the Welford update by Chan et al., which keeps the
+ * accuracy of a two-pass variance in a single pass. The identity element has
+ * no values.
+ */
+template <typename _DataType>
+struct dpnp_moments_merge
+{
+    dpnp_moments<_DataType> operator()(const dpnp_moments<_DataType> &x,
+                                       const dpnp_moments<_DataType> &y) const
+    {
+        if (x.count == 0) {
+            return y;
+        }
+        if (y.count == 0) {
+            return x;
+        }
+
+        const size_t count = x.count + y.count;
+        const _DataType delta = y.mean - x.mean;
+        const _DataType y_weight =
+            static_cast<_DataType>(y.count) / static_cast<_DataType>(count);
+
+        return {count, x.mean + delta * y_weight,
+                x.m2 + y.m2 +
+                    delta * delta * static_cast<_DataType>(x.count) * y_weight};
+    }
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Convert an input element into accumulator, passing its index among
+ *        the reduced elements if @ref map takes one.
+ */
+template <typename _Map, typename _DataType_input>
+static inline auto dpnp_reduction_map(const _Map &map,
+                                      const _DataType_input &x,
+                                      const size_t index)
+{
+    if constexpr (std::is_invocable_v<_Map, _DataType_input, size_t>) {
+        return map(x, index);
+    }
+    else {
+        return map(x);
+    }
+}
+
+template <typename _KernelNameSpecialization1,
+          typename _KernelNameSpecialization2>
+class dpnp_reduction_kernel;
+
+class dpnp_reduction_seq_tag;
+class dpnp_reduction_group_tag;
+class dpnp_reduction_partials_tag;
+class dpnp_reduction_iterator_tag;
+
+/// Reduced elements per work item a work-group is split by at least
+constexpr size_t dpnp_reduction_min_items_per_work_item = 4;
+/// Reductions of that many elements or less are done per work item
+constexpr size_t dpnp_reduction_seq_max_reduced_size = 32;
+/// Strided reductions with that many outputs or more are done per work item
+constexpr size_t dpnp_reduction_seq_min_output_size = 4096;
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Submit a kernel reducing input elements by work-groups.
+ *
+ * Each output is split between @ref groups_per_output work-groups of
+ * @ref lws work items. Work items accumulate strided elements, then the
+ * work-group combines them in local memory. If @ref partials is set, the
+ * accumulator of each work-group is stored into it at
+ * output * groups_per_output + group, otherwise the finalized value is stored
+ * into @ref result.
+ */
+template <typename _KernelName,
+          typename _DataType_output,
+          typename _DataType_input,
+          typename _Accumulator,
+          typename _Map,
+          typename _BinaryOp,
+          typename _Finalize>
+static sycl::event
+    dpnp_reduction_group_submit(sycl::queue &q,
+                                _DataType_output *result,
+                                _Accumulator *partials,
+                                const _DataType_input *input,
+                                const dpnp_reduction_space &space,
+                                const size_t lws,
+                                const size_t groups_per_output,
+                                const _Accumulator identity,
+                                const _Map map,
+                                const _BinaryOp op,
+                                const _Finalize finalize,
+                                const std::vector<sycl::event> &dep_events)
+{
+    const dpnp_strided_space<2> output = space.output;
+    const dpnp_strided_space<1> reduced = space.reduced;
+    const size_t reduced_size = space.reduced_size;
+    const size_t reduction_step = groups_per_output * lws;
+
+    auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
+
+        sycl::local_accessor<_Accumulator, 1> local_acc(sycl::range<1>(lws),
+                                                        cgh);
+
+        auto kernel_parallel_for_func = [=](sycl::nd_item<1> nd_it) {
+            const size_t group_id = nd_it.get_group(0);
+            const size_t output_id = group_id / groups_per_output;
+            const size_t part = group_id - output_id * groups_per_output;
+            const size_t local_id = nd_it.get_local_id(0);
+
+            shape_elem_type output_offsets[2];
+            output.get_offsets(output_id, output_offsets);
+
+            _Accumulator acc = identity;
+            for (size_t r = part * lws + local_id; r < reduced_size;
+                 r += reduction_step)
+            {
+                shape_elem_type reduced_offsets[1];
+                reduced.get_offsets(r, reduced_offsets);
+                acc = op(acc, dpnp_reduction_map(
+                                  map,
+                                  input[output_offsets[1] + reduced_offsets[0]],
+                                  r));
+            }
+            local_acc[local_id] = acc;
+
+            // tree reduction in local memory, lws is a power of 2
+            for (size_t s = lws / 2; s > 0; s >>= 1) {
+                sycl::group_barrier(nd_it.get_group());
+                if (local_id < s) {
+                    local_acc[local_id] =
+                        op(local_acc[local_id], local_acc[local_id + s]);
+                }
+            }
+
+            if (local_id == 0) {
+                if (partials != nullptr) {
+                    partials[output_offsets[0] * groups_per_output + part] =
+                        local_acc[0];
+                }
+                else {
+                    result[output_offsets[0]] = finalize(local_acc[0]);
+                }
+            }
+        };
+
+        cgh.parallel_for<_KernelName>(
+            sycl::nd_range<1>(
+                sycl::range<1>(space.output_size * groups_per_output * lws),
+                sycl::range<1>(lws)),
+            kernel_parallel_for_func);
+    };
+
+    return q.submit(kernel_func);
+}
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Reduce a C-contiguous array over axes without a per output launch.
+ *
+ * The result element is finalize(map(x0) op map(x1) op ...) over the reduced
+ * elements x of the output, in any order and grouping, so @ref op must be
+ * associative and @ref identity must be its identity element. An initial
+ * value of the reduction is applied by @ref finalize.
+ *
+ * The strategy depends on the reduced elements:
+ * - few reduced elements, or strided ones of many outputs, are reduced by
+ *   one work item per output. Neighbouring work items read neighbouring
+ *   elements if the reduced axis is the outer one.
+ * - otherwise a work-group per output reduces the elements in local memory.
+ *   Long reductions of few outputs are split between several work-groups
+ *   to occupy the device, a second kernel reduces their partial results.
+ *
+ * @param [in]  q           SYCL queue.
+ * @param [out] result      Result array of @ref space.output_size elements.
+ * @param [in]  input       Input array.
+ * @param [in]  space       Iteration spaces, see
+ *                          @ref dpnp_make_reduction_space.
+ * @param [in]  identity    Identity element of @ref op.
+ * @param [in]  map         Converts an input element into accumulator, it
+ *                          may take the index of the element among the
+ *                          reduced ones in C order as second argument. The
+ *                          element is passed by reference into @ref input.
+ * @param [in]  op          Associative binary operation on accumulators.
+ * @param [in]  finalize    Converts an accumulator into a result element.
+ * @param [in]  dep_events  Events the kernels depend on.
+ *
+ * @return Event of the last submitted kernel.
+ */
+template <typename _KernelName,
+          typename _DataType_output,
+          typename _DataType_input,
+          typename _Accumulator,
+          typename _Map,
+          typename _BinaryOp,
+          typename _Finalize>
+sycl::event dpnp_reduce(sycl::queue &q,
+                        _DataType_output *result,
+                        const _DataType_input *input,
+                        const dpnp_reduction_space &space,
+                        const _Accumulator identity,
+                        const _Map map,
+                        const _BinaryOp op,
+                        const _Finalize finalize,
+                        const std::vector<sycl::event> &dep_events)
+{
+    const size_t output_size = space.output_size;
+    const size_t reduced_size = space.reduced_size;
+
+    if (output_size == 0) {
+        return q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(dep_events);
+            cgh.single_task<dpnp_reduction_kernel<_KernelName, void>>([] {});
+        });
+    }
+
+    const dpnp_strided_space<1> &reduced = space.reduced;
+    const bool is_reduced_contiguous =
+        (reduced.strides[0][reduced.ndim - 1] == 1);
+
+    if ((reduced_size <= dpnp_reduction_seq_max_reduced_size) ||
+        (!is_reduced_contiguous &&
+         (output_size >= dpnp_reduction_seq_min_output_size)))
+    {
+        const dpnp_strided_space<2> output = space.output;
+        const dpnp_strided_space<1> reduced_by_value = reduced;
+
+        // innermost reduced dimension is walked without index arithmetic
+        const size_t inner_size = reduced.shape[reduced.ndim - 1];
+        const shape_elem_type inner_stride =
+            reduced.strides[0][reduced.ndim - 1];
+        const size_t outer_size = inner_size ? reduced_size / inner_size : 0;
+
+        auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {
+            shape_elem_type output_offsets[2];
+            output.get_offsets(global_id[0], output_offsets);
+            const _DataType_input *input_data = input + output_offsets[1];
+
+            _Accumulator acc = identity;
+            for (size_t outer = 0; outer < outer_size; ++outer) {
+                shape_elem_type reduced_offsets[1];
+                reduced_by_value.get_offsets(outer * inner_size,
+                                             reduced_offsets);
+                const _DataType_input *inner_data =
+                    input_data + reduced_offsets[0];
+                for (size_t k = 0; k < inner_size; ++k) {
+                    acc = op(acc, dpnp_reduction_map(
+                                      map, inner_data[k * inner_stride],
+                                      outer * inner_size + k));
+                }
+            }
+            result[output_offsets[0]] = finalize(acc);
+        };
+
+        auto kernel_func = [&](sycl::handler &cgh) {
+            cgh.depends_on(dep_events);
+            cgh.parallel_for<
+                dpnp_reduction_kernel<_KernelName, dpnp_reduction_seq_tag>>(
+                sycl::range<1>(output_size), kernel_parallel_for_func);
+        };
+
+        return q.submit(kernel_func);
+    }
+
+    const sycl::device device = q.get_device();
+
+    // power of 2 work-group size for the tree reduction in local memory
+    const size_t max_lws = std::min<size_t>(
+        256, device.get_info<sycl::info::device::max_work_group_size>());
+    size_t lws = 1;
+    while (lws * 2 <= max_lws) {
+        lws *= 2;
+    }
+
+    // a few work-groups per compute unit, no more than the elements allow
+    const size_t target_groups =
+        4 * device.get_info<sycl::info::device::max_compute_units>();
+    const size_t max_groups_by_size =
+        (reduced_size + lws * dpnp_reduction_min_items_per_work_item - 1) /
+        (lws * dpnp_reduction_min_items_per_work_item);
+    const size_t groups_per_output = std::max<size_t>(
+        1, std::min({(target_groups + output_size - 1) / output_size,
+                     max_groups_by_size, lws}));
+
+    if (groups_per_output == 1) {
+        return dpnp_reduction_group_submit<
+            dpnp_reduction_kernel<_KernelName, dpnp_reduction_group_tag>>(
+            q, result, static_cast<_Accumulator *>(nullptr), input, space,
+            lws, 1, identity, map, op, finalize, dep_events);
+    }
+
+    _Accumulator *partials = dpnp_pool_malloc<_Accumulator>(
+        output_size * groups_per_output, q, sycl::usm::alloc::device);
+
+    sycl::event partials_event = dpnp_reduction_group_submit<
+        dpnp_reduction_kernel<_KernelName, dpnp_reduction_group_tag>>(
+        q, result, partials, input, space, lws, groups_per_output, identity,
+        map, op, finalize, dep_events);
+
+    // partials of an output are contiguous and ordered as in the input
+    dpnp_reduction_space partials_space;
+    partials_space.output.ndim = 1;
+    partials_space.output.shape[0] = output_size;
+    partials_space.output.strides[0][0] = 1;
+    partials_space.output.strides[1][0] = groups_per_output;
+    partials_space.reduced.ndim = 1;
+    partials_space.reduced.shape[0] = groups_per_output;
+    partials_space.reduced.strides[0][0] = 1;
+    partials_space.output_size = output_size;
+    partials_space.reduced_size = groups_per_output;
+
+    // at most lws partials per output, a work item each
+    sycl::event event = dpnp_reduction_group_submit<
+        dpnp_reduction_kernel<_KernelName, dpnp_reduction_partials_tag>>(
+        q, result, static_cast<_Accumulator *>(nullptr),
+        static_cast<const _Accumulator *>(partials), partials_space, lws, 1,
+        identity, [](const _Accumulator &acc) { return acc; }, op, finalize,
+        {partials_event});
+
+    dpnp_pool_free_async(q, {partials}, {event});
+
+    return event;
+}
+
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Reduce a C-contiguous array over axes by an iterator per output.
+ *
+ * Used for reductions @ref dpnp_make_reduction_space can not describe. A work
+ * item reduces the elements of one output walking them by @ref DPNPC_id.
+ * Arguments are the ones of @ref dpnp_reduce, the shape and the axes of the
+ * input replace the iteration spaces.
+ *
+ * @return Event of the release of the iterator, it follows the kernel.
+ */
+template <typename _KernelName,
+          typename _DataType_output,
+          typename _DataType_input,
+          typename _Accumulator,
+          typename _Map,
+          typename _BinaryOp,
+          typename _Finalize>
+sycl::event dpnp_reduce_by_iterator(DPCTLSyclQueueRef q_ref,
+                                    _DataType_output *result,
+                                    const _DataType_input *input,
+                                    const shape_elem_type *shape,
+                                    const size_t ndim,
+                                    const shape_elem_type *axes,
+                                    const size_t naxes,
+                                    const _Accumulator identity,
+                                    const _Map map,
+                                    const _BinaryOp op,
+                                    const _Finalize finalize,
+                                    const std::vector<sycl::event> &dep_events)
+{
+    using input_it_t = DPNPC_id<_DataType_input>;
+
+    sycl::queue &q = *(reinterpret_cast<sycl::queue *>(q_ref));
+
+    // reduced elements are walked in C order, as the index passed to the map
+    // requires
+    std::vector<shape_elem_type> sorted_axes = get_validated_axes(
+        std::vector<shape_elem_type>(axes, axes + naxes), ndim);
+    std::sort(sorted_axes.begin(), sorted_axes.end());
+
+    input_it_t *input_it = reinterpret_cast<input_it_t *>(
+        dpnp_memory_alloc_c(q_ref, sizeof(input_it_t)));
+    new (input_it) input_it_t(q_ref, const_cast<_DataType_input *>(input),
+                              shape, ndim);
+    input_it->set_axes(sorted_axes);
+
+    auto kernel_parallel_for_func = [=](sycl::id<1> global_id) {
+        const size_t output_id = global_id[0];
+
+        _Accumulator acc = identity;
+        size_t index = 0;
+        for (auto it = input_it->begin(output_id),
+                  end = input_it->end(output_id);
+             it != end; ++it, ++index)
+        {
+            acc = op(acc, dpnp_reduction_map(map, *it, index));
+        }
+        result[output_id] = finalize(acc);
+    };
+
+    auto kernel_func = [&](sycl::handler &cgh) {
+        cgh.depends_on(dep_events);
+        cgh.parallel_for<
+            dpnp_reduction_kernel<_KernelName, dpnp_reduction_iterator_tag>>(
+            sycl::range<1>(input_it->get_output_size()),
+            kernel_parallel_for_func);
+    };
+
+    sycl::event event = q.submit(kernel_func);
+
+    return dpnp_iterators_free_async(q_ref, {event}, input_it);
+}
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Reduce a C-contiguous array over axes, all axes are reduced if
+ * @ref naxes is 0.
+ *
+ * Calls @ref dpnp_reduce, or @ref dpnp_reduce_by_iterator if the collapsed
+ * iteration spaces have more than @ref DPNP_KERNEL_ARG_MAX_NDIM dimensions.
+ * Arguments are the ones of @ref dpnp_reduce_by_iterator.
+ *
+ * @return Event the result is ready by.
+ */
+template <typename _KernelName,
+          typename _DataType_output,
+          typename _DataType_input,
+          typename _Accumulator,
+          typename _Map,
+          typename _BinaryOp,
+          typename _Finalize>
+sycl::event dpnp_reduce_over_axes(DPCTLSyclQueueRef q_ref,
+                                  _DataType_output *result,
+                                  const _DataType_input *input,
+                                  const shape_elem_type *shape,
+                                  const size_t ndim,
+                                  const shape_elem_type *axes,
+                                  const size_t naxes,
+                                  const _Accumulator identity,
+                                  const _Map map,
+                                  const _BinaryOp op,
+                                  const _Finalize finalize,
+                                  const std::vector<sycl::event> &dep_events)
+{
+    dpnp_reduction_space space;
+    if (dpnp_make_reduction_space(shape, ndim, axes, naxes, space)) {
+        sycl::queue &q = *(reinterpret_cast<sycl::queue *>(q_ref));
+        return dpnp_reduce<_KernelName>(q, result, input, space, identity, map,
+                                        op, finalize, dep_events);
+    }
+
+    return dpnp_reduce_by_iterator<_KernelName>(
+        q_ref, result, input, shape, ndim, axes, naxes, identity, map, op,
+        finalize, dep_events);
+}
+
+#endif // DPNP_REDUCTION_H
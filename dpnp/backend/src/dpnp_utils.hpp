@@ -29,8 +29,12 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <iostream>
 #include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <CL/sycl.hpp>
 
@@ -68,6 +72,15 @@
 #define __INTEL_MKL_2023_VERSION_REQUIRED 20230000
 #endif
 
+/**
+ * Maximum number of dimensions for which shape and strides metadata is passed
+ * to a kernel by value. Arrays with more dimensions fall back to temporary USM
+ * buffers.
+ */
+#ifndef DPNP_KERNEL_ARG_MAX_NDIM
+#define DPNP_KERNEL_ARG_MAX_NDIM 8
+#endif
+
 /**
  * @defgroup BACKEND_UTILS Backend C++ library utilities
  * @{
@@ -417,6 +430,248 @@ err:
         "DPNP Error: validate_axes() failed with axis check");
 }
 
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Fixed size array captured by value in a kernel.
+ *
+ * Used to pass small shape/strides metadata as a kernel argument instead of
+ * allocating, filling and freeing a USM buffer per call.
+ *
+ * @tparam _DataType  Type of the elements.
+ * @tparam _Size      Capacity of the array in elements.
+ */
+template <typename _DataType, size_t _Size>
+struct dpnp_kernel_array
+{
+    _DataType data[_Size];
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Iteration space of an elementwise operation over strided operands.
+ *
+ * Shape and per operand strides (in elements) of at most
+ * @ref DPNP_KERNEL_ARG_MAX_NDIM dimensions. The structure is trivially
+ * copyable and is captured by value in a kernel. It is filled on host by
+ * @ref dpnp_normalize_strides.
+ *
+ * @tparam _NOperands  Number of operands sharing the iteration space.
+ */
+template <size_t _NOperands>
+struct dpnp_strided_space
+{
+    size_t ndim;
+    shape_elem_type shape[DPNP_KERNEL_ARG_MAX_NDIM];
+    shape_elem_type strides[_NOperands][DPNP_KERNEL_ARG_MAX_NDIM];
+
+    /**
+     * Reshape a one dimensional space into a single row.
+     *
+     * @return true if the space has two dimensions.
+     */
+    bool as_2d()
+    {
+        if (ndim == 1) {
+            shape[1] = shape[0];
+            shape[0] = 1;
+            for (size_t k = 0; k < _NOperands; ++k) {
+                strides[k][1] = strides[k][0];
+                strides[k][0] = 0;
+            }
+            ndim = 2;
+        }
+        return ndim == 2;
+    }
+
+    /**
+     * Check if each of first @ref count operands is a C-contiguous array.
+     */
+    bool is_contiguous(size_t count = _NOperands) const
+    {
+        if (ndim != 1) {
+            return false;
+        }
+        for (size_t k = 0; k < count; ++k) {
+            if (strides[k][0] != 1) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Offsets of the operands for the element (@ref row, @ref col) of a two
+     * dimensional space.
+     */
+    inline void get_offsets(size_t row,
+                            size_t col,
+                            shape_elem_type (&offsets)[_NOperands]) const
+    {
+        for (size_t k = 0; k < _NOperands; ++k) {
+            offsets[k] = row * strides[k][0] + col * strides[k][1];
+        }
+    }
+
+    /**
+     * Offsets of the operands for the element with linear index @ref id in
+     * C order of the space.
+     */
+    inline void get_offsets(size_t id,
+                            shape_elem_type (&offsets)[_NOperands]) const
+    {
+        for (size_t k = 0; k < _NOperands; ++k) {
+            offsets[k] = 0;
+        }
+        for (size_t i = ndim; i-- > 0;) {
+            const size_t xyz_id = id % shape[i];
+            id /= shape[i];
+            for (size_t k = 0; k < _NOperands; ++k) {
+                offsets[k] += xyz_id * strides[k][i];
+            }
+        }
+    }
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Collapse dimensions of an elementwise iteration space.
+ *
+ * Dimensions of size 1 are dropped. The rest are ordered by decreasing
+ * absolute stride of the operands, the first operand taking precedence, and
+ * neighbouring dimensions which are contiguous with each other for every
+ * operand are merged into one. A zero stride is a valid stride for an operand
+ * and is merged as well.
+ *
+ * For example, a transposed 2D input and a C-contiguous result stay 2D while
+ * C-contiguous slices of a 4D array usually collapse into one or two
+ * dimensions.
+ *
+ * @param [in]  ndim     Number of dimensions of the operands.
+ * @param [in]  shape    Common shape of the operands.
+ * @param [in]  strides  Strides of each operand, in elements.
+ * @param [out] space    Collapsed iteration space.
+ *
+ * @return false if the collapsed space has more than
+ *         @ref DPNP_KERNEL_ARG_MAX_NDIM dimensions, @ref space is undefined
+ *         then.
+ */
+template <size_t _NOperands>
+static inline bool
+    dpnp_normalize_strides(const size_t ndim,
+                           const shape_elem_type *shape,
+                           const shape_elem_type *const (&strides)[_NOperands],
+                           dpnp_strided_space<_NOperands> &space)
+{
+    std::vector<size_t> axes;
+    axes.reserve(ndim);
+    for (size_t i = 0; i < ndim; ++i) {
+        if (shape[i] != 1) {
+            axes.push_back(i);
+        }
+    }
+
+    std::stable_sort(axes.begin(), axes.end(), [&](size_t a, size_t b) {
+        for (size_t k = 0; k < _NOperands; ++k) {
+            const shape_elem_type stride_a = std::abs(strides[k][a]);
+            const shape_elem_type stride_b = std::abs(strides[k][b]);
+            if (stride_a != stride_b) {
+                return stride_a > stride_b;
+            }
+        }
+        return false;
+    });
+
+    space.ndim = 0;
+    for (const size_t axis : axes) {
+        if (space.ndim != 0) {
+            const size_t last = space.ndim - 1;
+            bool mergeable = true;
+            for (size_t k = 0; k < _NOperands; ++k) {
+                if (space.strides[k][last] !=
+                    strides[k][axis] * shape[axis]) {
+                    mergeable = false;
+                    break;
+                }
+            }
+
+            if (mergeable) {
+                space.shape[last] *= shape[axis];
+                for (size_t k = 0; k < _NOperands; ++k) {
+                    space.strides[k][last] = strides[k][axis];
+                }
+                continue;
+            }
+        }
+
+        if (space.ndim == DPNP_KERNEL_ARG_MAX_NDIM) {
+            return false;
+        }
+
+        space.shape[space.ndim] = shape[axis];
+        for (size_t k = 0; k < _NOperands; ++k) {
+            space.strides[k][space.ndim] = strides[k][axis];
+        }
+        ++space.ndim;
+    }
+
+    if (space.ndim == 0) { // a single element
+        space.ndim = 1;
+        space.shape[0] = 1;
+        for (size_t k = 0; k < _NOperands; ++k) {
+            space.strides[k][0] = 1;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Strides of a view of an array broadcast to a shape.
+ *
+ * Dimensions of the array are aligned with the trailing dimensions of the
+ * shape. Dimensions missing in the array or having size 1 get zero stride.
+ *
+ * @param [in]  shape     Shape of the array.
+ * @param [in]  strides   Strides of the array, in elements.
+ * @param [in]  ndim      Number of dimensions of the array.
+ * @param [in]  to_shape  Shape the array is broadcast to.
+ * @param [in]  to_ndim   Number of dimensions of @ref to_shape.
+ *
+ * @return Strides of the broadcast view, @ref to_ndim elements.
+ *
+ * @exception std::runtime_error    the array can't be broadcast to the shape.
+ */
+static inline std::vector<shape_elem_type>
+    get_broadcast_strides(const shape_elem_type *shape,
+                          const shape_elem_type *strides,
+                          const size_t ndim,
+                          const shape_elem_type *to_shape,
+                          const size_t to_ndim)
+{
+    if (ndim > to_ndim) {
+        throw std::runtime_error(
+            "DPNP Error: array with ndim=" + std::to_string(ndim) +
+            " can't be broadcast to ndim=" + std::to_string(to_ndim));
+    }
+
+    std::vector<shape_elem_type> result(to_ndim, 0);
+    const size_t shift = to_ndim - ndim;
+    for (size_t i = 0; i < ndim; ++i) {
+        if (shape[i] == to_shape[i + shift]) {
+            result[i + shift] = (shape[i] == 1) ? 0 : strides[i];
+        }
+        else if (shape[i] != 1) {
+            throw std::runtime_error(
+                "DPNP Error: array with shape[" + std::to_string(i) +
+                "]=" + std::to_string(shape[i]) + " can't be broadcast to " +
+                std::to_string(to_shape[i + shift]));
+        }
+    }
+
+    return result;
+}
+
 /**
  * @ingroup BACKEND_UTILS
  * @brief check support of type T by SYCL device.
@@ -27,9 +27,38 @@
 #ifndef DPNP_MEMORY_ADAPTER_H // Cython compatibility
 #define DPNP_MEMORY_ADAPTER_H
 
+#include <atomic>
+
 #include "dpnp_utils.hpp"
+#include "memory_pool_sycl.hpp"
 #include "queue_sycl.hpp"
 
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Number of bytes copied by @ref DPNPC_ptr_adapter.
+ *
+ * Counts both staging copies of the input and copies of the result back to
+ * the original memory. Value is reported by @ref dpnp_memory_staged_bytes_c.
+ */
+inline std::atomic<size_t> &dpnpc_staged_bytes()
+{
+    static std::atomic<size_t> staged_bytes{0};
+    return staged_bytes;
+}
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Count a staging copy in @ref dpnpc_staged_bytes and in statistics of
+ * the pool the staging memory is allocated from.
+ */
+inline void dpnpc_count_staged_bytes(const void *staging_ptr,
+                                     size_t size_in_bytes)
+{
+    dpnpc_staged_bytes() += size_in_bytes;
+    DPNPC_memory_pool::get_instance().add_staged_bytes(staging_ptr,
+                                                       size_in_bytes);
+}
+
 /**
  * @ingroup BACKEND_UTILS
  * @brief Adapter for the memory given by parameters in the DPNPC functions
@@ -56,6 +85,8 @@ class DPNPC_ptr_adapter final
                                      accessed from non SYCL environment */
     bool copy_back = false; /**< If the memory is 'result' it needs to be copied
                                back to original */
+    bool device_is_cpu = false; /**< All USM kinds are host accessible */
+    bool device_is_gpu = false; /**< Only shared and host USM are accessible */
     const bool verbose = false;
     std::vector<sycl::event> deps;
 
@@ -76,10 +107,13 @@ public:
         size_in_bytes = size * sizeof(_DataType);
         deps = std::vector<sycl::event>{};
 
-        // enum class alloc { host = 0, device = 1, shared = 2, unknown = 3 };
-        sycl::usm::alloc src_ptr_type = sycl::usm::alloc::unknown;
-        src_ptr_type = sycl::get_pointer_type(src_ptr, queue.get_context());
+        const sycl::device device = queue.get_device();
+        device_is_cpu = device.is_cpu();
+        device_is_gpu = device.is_gpu();
+
         if (verbose) {
+            // enum class alloc { host, device, shared, unknown };
+            const sycl::usm::alloc src_ptr_type = get_pointer_type(src_ptr);
             std::cerr << "DPNPC_ptr_converter:";
             std::cerr << "\n\t target_no_queue=" << target_no_queue;
             std::cerr << "\n\t copy_back=" << copy_back;
@@ -88,18 +122,17 @@ public:
             std::cerr << "\n\t size_in_bytes=" << size_in_bytes;
             std::cerr << "\n\t pointer type=" << (long)src_ptr_type;
             std::cerr << "\n\t queue inorder=" << queue.is_in_order();
-            std::cerr << "\n\t queue device is_cpu="
-                      << queue.get_device().is_cpu();
-            std::cerr << "\n\t queue device is_gpu="
-                      << queue.get_device().is_gpu();
+            std::cerr << "\n\t queue device is_cpu=" << device_is_cpu;
+            std::cerr << "\n\t queue device is_gpu=" << device_is_gpu;
             std::cerr << "\n\t queue device is_accelerator="
-                      << queue.get_device().is_accelerator();
+                      << device.is_accelerator();
             std::cerr << std::endl;
         }
 
-        if (is_memcpy_required(src_ptr_type)) {
+        if (is_memcpy_required(src_ptr)) {
             aux_ptr = dpnp_memory_alloc_c(queue_ref, size_in_bytes);
             dpnp_memory_memcpy_c(queue_ref, aux_ptr, src_ptr, size_in_bytes);
+            dpnpc_count_staged_bytes(aux_ptr, size_in_bytes);
             allocated = true;
             if (verbose) {
                 std::cerr << "DPNPC_ptr_converter::alloc and copy memory"
@@ -120,19 +153,48 @@ public:
                           << std::endl;
             }
 
-            sycl::event::wait(deps);
-
             if (copy_back) {
+                sycl::event::wait(deps);
                 copy_data_back();
+                dpnp_memory_free_c(queue_ref, aux_ptr);
             }
+            else {
+                // nothing to wait for on the host, memory is released by the
+                // queue when dependent kernels are done
+                dpnp_pool_free_async(queue, {aux_ptr}, deps);
+            }
+        }
+    }
 
-            dpnp_memory_free_c(queue_ref, aux_ptr);
+    /**
+     * @brief USM kind of the pointer in the queue context.
+     *
+     * Memory allocated by @ref dpnp_memory_alloc_c is known to the memory pool
+     * and is resolved without the SYCL runtime call.
+     */
+    sycl::usm::alloc get_pointer_type(const void *ptr) const
+    {
+        const sycl::context ctx = queue.get_context();
+        sycl::usm::alloc ptr_type = sycl::usm::alloc::unknown;
+        if (!DPNPC_memory_pool::get_instance().get_pointer_type(ptr, ctx,
+                                                                ptr_type))
+        {
+            ptr_type = sycl::get_pointer_type(ptr, ctx);
         }
+
+        return ptr_type;
     }
 
-    bool is_memcpy_required(sycl::usm::alloc src_ptr_type)
+    bool is_memcpy_required(const void *src_ptr) const
     {
-        if (target_no_queue || queue.get_device().is_gpu()) {
+        // CPU device kernels and the host address the same memory, so neither
+        // the host memory nor any kind of USM needs a staging copy
+        if (device_is_cpu) {
+            return false;
+        }
+
+        if (target_no_queue || device_is_gpu) {
+            const sycl::usm::alloc src_ptr_type = get_pointer_type(src_ptr);
             if (src_ptr_type == sycl::usm::alloc::unknown) {
                 return true;
             }
@@ -159,17 +221,16 @@ public:
         }
 
         dpnp_memory_memcpy_c(queue_ref, orig_ptr, aux_ptr, size_in_bytes);
+        dpnpc_count_staged_bytes(aux_ptr, size_in_bytes);
     }
 
     void depends_on(const std::vector<sycl::event> &new_deps)
     {
-        assert(allocated);
         deps.insert(std::end(deps), std::begin(new_deps), std::end(new_deps));
     }
 
     void depends_on(const sycl::event &new_dep)
     {
-        assert(allocated);
         deps.push_back(new_dep);
     }
 };
@@ -0,0 +1,260 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "dpnp_iface.hpp"
+#include "dpnp_utils.hpp"
+#include "graph_sycl.hpp"
+
+#if defined(SYCL_EXT_ONEAPI_GRAPH)
+namespace sycl_exp = sycl::ext::oneapi::experimental;
+
+struct DPNPC_command_graph::graph_impl
+{
+    using modifiable_t =
+        sycl_exp::command_graph<sycl_exp::graph_state::modifiable>;
+    using executable_t =
+        sycl_exp::command_graph<sycl_exp::graph_state::executable>;
+
+    std::unique_ptr<modifiable_t> recording;
+    std::unique_ptr<executable_t> executable;
+};
+#else
+struct DPNPC_command_graph::graph_impl
+{
+};
+#endif
+
+std::mutex DPNPC_command_graph::capturing_mutex;
+std::vector<DPNPC_command_graph *> DPNPC_command_graph::capturing_graphs;
+
+DPNPC_command_graph::DPNPC_command_graph(const sycl::queue &q)
+    : queue(q), impl(std::make_unique<graph_impl>())
+{
+}
+
+DPNPC_command_graph::~DPNPC_command_graph()
+{
+    if (capturing) {
+        std::lock_guard<std::mutex> lock(capturing_mutex);
+        capturing_graphs.erase(std::remove(capturing_graphs.begin(),
+                                           capturing_graphs.end(), this),
+                               capturing_graphs.end());
+    }
+
+    last_replay.wait();
+
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&queue);
+    for (void *ptr : owned_memory) {
+        dpnp_memory_free_c(q_ref, ptr);
+    }
+}
+
+void DPNPC_command_graph::begin_capture()
+{
+#if defined(SYCL_EXT_ONEAPI_GRAPH)
+    if (capturing) {
+        throw std::runtime_error("DPNP Error: graph capture already started");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(capturing_mutex);
+        if (find_capturing(queue)) {
+            throw std::runtime_error(
+                "DPNP Error: the queue is captured by another graph");
+        }
+        capturing_graphs.push_back(this);
+    }
+
+    impl->recording = std::make_unique<graph_impl::modifiable_t>(
+        queue.get_context(), queue.get_device());
+    impl->recording->begin_recording(queue);
+    capturing = true;
+#endif
+}
+
+void DPNPC_command_graph::end_capture()
+{
+#if defined(SYCL_EXT_ONEAPI_GRAPH)
+    if (!capturing) {
+        throw std::runtime_error("DPNP Error: graph capture is not started");
+    }
+
+    // released on any exit, the executable graph keeps its own copy
+    std::unique_ptr<graph_impl::modifiable_t> recording =
+        std::move(impl->recording);
+    recording->end_recording(queue);
+
+    {
+        std::lock_guard<std::mutex> lock(capturing_mutex);
+        capturing_graphs.erase(std::remove(capturing_graphs.begin(),
+                                           capturing_graphs.end(), this),
+                               capturing_graphs.end());
+    }
+    capturing = false;
+
+    last_replay.wait();
+
+    if (impl->executable) {
+        try {
+            impl->executable->update(*recording);
+            return;
+        } catch (const sycl::exception &) {
+            // the recorded sequence differs from the previous one
+            impl->executable.reset();
+        }
+    }
+
+    impl->executable = std::make_unique<graph_impl::executable_t>(
+        recording->finalize(
+            sycl::property_list{sycl_exp::property::graph::updatable()}));
+#endif
+}
+
+sycl::event DPNPC_command_graph::replay(const std::vector<sycl::event> &deps)
+{
+#if defined(SYCL_EXT_ONEAPI_GRAPH)
+    if (capturing || !impl->executable) {
+        throw std::runtime_error("DPNP Error: graph has no captured commands");
+    }
+
+    std::vector<sycl::event> copies_in = deps;
+    for (const binding_t &binding : bindings) {
+        if (binding.direction != GraphBinding::OUTPUT) {
+            copies_in.push_back(queue.memcpy(binding.captured, binding.ptr,
+                                             binding.size_in_bytes, deps));
+        }
+    }
+
+    sycl::event event = queue.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(copies_in);
+        cgh.ext_oneapi_graph(*impl->executable);
+    });
+
+    std::vector<sycl::event> copies_out;
+    for (const binding_t &binding : bindings) {
+        if (binding.direction != GraphBinding::INPUT) {
+            copies_out.push_back(queue.memcpy(binding.ptr, binding.captured,
+                                              binding.size_in_bytes, event));
+        }
+    }
+    if (!copies_out.empty()) {
+        event = queue.ext_oneapi_submit_barrier(copies_out);
+    }
+
+    last_replay = event;
+    return last_replay;
+#else
+    // the calls were executed during capture, a replay can't run them again
+    (void)deps;
+    throw std::runtime_error(
+        "DPNP Error: graph replay requires SYCL command graph support");
+#endif
+}
+
+void DPNPC_command_graph::bind(void *captured,
+                               void *ptr,
+                               size_t size_in_bytes,
+                               GraphBinding direction)
+{
+    bindings.erase(std::remove_if(bindings.begin(), bindings.end(),
+                                  [captured](const binding_t &binding) {
+                                      return binding.captured == captured;
+                                  }),
+                   bindings.end());
+
+    if (ptr != captured) {
+        bindings.push_back({captured, ptr, size_in_bytes, direction});
+    }
+}
+
+void DPNPC_command_graph::adopt(const std::vector<void *> &ptrs)
+{
+    std::lock_guard<std::mutex> lock(owned_mutex);
+    owned_memory.insert(owned_memory.end(), ptrs.begin(), ptrs.end());
+}
+
+DPNPC_command_graph *DPNPC_command_graph::get_capturing(const sycl::queue &q)
+{
+    std::lock_guard<std::mutex> lock(capturing_mutex);
+    return find_capturing(q);
+}
+
+DPNPC_command_graph *DPNPC_command_graph::find_capturing(const sycl::queue &q)
+{
+    for (DPNPC_command_graph *graph : capturing_graphs) {
+        if (graph->queue == q) {
+            return graph;
+        }
+    }
+
+    return nullptr;
+}
+
+void *dpnp_graph_create_c(DPCTLSyclQueueRef q_ref)
+{
+    sycl::queue &q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    return new DPNPC_command_graph(q);
+}
+
+void dpnp_graph_begin_capture_c(void *graph)
+{
+    reinterpret_cast<DPNPC_command_graph *>(graph)->begin_capture();
+}
+
+void dpnp_graph_end_capture_c(void *graph)
+{
+    reinterpret_cast<DPNPC_command_graph *>(graph)->end_capture();
+}
+
+void dpnp_graph_bind_c(void *graph,
+                       void *captured,
+                       void *ptr,
+                       size_t size_in_bytes,
+                       GraphBinding direction)
+{
+    reinterpret_cast<DPNPC_command_graph *>(graph)->bind(
+        captured, ptr, size_in_bytes, direction);
+}
+
+DPCTLSyclEventRef
+    dpnp_graph_replay_c(void *graph,
+                        const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    const std::vector<sycl::event> deps = cast_event_vector(dep_event_vec_ref);
+
+    sycl::event event =
+        reinterpret_cast<DPNPC_command_graph *>(graph)->replay(deps);
+
+    DPCTLSyclEventRef event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
+}
+
+void dpnp_graph_delete_c(void *graph)
+{
+    delete reinterpret_cast<DPNPC_command_graph *>(graph);
+}
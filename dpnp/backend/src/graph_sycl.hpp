@@ -0,0 +1,145 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#pragma once
+#ifndef GRAPH_SYCL_H // Cython compatibility
+#define GRAPH_SYCL_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "dpnp_iface.hpp"
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Replayable record of the commands submitted to a SYCL queue.
+ *
+ * Between @ref begin_capture and @ref end_capture kernels and memory
+ * operations submitted to the queue are recorded into a SYCL command graph
+ * instead of being executed. @ref replay executes the recorded sequence
+ * without host side dispatch, argument validation and temporary memory
+ * allocation of the original calls.
+ *
+ * Recorded commands keep the pointers they were called with. To run them on
+ * other memory without capturing again, the memory is bound to the captured
+ * pointer by @ref bind: each replay copies inputs into the captured memory
+ * before the recorded commands and the captured memory to outputs after them.
+ * Kernels are recorded as lambdas capturing their pointers, so their
+ * arguments can't be made dynamic graph parameters. Capturing again into the
+ * same object updates the executable graph in place, or finalizes a new one
+ * if the recorded sequence differs.
+ *
+ * Temporary memory released during capture, by @ref dpnp_pool_free_async or
+ * @ref dpnp_memory_free_c, is owned by the graph and freed together with it,
+ * so it is never reused while a recorded command may access it.
+ *
+ * Only asynchronous (`_ext_c`) kernels can be captured. Calls waiting on the
+ * host for their own events, like `_default_c` wrappers or host-computed
+ * kernels, fail during capture.
+ *
+ * Without the SYCL_EXT_ONEAPI_GRAPH extension commands are executed when
+ * submitted during capture and @ref replay throws, so a caller never gets
+ * results of the captured calls instead of a new execution.
+ */
+class DPNPC_command_graph final
+{
+public:
+    explicit DPNPC_command_graph(const sycl::queue &q);
+    ~DPNPC_command_graph();
+
+    DPNPC_command_graph(const DPNPC_command_graph &) = delete;
+    DPNPC_command_graph &operator=(const DPNPC_command_graph &) = delete;
+
+    /// start recording commands submitted to the queue
+    void begin_capture();
+
+    /// stop recording and make the graph ready for @ref replay
+    void end_capture();
+
+    /**
+     * @brief Execute recorded commands.
+     *
+     * @param [in]  deps  Events the execution depends on.
+     *
+     * @return Event of the graph execution and copies of bound memory.
+     *
+     * @throw std::runtime_error  Without SYCL command graph support.
+     */
+    sycl::event replay(const std::vector<sycl::event> &deps);
+
+    /**
+     * @brief Run recorded commands on other memory.
+     *
+     * @param [in]  captured       USM pointer passed to the captured calls.
+     * @param [in]  ptr            USM pointer to use instead, @ref captured
+     *                             to remove the binding.
+     * @param [in]  size_in_bytes  Size of memory to copy.
+     * @param [in]  direction      Copies made on each replay.
+     */
+    void bind(void *captured,
+              void *ptr,
+              size_t size_in_bytes,
+              GraphBinding direction);
+
+    /**
+     * @brief Take ownership of temporary memory released during capture.
+     *
+     * @param [in]  ptrs  USM pointers to release with the graph.
+     */
+    void adopt(const std::vector<void *> &ptrs);
+
+    /// return graph capturing commands of queue @ref q or nullptr
+    static DPNPC_command_graph *get_capturing(const sycl::queue &q);
+
+private:
+    static DPNPC_command_graph *find_capturing(const sycl::queue &q);
+
+    sycl::queue queue;
+    bool capturing = false;
+    sycl::event last_replay;
+
+    struct graph_impl;
+    std::unique_ptr<graph_impl> impl;
+
+    struct binding_t
+    {
+        void *captured;
+        void *ptr;
+        size_t size_in_bytes;
+        GraphBinding direction;
+    };
+    std::vector<binding_t> bindings;
+
+    std::mutex owned_mutex;
+    std::vector<void *> owned_memory; /**< adopted by all captures */
+
+    static std::mutex capturing_mutex;
+    static std::vector<DPNPC_command_graph *> capturing_graphs;
+};
+
+#endif // GRAPH_SYCL_H
@@ -0,0 +1,185 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "dpnp_iface.hpp"
+#include "graph_sycl.hpp"
+#include "host_path.hpp"
+
+DPNPC_host_path &DPNPC_host_path::get_instance()
+{
+    // intentionally leaked. See class description.
+    static DPNPC_host_path *instance = new DPNPC_host_path();
+    return *instance;
+}
+
+DPNPC_host_path::DPNPC_host_path()
+{
+    if (std::getenv("DPNPC_HOST_PATH_DISABLE") != nullptr) {
+        fallback_threshold = 0;
+        return;
+    }
+
+    const char *file_name = std::getenv("DPNPC_HOST_PATH_CALIBRATION");
+    if (file_name != nullptr) {
+        try {
+            load(file_name);
+        } catch (const std::runtime_error &e) {
+            // a missing or broken file must not fail every kernel call
+            std::cerr << e.what()
+                      << ". The default host path thresholds are used."
+                      << std::endl;
+        }
+    }
+}
+
+size_t DPNPC_host_path::get_threshold(const std::string &op) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = thresholds.find(op);
+    return (it == thresholds.end()) ? fallback_threshold : it->second;
+}
+
+void DPNPC_host_path::set_threshold(const std::string &op, size_t threshold)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (op == "default") {
+        fallback_threshold = threshold;
+    }
+    else {
+        thresholds[op] = threshold;
+    }
+}
+
+void DPNPC_host_path::load(const std::string &file_name)
+{
+    std::ifstream file(file_name);
+    if (!file) {
+        throw std::runtime_error("DPNP Error: unable to read host path "
+                                 "calibration file " +
+                                 file_name);
+    }
+
+    // applied only when the whole file is parsed
+    std::vector<std::pair<std::string, size_t>> loaded;
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        std::string op;
+        size_t threshold = 0;
+        if (!(fields >> op >> threshold)) {
+            throw std::runtime_error("DPNP Error: wrong line \"" + line +
+                                     "\" in " + file_name);
+        }
+        loaded.emplace_back(op, threshold);
+    }
+
+    for (const auto &item : loaded) {
+        set_threshold(item.first, item.second);
+    }
+}
+
+void DPNPC_host_path::save(const std::string &file_name) const
+{
+    std::ofstream file(file_name);
+    if (!file) {
+        throw std::runtime_error("DPNP Error: unable to write host path "
+                                 "calibration file " +
+                                 file_name);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    file << "# operation threshold_in_elements" << std::endl;
+    file << "default " << fallback_threshold << std::endl;
+    for (const auto &item : thresholds) {
+        file << item.first << " " << item.second << std::endl;
+    }
+}
+
+bool dpnp_host_path(sycl::queue &q,
+                    const char *op,
+                    size_t size,
+                    const std::vector<sycl::event> &deps)
+{
+    if (size > DPNPC_host_path::get_instance().get_threshold(op)) {
+        return false;
+    }
+
+    // an in-order queue may still run kernels the result depends on
+    if (!q.get_device().is_cpu() || q.is_in_order()) {
+        return false;
+    }
+
+    if (DPNPC_command_graph::get_capturing(q)) {
+        return false;
+    }
+
+    // waiting for a pending dependency would block the caller, the kernel is
+    // submitted with its dependencies instead
+    for (const sycl::event &dep : deps) {
+        if (dep.get_info<sycl::info::event::command_execution_status>() !=
+            sycl::info::event_command_status::complete)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void dpnp_host_path_set_threshold_c(const char *op, size_t threshold)
+{
+    DPNPC_host_path::get_instance().set_threshold(op, threshold);
+}
+
+size_t dpnp_host_path_get_threshold_c(const char *op)
+{
+    return DPNPC_host_path::get_instance().get_threshold(op);
+}
+
+void dpnp_host_path_load_c(const char *file_name)
+{
+    DPNPC_host_path::get_instance().load(file_name);
+}
+
+void dpnp_host_path_save_c(const char *file_name)
+{
+    DPNPC_host_path::get_instance().save(file_name);
+}
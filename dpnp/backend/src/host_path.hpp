@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#pragma once
+#ifndef HOST_PATH_H // Cython compatibility
+#define HOST_PATH_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Size thresholds below which kernels run as a plain host loop.
+ *
+ * Submitting a kernel to the CPU device costs much more than the arithmetic on
+ * a few hundred elements. Kernels supporting the host path compare the number
+ * of elements with the threshold of the operation and, if it is not exceeded,
+ * compute the result directly on the calling thread.
+ *
+ * Thresholds are read from the calibration file pointed by
+ * "DPNPC_HOST_PATH_CALIBRATION" environment variable. Each line of the file
+ * has an operation name (the kernel function name, e.g. "dpnp_add_c") and the
+ * threshold in elements. The name "default" sets the threshold of the
+ * operations not listed. Lines starting with '#' are ignored. The file is
+ * produced by "examples/example_host_path_calibration.cpp". If the file can't
+ * be read or parsed, the error is reported and the default thresholds are
+ * kept.
+ * The host path could be disabled with "DPNPC_HOST_PATH_DISABLE" environment
+ * variable.
+ *
+ * The object is never destroyed to avoid dependency on the order of global
+ * objects destruction at program exit.
+ */
+class DPNPC_host_path final
+{
+public:
+    static constexpr size_t default_threshold = 256;
+
+    /// Thresholds singleton
+    static DPNPC_host_path &get_instance();
+
+    DPNPC_host_path(const DPNPC_host_path &) = delete;
+    DPNPC_host_path &operator=(const DPNPC_host_path &) = delete;
+
+    /// return threshold of the operation @ref op in elements
+    size_t get_threshold(const std::string &op) const;
+
+    /// set threshold of the operation @ref op, "default" for unlisted ones
+    void set_threshold(const std::string &op, size_t threshold);
+
+    /**
+     * @brief Read thresholds from calibration file.
+     *
+     * @param [in]  file_name  Name of the calibration file.
+     *
+     * @exception std::runtime_error  The file can not be read or parsed,
+     *                                 thresholds are not changed then.
+     */
+    void load(const std::string &file_name);
+
+    /**
+     * @brief Write current thresholds into calibration file.
+     *
+     * @param [in]  file_name  Name of the calibration file.
+     *
+     * @exception std::runtime_error  The file can not be written.
+     */
+    void save(const std::string &file_name) const;
+
+private:
+    DPNPC_host_path();
+
+    mutable std::mutex mutex;
+    size_t fallback_threshold = default_threshold;
+    std::unordered_map<std::string, size_t> thresholds;
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Check whether a kernel should compute its result on the host.
+ *
+ * The host path is taken if @ref size does not exceed the threshold of
+ * operation @ref op and the queue is an out-of-order queue of a CPU device,
+ * where all USM memory is host accessible. Queues being captured into a
+ * command graph always submit kernels, so do calls with a dependency which
+ * is not complete yet: the function never blocks the caller.
+ *
+ * @param [in]  q     SYCL queue the kernel would be submitted to.
+ * @param [in]  op    Operation name, see @ref DPNPC_host_path.
+ * @param [in]  size  Number of elements to process.
+ * @param [in]  deps  Events the kernel depends on.
+ *
+ * @return true if the caller should run its host loop.
+ */
+bool dpnp_host_path(sycl::queue &q,
+                    const char *op,
+                    size_t size,
+                    const std::vector<sycl::event> &deps);
+
+#endif // HOST_PATH_H
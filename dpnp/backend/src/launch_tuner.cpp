@@ -0,0 +1,257 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include "dpnp_iface.hpp"
+#include "graph_sycl.hpp"
+#include "launch_tuner.hpp"
+
+static const size_t tuning_lws[] = {32, 64, 128, 256};
+static const size_t tuning_vec_sz[] = {4, 8, 16};
+static const size_t tuning_repetitions = 3;
+
+DPNPC_launch_tuner &DPNPC_launch_tuner::get_instance()
+{
+    // intentionally leaked. See class description.
+    static DPNPC_launch_tuner *instance = new DPNPC_launch_tuner();
+    return *instance;
+}
+
+DPNPC_launch_tuner::DPNPC_launch_tuner()
+{
+    const char *tuning_value = std::getenv("DPNPC_LAUNCH_TUNING");
+    tuning = (tuning_value != nullptr) && (std::atoi(tuning_value) != 0);
+
+    const char *file_name = std::getenv("DPNPC_LAUNCH_TUNING_CACHE");
+    if (file_name != nullptr) {
+        cache_file = file_name;
+        // the cache is created by the first tuning
+        if (std::ifstream(cache_file)) {
+            try {
+                load(cache_file);
+            } catch (const std::runtime_error &e) {
+                // a broken cache must not fail the import, nor be overwritten
+                std::cerr << e.what() << ". The launch tuning cache is ignored."
+                          << std::endl;
+                cache_file.clear();
+            }
+        }
+    }
+}
+
+const std::string &
+    DPNPC_launch_tuner::get_device_key(const sycl::device &device)
+{
+    auto it = device_keys.find(device);
+    if (it == device_keys.end()) {
+        const std::string key =
+            device.get_info<sycl::info::device::name>() + "; " +
+            device.get_info<sycl::info::device::driver_version>();
+        it = device_keys.emplace(device, key).first;
+    }
+    return it->second;
+}
+
+dpnp_launch_params DPNPC_launch_tuner::get(sycl::queue &q,
+                                           const std::string &op,
+                                           const std::string &type,
+                                           size_t size,
+                                           const run_t &run)
+{
+    size_t size_class = 0;
+    while ((size >> (size_class + 4)) != 0) {
+        size_class += 4;
+    }
+    const std::string key = op + " " + type + " " + std::to_string(size_class);
+
+    std::string device_key;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        device_key = get_device_key(q.get_device());
+        const auto &device_params = params[device_key];
+        auto it = device_params.find(key);
+        if (it != device_params.end()) {
+            return it->second;
+        }
+
+        // measurements wait for kernels, which a captured queue can't do
+        if (!tuning || (size < min_tuning_size) ||
+            DPNPC_command_graph::get_capturing(q))
+        {
+            return default_params;
+        }
+    }
+
+    // kernels are run without the lock, a concurrent tuning of the same key
+    // just measures twice
+    const dpnp_launch_params tuned = tune(q, run);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    params[device_key][key] = tuned;
+    if (!cache_file.empty()) {
+        std::ofstream file(cache_file);
+        if (file) {
+            write(file);
+        }
+    }
+
+    return tuned;
+}
+
+dpnp_launch_params DPNPC_launch_tuner::tune(sycl::queue &q,
+                                            const run_t &run) const
+{
+    const size_t max_lws =
+        q.get_device().get_info<sycl::info::device::max_work_group_size>();
+
+    dpnp_launch_params best = default_params;
+    double best_time = std::numeric_limits<double>::max();
+    for (const size_t lws : tuning_lws) {
+        if (lws > max_lws) {
+            continue;
+        }
+
+        for (const size_t vec_sz : tuning_vec_sz) {
+            const dpnp_launch_params candidate = {lws, vec_sz};
+
+            // first run builds the kernel
+            run(candidate).wait_and_throw();
+
+            double time = std::numeric_limits<double>::max();
+            for (size_t i = 0; i < tuning_repetitions; ++i) {
+                auto t1 = std::chrono::steady_clock::now();
+                run(candidate).wait_and_throw();
+                auto t2 = std::chrono::steady_clock::now();
+                time = std::min(time,
+                                std::chrono::duration<double>(t2 - t1).count());
+            }
+
+            if (time < best_time) {
+                best_time = time;
+                best = candidate;
+            }
+        }
+    }
+
+    return best;
+}
+
+void DPNPC_launch_tuner::set_tuning(bool enable)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    tuning = enable;
+}
+
+void DPNPC_launch_tuner::load(const std::string &file_name)
+{
+    std::ifstream file(file_name);
+    if (!file) {
+        throw std::runtime_error("DPNP Error: unable to read launch tuning "
+                                 "cache file " +
+                                 file_name);
+    }
+
+    // nothing is taken from a file with a wrong line
+    std::map<std::string, std::map<std::string, dpnp_launch_params>> loaded;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        std::string op;
+        std::string type;
+        size_t size_class = 0;
+        dpnp_launch_params item = default_params;
+        std::string device_key;
+        if (!(fields >> op >> type >> size_class >> item.lws >> item.vec_sz) ||
+            !std::getline(fields >> std::ws, device_key) ||
+            ((item.vec_sz != 4) && (item.vec_sz != 8) &&
+             (item.vec_sz != 16)) ||
+            (item.lws == 0))
+        {
+            throw std::runtime_error("DPNP Error: wrong line \"" + line +
+                                     "\" in " + file_name);
+        }
+
+        loaded[device_key][op + " " + type + " " +
+                           std::to_string(size_class)] = item;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &device_params : loaded) {
+        for (const auto &item : device_params.second) {
+            params[device_params.first][item.first] = item.second;
+        }
+    }
+}
+
+void DPNPC_launch_tuner::save(const std::string &file_name) const
+{
+    std::ofstream file(file_name);
+    if (!file) {
+        throw std::runtime_error("DPNP Error: unable to write launch tuning "
+                                 "cache file " +
+                                 file_name);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    write(file);
+}
+
+void DPNPC_launch_tuner::write(std::ostream &out) const
+{
+    out << "# operation type size_class lws vec_sz device" << std::endl;
+    for (const auto &device_item : params) {
+        for (const auto &item : device_item.second) {
+            out << item.first << " " << item.second.lws << " "
+                << item.second.vec_sz << " " << device_item.first << std::endl;
+        }
+    }
+}
+
+void dpnp_launch_tuning_enable_c(size_t enable)
+{
+    DPNPC_launch_tuner::get_instance().set_tuning(enable != 0);
+}
+
+void dpnp_launch_tuning_load_c(const char *file_name)
+{
+    DPNPC_launch_tuner::get_instance().load(file_name);
+}
+
+void dpnp_launch_tuning_save_c(const char *file_name)
+{
+    DPNPC_launch_tuner::get_instance().save(file_name);
+}
@@ -0,0 +1,189 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#pragma once
+#ifndef LAUNCH_TUNER_H // Cython compatibility
+#define LAUNCH_TUNER_H
+
+#include <functional>
+#include <ostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include <CL/sycl.hpp>
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Launch parameters of the sub-group vectorized elementwise kernels.
+ */
+struct dpnp_launch_params
+{
+    size_t lws;    /**< work-group size */
+    size_t vec_sz; /**< elements per work item loaded as a vector */
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Tuned launch parameters of elementwise kernels.
+ *
+ * Parameters are kept per device, operation (the kernel function name, e.g.
+ * "dpnp_add_c"), result type and size class, the power of 16 the number of
+ * elements falls into. A device is identified by its name and driver version.
+ *
+ * If tuning is enabled, a missing entry is measured at the first use: each
+ * candidate of the grid of work-group and vector sizes is run a few times
+ * and the fastest one is kept. Otherwise default parameters are used.
+ * Tuning is enabled by "DPNPC_LAUNCH_TUNING" environment variable set to a
+ * nonzero integer or by @ref dpnp_launch_tuning_enable_c, e.g. for an offline
+ * tuning run.
+ *
+ * The cache file pointed by "DPNPC_LAUNCH_TUNING_CACHE" environment variable
+ * is read at start and rewritten after each tuning. Each line of the file has
+ * the operation, result type, size class, work-group size, vector size and
+ * the device. Lines starting with '#' are ignored. A cache file which can't be
+ * parsed is reported to stderr, ignored and kept unchanged.
+ *
+ * The object is never destroyed to avoid dependency on the order of global
+ * objects destruction at program exit.
+ */
+class DPNPC_launch_tuner final
+{
+public:
+    static constexpr dpnp_launch_params default_params = {64, 8};
+
+    /// Arrays smaller than that are not tuned, launch overhead dominates
+    static constexpr size_t min_tuning_size = 1 << 16;
+
+    /// Kernel runner used to measure a candidate
+    using run_t = std::function<sycl::event(const dpnp_launch_params &)>;
+
+    /// Tuner singleton
+    static DPNPC_launch_tuner &get_instance();
+
+    DPNPC_launch_tuner(const DPNPC_launch_tuner &) = delete;
+    DPNPC_launch_tuner &operator=(const DPNPC_launch_tuner &) = delete;
+
+    /**
+     * @brief Launch parameters of an operation.
+     *
+     * @param [in]  q     SYCL queue the kernel is submitted to.
+     * @param [in]  op    Operation name.
+     * @param [in]  type  Result type name, see @ref dpnp_launch_type_name.
+     * @param [in]  size  Number of elements.
+     * @param [in]  run   Runner of the kernel with given parameters, called
+     *                    only when tuning takes place.
+     *
+     * @return Tuned parameters or the default ones.
+     */
+    dpnp_launch_params get(sycl::queue &q,
+                           const std::string &op,
+                           const std::string &type,
+                           size_t size,
+                           const run_t &run);
+
+    /// enable or disable tuning at the first use
+    void set_tuning(bool enable);
+
+    /**
+     * @brief Read tuned parameters from cache file.
+     *
+     * Parameters are taken only if the whole file is parsed.
+     *
+     * @param [in]  file_name  Name of the cache file.
+     *
+     * @exception std::runtime_error  The file can not be read or parsed.
+     */
+    void load(const std::string &file_name);
+
+    /**
+     * @brief Write tuned parameters of all devices into cache file.
+     *
+     * @param [in]  file_name  Name of the cache file.
+     *
+     * @exception std::runtime_error  The file can not be written.
+     */
+    void save(const std::string &file_name) const;
+
+private:
+    DPNPC_launch_tuner();
+
+    const std::string &get_device_key(const sycl::device &device);
+    dpnp_launch_params tune(sycl::queue &q, const run_t &run) const;
+
+    /// write all parameters in cache file format, the mutex must be held
+    void write(std::ostream &out) const;
+
+    mutable std::mutex mutex;
+    bool tuning = false;
+    std::string cache_file;
+    std::unordered_map<sycl::device, std::string> device_keys;
+    // device key -> "operation type size_class" -> parameters
+    std::map<std::string, std::map<std::string, dpnp_launch_params>> params;
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Type name used as a key of tuned parameters, like NumPy typestr.
+ */
+template <typename _DataType>
+std::string dpnp_launch_type_name()
+{
+    char kind = 'c';
+    if constexpr (std::is_same_v<_DataType, bool>) {
+        kind = 'b';
+    }
+    else if constexpr (std::is_integral_v<_DataType>) {
+        kind = std::is_signed_v<_DataType> ? 'i' : 'u';
+    }
+    else if constexpr (std::is_floating_point_v<_DataType>) {
+        kind = 'f';
+    }
+    return kind + std::to_string(sizeof(_DataType));
+}
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Call @ref func with the vector size as std::integral_constant.
+ *
+ * Vector size is a template argument of sub-group loads, so kernels are
+ * instantiated for every vector size candidate of the tuner.
+ */
+template <typename _Function>
+auto dpnp_launch_vec_sz_dispatch(size_t vec_sz, _Function &&func)
+{
+    switch (vec_sz) {
+    case 4:
+        return func(std::integral_constant<unsigned int, 4>{});
+    case 16:
+        return func(std::integral_constant<unsigned int, 16>{});
+    default:
+        return func(std::integral_constant<unsigned int, 8>{});
+    }
+}
+
+#endif // LAUNCH_TUNER_H
@@ -0,0 +1,536 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "memory_pool_sycl.hpp"
+
+static bool get_env_value(const char *name, std::string &value)
+{
+    char *env_value = nullptr;
+
+#ifdef _WIN32
+    size_t env_value_size = 0;
+    _dupenv_s(&env_value, &env_value_size, name);
+#else
+    env_value = std::getenv(name);
+#endif
+
+    if (env_value == nullptr) {
+        return false;
+    }
+
+    value = env_value;
+#ifdef _WIN32
+    free(env_value);
+#endif
+
+    return true;
+}
+
+DPNPC_memory_pool &DPNPC_memory_pool::get_instance()
+{
+    // intentionally leaked. See class description.
+    static DPNPC_memory_pool *instance = new DPNPC_memory_pool();
+    return *instance;
+}
+
+DPNPC_memory_pool::DPNPC_memory_pool()
+{
+    std::string value;
+
+    enabled = !get_env_value("DPNPC_MEMORY_POOL_DISABLE", value);
+
+    high_water_mark = default_high_water_mark;
+    if (get_env_value("DPNPC_MEMORY_POOL_HIGH_WATER_MARK", value)) {
+        try {
+            high_water_mark = std::stoull(value);
+        } catch (const std::exception &) {
+            // keep default value on malformed input
+        }
+    }
+
+    if (get_env_value("DPNPC_MEMORY_NUMA_POLICY", value)) {
+        if (value == "local") {
+            numa_policy = NumaPolicy::LOCAL;
+        }
+        else if (value == "interleave") {
+            numa_policy = NumaPolicy::INTERLEAVE;
+        }
+        else if (value == "first_touch") {
+            numa_policy = NumaPolicy::FIRST_TOUCH;
+        }
+    }
+}
+
+size_t DPNPC_memory_pool::get_size_class(size_t size_in_bytes)
+{
+    if (size_in_bytes > max_small_block_size) {
+        const size_t blocks = (size_in_bytes + large_block_granularity - 1) /
+                              large_block_granularity;
+        return blocks * large_block_granularity;
+    }
+
+    size_t size_class = min_block_size;
+    while (size_class < size_in_bytes) {
+        size_class <<= 1;
+    }
+
+    return size_class;
+}
+
+void *DPNPC_memory_pool::malloc(size_t size_in_bytes,
+                                const sycl::queue &q,
+                                sycl::usm::alloc kind)
+{
+    if (!enabled) {
+        void *ptr = sycl::malloc(size_in_bytes, q, kind);
+        if (ptr != nullptr) {
+            // the block is still registered to keep the statistics
+            std::unique_lock<std::mutex> lock(mutex);
+            pool_t &pool = get_pool(q, kind);
+            const block_info info{&pool, size_in_bytes, size_in_bytes,
+                                  std::this_thread::get_id()};
+            live_blocks.emplace(ptr, info);
+            count_malloc(pool, size_in_bytes);
+            lock.unlock();
+
+            place_pages(ptr, size_in_bytes, q);
+        }
+        return ptr;
+    }
+
+    const size_t size_class = get_size_class(size_in_bytes);
+    const sycl::context ctx = q.get_context();
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    pool_t &pool = get_pool(q, kind);
+
+    std::vector<void *> &free_list = pool.free_blocks[size_class];
+    void *ptr = nullptr;
+    bool is_new_block = false;
+    if (!free_list.empty()) {
+        ptr = free_list.back();
+        free_list.pop_back();
+        cached_bytes -= size_class;
+    }
+    else {
+        is_new_block = true;
+        ptr = sycl::malloc(size_class, q, kind);
+        if (ptr == nullptr) {
+            // cached blocks of the context might prevent the allocation
+            for (auto &it : pools) {
+                if (it.first.ctx == ctx) {
+                    release_blocks(it.second);
+                }
+            }
+            ptr = sycl::malloc(size_class, q, kind);
+        }
+    }
+
+    if (ptr != nullptr) {
+        live_blocks.emplace(ptr, block_info{&pool, size_class, size_in_bytes,
+                                            std::this_thread::get_id()});
+        count_malloc(pool, size_in_bytes);
+    }
+    lock.unlock();
+
+    if (is_new_block && (ptr != nullptr)) {
+        place_pages(ptr, size_class, q);
+    }
+
+    return ptr;
+}
+
+DPNPC_memory_pool::pool_t &DPNPC_memory_pool::get_pool(const sycl::queue &q,
+                                                       sycl::usm::alloc kind)
+{
+    const sycl::context ctx = q.get_context();
+    const pool_key key{ctx, q.get_device(), kind};
+
+    auto pool_it = pools.find(key);
+    if (pool_it == pools.end()) {
+        pool_it = pools.emplace(key, pool_t{ctx, kind, {}, {}}).first;
+    }
+
+    return pool_it->second;
+}
+
+void DPNPC_memory_pool::count_malloc(pool_t &pool, size_t size_in_bytes)
+{
+    DPNPMemoryStats &stats = pool.stats;
+
+    stats.live_bytes += size_in_bytes;
+    stats.peak_bytes = std::max(stats.peak_bytes, stats.live_bytes);
+    ++stats.alloc_count;
+
+    // bin is floor(log2(size_in_bytes)), the last bin takes all larger sizes
+    size_t bin = 0;
+    while ((bin + 1 < DPNP_MEMORY_HISTOGRAM_SIZE) &&
+           ((size_t(2) << bin) <= size_in_bytes))
+    {
+        ++bin;
+    }
+    ++stats.histogram[bin];
+
+    // memory of the thread grows only at its own allocations
+    size_t &live_bytes = thread_live_bytes[std::this_thread::get_id()];
+    live_bytes += size_in_bytes;
+    for (region_t &region : regions) {
+        region.peak_bytes = std::max(region.peak_bytes, live_bytes);
+    }
+}
+
+void DPNPC_memory_pool::get_stats(const sycl::queue *q,
+                                  sycl::usm::alloc kind,
+                                  DPNPMemoryStats &stats) const
+{
+    stats = DPNPMemoryStats{};
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (const auto &it : pools) {
+        const pool_key &key = it.first;
+        if (q && (key.ctx != q->get_context())) {
+            continue;
+        }
+        if (q && (key.dev != q->get_device())) {
+            continue;
+        }
+        if ((kind != sycl::usm::alloc::unknown) && (key.kind != kind)) {
+            continue;
+        }
+
+        const DPNPMemoryStats &pool_stats = it.second.stats;
+        stats.live_bytes += pool_stats.live_bytes;
+        stats.peak_bytes += pool_stats.peak_bytes;
+        stats.alloc_count += pool_stats.alloc_count;
+        stats.staged_bytes += pool_stats.staged_bytes;
+        for (size_t i = 0; i < DPNP_MEMORY_HISTOGRAM_SIZE; ++i) {
+            stats.histogram[i] += pool_stats.histogram[i];
+        }
+    }
+}
+
+void DPNPC_memory_pool::reset_stats()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto &it : pools) {
+        DPNPMemoryStats &stats = it.second.stats;
+        const size_t pool_live_bytes = stats.live_bytes;
+
+        stats = DPNPMemoryStats{};
+        stats.live_bytes = pool_live_bytes;
+        stats.peak_bytes = pool_live_bytes;
+    }
+    region_peaks.clear();
+}
+
+void DPNPC_memory_pool::add_staged_bytes(const void *ptr, size_t size_in_bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = live_blocks.find(const_cast<void *>(ptr));
+    if (it != live_blocks.end()) {
+        it->second.pool->stats.staged_bytes += size_in_bytes;
+    }
+}
+
+thread_local std::vector<DPNPC_memory_pool::region_t>
+    DPNPC_memory_pool::regions;
+
+void DPNPC_memory_pool::begin_region(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = thread_live_bytes.find(std::this_thread::get_id());
+    const size_t live_bytes =
+        (it == thread_live_bytes.end()) ? 0 : it->second;
+    regions.push_back(region_t{name, live_bytes, live_bytes});
+}
+
+size_t DPNPC_memory_pool::end_region()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (regions.empty()) {
+        throw std::runtime_error("DPNP Error: no memory region to end.");
+    }
+
+    const region_t region = regions.back();
+    regions.pop_back();
+
+    const size_t peak = region.peak_bytes - region.start_bytes;
+    size_t &named_peak = region_peaks[region.name];
+    named_peak = std::max(named_peak, peak);
+
+    return peak;
+}
+
+size_t DPNPC_memory_pool::get_region_peak(const std::string &name) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = region_peaks.find(name);
+    return (it == region_peaks.end()) ? 0 : it->second;
+}
+
+void DPNPC_memory_pool::set_numa_policy(NumaPolicy policy)
+{
+    numa_policy = policy;
+}
+
+NumaPolicy DPNPC_memory_pool::get_numa_policy() const
+{
+    return numa_policy;
+}
+
+class dpnp_first_touch_c_kernel;
+
+/**
+ * Write one word of each page of [pages, pages + length) from a kernel.
+ *
+ * The pages are split over a 1-D range as the elements of the elementwise
+ * kernels are, so each page is placed on the node of the threads likely to
+ * process the elements stored in it. The write is an atomic read-modify-write
+ * keeping data the host might have written already. The kernel is not waited
+ * for, on an out-of-order queue a barrier makes later commands run after it.
+ */
+static void first_touch(const sycl::queue &q,
+                        void *pages,
+                        size_t length,
+                        size_t page_size)
+{
+    sycl::queue queue = q;
+    uint32_t *words = static_cast<uint32_t *>(pages);
+    const size_t words_per_page = page_size / sizeof(uint32_t);
+
+    sycl::event event = queue.parallel_for<dpnp_first_touch_c_kernel>(
+        sycl::range<1>(length / page_size), [=](sycl::id<1> page_id) {
+            // not relaxed, an idempotent relaxed update may become a load
+            sycl::atomic_ref<uint32_t, sycl::memory_order::acq_rel,
+                             sycl::memory_scope::device,
+                             sycl::access::address_space::global_space>
+                word(words[page_id[0] * words_per_page]);
+            word.fetch_or(0u);
+        });
+
+    if (!queue.is_in_order()) {
+        queue.ext_oneapi_submit_barrier({event});
+    }
+}
+
+void DPNPC_memory_pool::place_pages(void *ptr,
+                                    size_t size_in_bytes,
+                                    const sycl::queue &q)
+{
+    const NumaPolicy policy = numa_policy;
+    if ((policy == NumaPolicy::NONE) || !q.get_device().is_cpu()) {
+        return;
+    }
+
+#if defined(__linux__)
+    // whole pages of the block only, the runtime might not align it
+    const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t begin =
+        (reinterpret_cast<uintptr_t>(ptr) + page_size - 1) & ~(page_size - 1);
+    const uintptr_t end =
+        (reinterpret_cast<uintptr_t>(ptr) + size_in_bytes) & ~(page_size - 1);
+    if (begin >= end) {
+        return;
+    }
+    void *pages = reinterpret_cast<void *>(begin);
+    const size_t length = end - begin;
+
+    if (policy == NumaPolicy::FIRST_TOUCH) {
+        // drop pages the runtime might have touched, then place them
+        madvise(pages, length, MADV_DONTNEED);
+        first_touch(q, pages, length, page_size);
+        return;
+    }
+
+    constexpr size_t bits_per_mask = 8 * sizeof(unsigned long);
+    unsigned long nodes[1024 / bits_per_mask] = {};
+    // the kernel reads max_node - 1 bits of the mask
+    constexpr unsigned long max_node = 8 * sizeof(nodes) + 1;
+
+    int mode = MPOL_INTERLEAVE;
+    if (policy == NumaPolicy::LOCAL) {
+        unsigned int cpu = 0;
+        unsigned int node = 0;
+        if ((syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) ||
+            (node >= max_node - 1))
+        {
+            return;
+        }
+        nodes[node / bits_per_mask] |= 1UL << (node % bits_per_mask);
+        mode = MPOL_PREFERRED;
+    }
+    else if (syscall(SYS_get_mempolicy, nullptr, nodes, max_node, nullptr,
+                     MPOL_F_MEMS_ALLOWED) != 0)
+    {
+        return;
+    }
+
+    // the policy applies to pages faulted later, pages already touched by the
+    // runtime are migrated. Pages stay where they are if the call fails.
+    syscall(SYS_mbind, pages, length, mode, nodes, max_node, MPOL_MF_MOVE);
+#else
+    constexpr size_t page_size = 4096;
+    if (policy == NumaPolicy::FIRST_TOUCH) {
+        const uintptr_t begin =
+            (reinterpret_cast<uintptr_t>(ptr) + page_size - 1) &
+            ~(page_size - 1);
+        const uintptr_t end =
+            (reinterpret_cast<uintptr_t>(ptr) + size_in_bytes) &
+            ~(page_size - 1);
+        if (begin >= end) {
+            return;
+        }
+        first_touch(q, reinterpret_cast<void *>(begin), end - begin,
+                    page_size);
+        return;
+    }
+
+    // only the allocating thread is known to be placed, touch the pages here
+    if (policy == NumaPolicy::LOCAL) {
+        char *data = static_cast<char *>(ptr);
+        for (size_t offset = 0; offset < size_in_bytes; offset += page_size) {
+            data[offset] = 0;
+        }
+    }
+#endif
+}
+
+bool DPNPC_memory_pool::free(void *ptr)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = live_blocks.find(ptr);
+    if (it == live_blocks.end()) {
+        return false;
+    }
+
+    const block_info info = it->second;
+    live_blocks.erase(it);
+
+    info.pool->stats.live_bytes -= info.size_in_bytes;
+    auto owner_it = thread_live_bytes.find(info.owner);
+    owner_it->second -= info.size_in_bytes;
+    if (owner_it->second == 0) {
+        thread_live_bytes.erase(owner_it);
+    }
+
+    if (!enabled || (cached_bytes + info.size_class > high_water_mark)) {
+        sycl::free(ptr, info.pool->ctx);
+    }
+    else {
+        info.pool->free_blocks[info.size_class].push_back(ptr);
+        cached_bytes += info.size_class;
+    }
+
+    return true;
+}
+
+void DPNPC_memory_pool::release_blocks(pool_t &pool)
+{
+    for (auto &free_list : pool.free_blocks) {
+        for (void *ptr : free_list.second) {
+            sycl::free(ptr, pool.ctx);
+            cached_bytes -= free_list.first;
+        }
+        free_list.second.clear();
+    }
+}
+
+void DPNPC_memory_pool::trim()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto &it : pools) {
+        release_blocks(it.second);
+    }
+}
+
+void DPNPC_memory_pool::trim(const sycl::context &ctx)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto &it : pools) {
+        if (it.first.ctx == ctx) {
+            release_blocks(it.second);
+        }
+    }
+}
+
+void DPNPC_memory_pool::set_high_water_mark(size_t size_in_bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    high_water_mark = size_in_bytes;
+    if (cached_bytes > high_water_mark) {
+        for (auto &it : pools) {
+            release_blocks(it.second);
+        }
+    }
+}
+
+size_t DPNPC_memory_pool::get_high_water_mark() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return high_water_mark;
+}
+
+size_t DPNPC_memory_pool::get_cached_bytes() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return cached_bytes;
+}
+
+bool DPNPC_memory_pool::get_pointer_type(const void *ptr,
+                                         const sycl::context &ctx,
+                                         sycl::usm::alloc &kind) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = live_blocks.find(const_cast<void *>(ptr));
+    if ((it == live_blocks.end()) || (it->second.pool->ctx != ctx)) {
+        return false;
+    }
+
+    kind = it->second.pool->kind;
+    return true;
+}
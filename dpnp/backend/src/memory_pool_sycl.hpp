@@ -0,0 +1,345 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#pragma once
+#ifndef MEMORY_POOL_SYCL_H // Cython compatibility
+#define MEMORY_POOL_SYCL_H
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include "dpnp_iface.hpp"
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Caching allocator for USM memory.
+ *
+ * Memory released by @ref dpnp_memory_free_c is not returned to the SYCL
+ * runtime immediately. It is kept in the per (context, device, USM kind) free
+ * lists and reused by the next @ref dpnp_memory_alloc_c of the same size class.
+ *
+ * Size classes are powers of two from @ref min_block_size up to
+ * @ref max_small_block_size and multiples of @ref large_block_granularity
+ * above it.
+ *
+ * Amount of idle memory kept by the pool is limited by the high water mark.
+ * The limit might be changed by @ref set_high_water_mark or by
+ * "DPNPC_MEMORY_POOL_HIGH_WATER_MARK" environment variable (in bytes).
+ * Pool could be disabled with "DPNPC_MEMORY_POOL_DISABLE" environment variable.
+ *
+ * Pages of newly allocated blocks for a CPU device are placed according to
+ * the NUMA policy set by @ref set_numa_policy or by
+ * "DPNPC_MEMORY_NUMA_POLICY" environment variable ("local", "interleave",
+ * "first_touch" or "none"). On Linux "local" and "interleave" are set on the
+ * pages by mbind, other systems support "local" only. "first_touch" writes the
+ * pages from a kernel over the same 1-D range as the elementwise kernels. The
+ * kernel is not waited for, on out-of-order queues a barrier orders later
+ * commands after it. Blocks reused from the free lists keep their placement.
+ *
+ * The pool keeps @ref DPNPMemoryStats for each (context, device, USM kind)
+ * and the peak of memory allocated inside of the regions opened by
+ * @ref begin_region. Statistics are kept when caching is disabled too.
+ *
+ * The object is never destroyed to avoid dependency on the order of global
+ * objects destruction at program exit.
+ */
+class DPNPC_memory_pool final
+{
+public:
+    static constexpr size_t min_block_size = 256;
+    static constexpr size_t max_small_block_size = 1024 * 1024;
+    static constexpr size_t large_block_granularity = 2 * 1024 * 1024;
+    static constexpr size_t default_high_water_mark = 512 * 1024 * 1024;
+
+    /// Pool singleton
+    static DPNPC_memory_pool &get_instance();
+
+    DPNPC_memory_pool(const DPNPC_memory_pool &) = delete;
+    DPNPC_memory_pool &operator=(const DPNPC_memory_pool &) = delete;
+
+    /**
+     * @brief Allocate USM memory block of at least @ref size_in_bytes bytes.
+     *
+     * @param [in]  size_in_bytes  Number of bytes requested.
+     * @param [in]  q              SYCL queue the memory is bound to.
+     * @param [in]  kind           USM memory kind.
+     *
+     * @return Pointer to the memory or nullptr if out of memory.
+     */
+    void *malloc(size_t size_in_bytes,
+                 const sycl::queue &q,
+                 sycl::usm::alloc kind);
+
+    /**
+     * @brief Return memory block into the pool.
+     *
+     * @param [in]  ptr  Pointer returned by @ref malloc.
+     *
+     * @return false if the pointer is not owned by the pool.
+     */
+    bool free(void *ptr);
+
+    /// Release all cached memory to the SYCL runtime.
+    void trim();
+
+    /// Release cached memory of the SYCL context to the SYCL runtime.
+    void trim(const sycl::context &ctx);
+
+    void set_high_water_mark(size_t size_in_bytes);
+    size_t get_high_water_mark() const;
+
+    /// Number of bytes kept in the free lists.
+    size_t get_cached_bytes() const;
+
+    /**
+     * @brief USM kind of the memory allocated by the pool.
+     *
+     * Unlike sycl::get_pointer_type() the lookup does not call the SYCL
+     * runtime. Only pointers returned by @ref malloc are known to the pool,
+     * pointers inside of the allocation are not recognized.
+     *
+     * @param [in]  ptr   Pointer returned by @ref malloc.
+     * @param [in]  ctx   SYCL context the pointer is queried for.
+     * @param [out] kind  USM memory kind.
+     *
+     * @return false if the pointer is not owned by the pool in the context.
+     */
+    bool get_pointer_type(const void *ptr,
+                          const sycl::context &ctx,
+                          sycl::usm::alloc &kind) const;
+
+    bool is_enabled() const
+    {
+        return enabled;
+    }
+
+    void set_numa_policy(NumaPolicy policy);
+    NumaPolicy get_numa_policy() const;
+
+    /**
+     * @brief Memory statistics.
+     *
+     * @param [in]  q      Count memory of the queue context and device only.
+     *                     nullptr means all queues.
+     * @param [in]  kind   Count memory of the USM kind only.
+     *                     sycl::usm::alloc::unknown means all kinds.
+     * @param [out] stats  Statistics. Peak of several pools is the sum of
+     *                     their peaks.
+     */
+    void get_stats(const sycl::queue *q,
+                   sycl::usm::alloc kind,
+                   DPNPMemoryStats &stats) const;
+
+    /// Set peaks to the live bytes, clear counters and named region peaks.
+    void reset_stats();
+
+    /**
+     * @brief Count bytes staged by @ref DPNPC_ptr_adapter.
+     *
+     * @param [in]  ptr            Staging memory returned by @ref malloc.
+     * @param [in]  size_in_bytes  Number of bytes copied.
+     */
+    void add_staged_bytes(const void *ptr, size_t size_in_bytes);
+
+    /**
+     * @brief Open memory region.
+     *
+     * Regions might be nested and belong to the calling thread. Peak of the
+     * memory allocated by the thread from all pools and not freed yet, by
+     * any thread, is tracked while the region is open.
+     *
+     * @param [in]  name  Name of the region.
+     */
+    void begin_region(const std::string &name);
+
+    /**
+     * @brief Close the innermost memory region of the calling thread.
+     *
+     * @return Peak number of bytes allocated above the level at the region
+     *         start.
+     */
+    size_t end_region();
+
+    /// Largest peak of the closed regions with the name.
+    size_t get_region_peak(const std::string &name) const;
+
+    /// Size of the block used by the pool for the allocation request.
+    static size_t get_size_class(size_t size_in_bytes);
+
+private:
+    DPNPC_memory_pool();
+
+    struct pool_key
+    {
+        sycl::context ctx;
+        sycl::device dev;
+        sycl::usm::alloc kind;
+
+        bool operator==(const pool_key &rhs) const
+        {
+            return (kind == rhs.kind) && (ctx == rhs.ctx) && (dev == rhs.dev);
+        }
+    };
+
+    struct pool_key_hash
+    {
+        size_t operator()(const pool_key &key) const
+        {
+            const size_t ctx_hash = std::hash<sycl::context>{}(key.ctx);
+            const size_t dev_hash = std::hash<sycl::device>{}(key.dev);
+            return ctx_hash ^ (dev_hash << 1) ^
+                   (static_cast<size_t>(key.kind) << 2);
+        }
+    };
+
+    struct pool_t
+    {
+        sycl::context ctx;
+        sycl::usm::alloc kind;
+        /**< free blocks by size class */
+        std::unordered_map<size_t, std::vector<void *>> free_blocks;
+        DPNPMemoryStats stats;
+    };
+
+    struct block_info
+    {
+        pool_t *pool;
+        size_t size_class;
+        size_t size_in_bytes; /**< requested size */
+        std::thread::id owner; /**< allocating thread */
+    };
+
+    struct region_t
+    {
+        std::string name;
+        size_t start_bytes;
+        size_t peak_bytes;
+    };
+
+    void release_blocks(pool_t &pool);
+    pool_t &get_pool(const sycl::queue &q, sycl::usm::alloc kind);
+    void count_malloc(pool_t &pool, size_t size_in_bytes);
+
+    /// Set placement of pages of a new block according to @ref numa_policy.
+    void place_pages(void *ptr, size_t size_in_bytes, const sycl::queue &q);
+
+    bool enabled;
+    std::atomic<NumaPolicy> numa_policy{NumaPolicy::NONE};
+    size_t high_water_mark;
+    size_t cached_bytes = 0;
+
+    mutable std::mutex mutex;
+    /**< unordered_map nodes are stable, block_info keeps pointer to pool_t */
+    std::unordered_map<pool_key, pool_t, pool_key_hash> pools;
+    std::unordered_map<void *, block_info> live_blocks;
+
+    /**< allocated from all pools by each thread, freed by any thread */
+    std::unordered_map<std::thread::id, size_t> thread_live_bytes;
+    /**< open regions of the calling thread */
+    static thread_local std::vector<region_t> regions;
+    std::unordered_map<std::string, size_t> region_peaks;
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Scoped memory region of @ref DPNPC_memory_pool.
+ *
+ * The region is opened by the constructor and closed by the destructor.
+ */
+class DPNPC_memory_region final
+{
+public:
+    explicit DPNPC_memory_region(const std::string &name)
+    {
+        DPNPC_memory_pool::get_instance().begin_region(name);
+    }
+
+    ~DPNPC_memory_region()
+    {
+        try {
+            DPNPC_memory_pool::get_instance().end_region();
+        } catch (const std::runtime_error &) {
+            // already closed by dpnp_memory_region_end_c, nothing to report
+        }
+    }
+
+    DPNPC_memory_region(const DPNPC_memory_region &) = delete;
+    DPNPC_memory_region &operator=(const DPNPC_memory_region &) = delete;
+};
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Typed allocation of temporary USM memory from the pool.
+ *
+ * Memory must be released by @ref dpnp_pool_free_async or
+ * @ref dpnp_memory_free_c.
+ *
+ * @param [in]  count  Number of elements.
+ * @param [in]  q      SYCL queue.
+ * @param [in]  kind   USM memory kind.
+ *
+ * @exception std::runtime_error  Out of memory.
+ */
+template <typename _DataType>
+_DataType *dpnp_pool_malloc(size_t count,
+                            const sycl::queue &q,
+                            sycl::usm::alloc kind)
+{
+    void *ptr = DPNPC_memory_pool::get_instance().malloc(
+        count * sizeof(_DataType), q, kind);
+    if (ptr == nullptr) {
+        throw std::runtime_error(
+            "DPNP Error: dpnp_pool_malloc() out of memory.");
+    }
+
+    return reinterpret_cast<_DataType *>(ptr);
+}
+
+/**
+ * @ingroup BACKEND_UTILS
+ * @brief Release memory when all dependencies are complete.
+ *
+ * Memory is released by the host task submitted into the queue. The function
+ * does not block.
+ *
+ * @param [in]  q     SYCL queue.
+ * @param [in]  ptrs  Pointers allocated by @ref dpnp_memory_alloc_c or
+ *                    @ref dpnp_pool_malloc.
+ * @param [in]  deps  Events the memory is used by.
+ *
+ * @return Event of the host task.
+ */
+sycl::event dpnp_pool_free_async(sycl::queue &q,
+                                  const std::vector<void *> &ptrs,
+                                  const std::vector<sycl::event> &deps);
+
+#endif // MEMORY_POOL_SYCL_H
@@ -26,11 +26,16 @@
 #include <cstring>
 #include <exception>
 #include <iostream>
+#include <string>
 
 #include "dpnp_iface.hpp"
+#include "dpnp_utils.hpp"
+#include "dpnpc_memory_adapter.hpp"
+#include "graph_sycl.hpp"
+#include "memory_pool_sycl.hpp"
 #include "queue_sycl.hpp"
 
-static bool use_sycl_device_memory()
+static bool get_sycl_device_memory_env()
 {
     // TODO need to move all getenv() into common dpnpc place
     char *dpnpc_memtype_device = nullptr;
@@ -54,6 +59,12 @@ static bool use_sycl_device_memory()
     return false;
 }
 
+static bool use_sycl_device_memory()
+{
+    static const bool use_device_memory = get_sycl_device_memory_env();
+    return use_device_memory;
+}
+
 // This variable is needed for the NumPy corner case
 // if we have zero memory array (ex. shape=(0,10)) we must keep the pointer to
 // somewhere memory of this variable must not be used
@@ -65,13 +76,14 @@ char *dpnp_memory_alloc_c(DPCTLSyclQueueRef q_ref, size_t size_in_bytes)
 
     // std::cout << "dpnp_memory_alloc_c(size=" << size_in_bytes << std::flush;
     if (size_in_bytes > 0) {
-        sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
+        sycl::queue &q = *(reinterpret_cast<sycl::queue *>(q_ref));
         sycl::usm::alloc memory_type = sycl::usm::alloc::shared;
         if (use_sycl_device_memory()) {
             memory_type = sycl::usm::alloc::device;
         }
         array = reinterpret_cast<char *>(
-            sycl::malloc(size_in_bytes, q, memory_type));
+            DPNPC_memory_pool::get_instance().malloc(size_in_bytes, q,
+                                                     memory_type));
         if (array == nullptr) {
             // TODO add information about number of allocated bytes
             throw std::runtime_error(
@@ -79,7 +91,12 @@ char *dpnp_memory_alloc_c(DPCTLSyclQueueRef q_ref, size_t size_in_bytes)
         }
 
 #if not defined(NDEBUG)
-        if (memory_type != sycl::usm::alloc::device) {
+        // with NumaPolicy::NONE this loop places new pages on the node of
+        // the allocating thread, pages of NumaPolicy::FIRST_TOUCH are left to
+        // the kernel touching them
+        const bool first_touch =
+            dpnp_memory_get_numa_policy_c() == NumaPolicy::FIRST_TOUCH;
+        if ((memory_type != sycl::usm::alloc::device) && !first_touch) {
             for (size_t i = 0; i < size_in_bytes / sizeof(char); ++i) {
                 array[i] = 0; // type dependant is better. set double(42.42)
                               // instead zero
@@ -98,13 +115,25 @@ char *dpnp_memory_alloc_c(size_t size_in_bytes)
     return dpnp_memory_alloc_c(q_ref, size_in_bytes);
 }
 
+static void memory_free(const sycl::context &ctx, void *ptr)
+{
+    if (ptr != numpy_stub) {
+        if (!DPNPC_memory_pool::get_instance().free(ptr)) {
+            sycl::free(ptr, ctx);
+        }
+    }
+}
+
 void dpnp_memory_free_c(DPCTLSyclQueueRef q_ref, void *ptr)
 {
     // std::cout << "dpnp_memory_free_c(ptr=" << (void*)ptr << ")" << std::endl;
-    sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
-    if (ptr != numpy_stub) {
-        sycl::free(ptr, q);
+    sycl::queue &q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    if (DPNPC_command_graph *graph = DPNPC_command_graph::get_capturing(q)) {
+        // recorded commands may still use the memory on replay
+        graph->adopt({ptr});
+        return;
     }
+    memory_free(q.get_context(), ptr);
 }
 
 void dpnp_memory_free_c(void *ptr)
@@ -113,6 +142,42 @@ void dpnp_memory_free_c(void *ptr)
     dpnp_memory_free_c(q_ref, ptr);
 }
 
+sycl::event dpnp_pool_free_async(sycl::queue &q,
+                                  const std::vector<void *> &ptrs,
+                                  const std::vector<sycl::event> &deps)
+{
+    if (DPNPC_command_graph *graph = DPNPC_command_graph::get_capturing(q)) {
+        // a recorded free would be executed again by each replay
+        graph->adopt(ptrs);
+        return sycl::event();
+    }
+
+    const sycl::context ctx = q.get_context();
+
+    return q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(deps);
+        cgh.host_task([ctx, ptrs]() {
+            for (void *ptr : ptrs) {
+                memory_free(ctx, ptr);
+            }
+        });
+    });
+}
+
+DPCTLSyclEventRef
+    dpnp_memory_free_async_c(DPCTLSyclQueueRef q_ref,
+                             void *ptr,
+                             const DPCTLEventVectorRef dep_event_vec_ref)
+{
+    sycl::queue &q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    const std::vector<sycl::event> deps = cast_event_vector(dep_event_vec_ref);
+
+    sycl::event event = dpnp_pool_free_async(q, {ptr}, deps);
+
+    DPCTLSyclEventRef event_ref = reinterpret_cast<DPCTLSyclEventRef>(&event);
+    return DPCTLEvent_Copy(event_ref);
+}
+
 void dpnp_memory_memcpy_c(DPCTLSyclQueueRef q_ref,
                           void *dst,
                           const void *src,
@@ -121,7 +186,11 @@ void dpnp_memory_memcpy_c(DPCTLSyclQueueRef q_ref,
     // std::cout << "dpnp_memory_memcpy_c(dst=" << dst << ", src=" << src << ")"
     // << std::endl;
     sycl::queue q = *(reinterpret_cast<sycl::queue *>(q_ref));
-    q.memcpy(dst, src, size_in_bytes).wait();
+    sycl::event event = q.memcpy(dst, src, size_in_bytes);
+    // a recorded copy is executed by the graph replay
+    if (!DPNPC_command_graph::get_capturing(q)) {
+        event.wait();
+    }
 }
 
 void dpnp_memory_memcpy_c(void *dst, const void *src, size_t size_in_bytes)
@@ -129,3 +198,86 @@ void dpnp_memory_memcpy_c(void *dst, const void *src, size_t size_in_bytes)
     DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&DPNP_QUEUE);
     dpnp_memory_memcpy_c(q_ref, dst, src, size_in_bytes);
 }
+
+void dpnp_memory_pool_trim_c(DPCTLSyclQueueRef q_ref)
+{
+    sycl::queue &q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    DPNPC_memory_pool::get_instance().trim(q.get_context());
+}
+
+void dpnp_memory_pool_trim_c()
+{
+    DPNPC_memory_pool::get_instance().trim();
+}
+
+void dpnp_memory_pool_set_high_water_mark_c(size_t size_in_bytes)
+{
+    DPNPC_memory_pool::get_instance().set_high_water_mark(size_in_bytes);
+}
+
+size_t dpnp_memory_pool_get_high_water_mark_c()
+{
+    return DPNPC_memory_pool::get_instance().get_high_water_mark();
+}
+
+void dpnp_memory_set_numa_policy_c(NumaPolicy policy)
+{
+    DPNPC_memory_pool::get_instance().set_numa_policy(policy);
+}
+
+NumaPolicy dpnp_memory_get_numa_policy_c()
+{
+    return DPNPC_memory_pool::get_instance().get_numa_policy();
+}
+
+size_t dpnp_memory_staged_bytes_c()
+{
+    return dpnpc_staged_bytes().load();
+}
+
+void dpnp_memory_stats_c(DPCTLSyclQueueRef q_ref,
+                         const char *usm_type,
+                         DPNPMemoryStats *stats)
+{
+    sycl::usm::alloc kind = sycl::usm::alloc::unknown;
+    if (usm_type != nullptr) {
+        const std::string type = usm_type;
+        if (type == "device") {
+            kind = sycl::usm::alloc::device;
+        }
+        else if (type == "shared") {
+            kind = sycl::usm::alloc::shared;
+        }
+        else if (type == "host") {
+            kind = sycl::usm::alloc::host;
+        }
+        else {
+            throw std::runtime_error("DPNP Error: dpnp_memory_stats_c() "
+                                     "unknown USM type " +
+                                     type);
+        }
+    }
+
+    const sycl::queue *q = reinterpret_cast<sycl::queue *>(q_ref);
+    DPNPC_memory_pool::get_instance().get_stats(q, kind, *stats);
+}
+
+void dpnp_memory_stats_reset_c()
+{
+    DPNPC_memory_pool::get_instance().reset_stats();
+}
+
+void dpnp_memory_region_begin_c(const char *name)
+{
+    DPNPC_memory_pool::get_instance().begin_region(name);
+}
+
+size_t dpnp_memory_region_end_c()
+{
+    return DPNPC_memory_pool::get_instance().end_region();
+}
+
+size_t dpnp_memory_region_peak_c(const char *name)
+{
+    return DPNPC_memory_pool::get_instance().get_region_peak(name);
+}
@@ -23,9 +23,11 @@
 // THE POSSIBILITY OF SUCH DAMAGE.
 //*****************************************************************************
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <iostream>
+#include <string>
 
 #include "dpnp_iface.hpp"
 #include "dpnp_utils.hpp"
@@ -36,6 +38,13 @@ sycl::queue *backend_sycl::queue = nullptr;
 #endif
 mkl_rng::mt19937 *backend_sycl::rng_engine = nullptr;
 mkl_rng::mcg59 *backend_sycl::rng_mcg59_engine = nullptr;
+thread_local std::unique_ptr<sycl::queue> backend_sycl::thread_queue;
+thread_local std::unique_ptr<mkl_rng::mt19937> backend_sycl::thread_rng_engine;
+thread_local std::unique_ptr<mkl_rng::mcg59>
+    backend_sycl::thread_rng_mcg59_engine;
+std::deque<sycl::queue> backend_sycl::sub_queues;
+size_t backend_sycl::sub_queues_first = 0;
+std::mutex backend_sycl::sub_queues_mutex;
 
 static void dpnpc_show_mathlib_version()
 {
@@ -215,6 +224,12 @@ void backend_sycl::backend_sycl_queue_init(QueueOptions selector)
 #endif
     std::cout << "SYCL kernels link time: " << time_kernels_link.count()
               << " (sec.)\n";
+#if defined(DPNP_SYCL_AOT_CPU_ISA)
+    std::cout << "SYCL kernels AOT compiled for CPU ISA: "
+              << DPNP_SYCL_AOT_CPU_ISA << "\n";
+#else
+    std::cout << "SYCL kernels JIT compiled\n";
+#endif
     dpnpc_show_mathlib_version();
 
     std::cout << std::endl;
@@ -231,8 +246,85 @@ bool backend_sycl::backend_sycl_is_cpu()
     return false;
 }
 
+void backend_sycl::bind_thread_queue(const sycl::queue *q)
+{
+    // engines of the previous queue can't be used with the new one
+    thread_rng_engine.reset();
+    thread_rng_mcg59_engine.reset();
+
+    if (q) {
+        thread_queue = std::make_unique<sycl::queue>(*q);
+    }
+    else {
+        thread_queue.reset();
+    }
+}
+
+size_t backend_sycl::create_numa_sub_queues(size_t count)
+{
+    const sycl::property_list properties{sycl::property::queue::in_order()};
+    const sycl::device dev = get_queue().get_device();
+
+    if (!dev.is_cpu()) {
+        throw std::runtime_error(
+            "DPNP Error: NUMA sub-queues require a CPU device, got " +
+            dev.get_info<sycl::info::device::name>());
+    }
+
+    std::vector<sycl::device> sub_devices;
+    const auto domains =
+        dev.get_info<sycl::info::device::partition_affinity_domains>();
+    if (std::find(domains.begin(), domains.end(),
+                  sycl::info::partition_affinity_domain::numa) !=
+        domains.end())
+    {
+        sub_devices = dev.create_sub_devices<
+            sycl::info::partition_property::partition_by_affinity_domain>(
+            sycl::info::partition_affinity_domain::numa);
+    }
+
+    if (sub_devices.empty()) {
+        sub_devices.push_back(dev);
+    }
+    if (sub_devices.size() > count) {
+        sub_devices.resize(count);
+    }
+
+    std::lock_guard<std::mutex> lock(sub_queues_mutex);
+    sub_queues_first = sub_queues.size();
+    if (!sub_devices.empty()) {
+        const sycl::context ctx(sub_devices);
+        for (const sycl::device &sub_device : sub_devices) {
+            sub_queues.emplace_back(ctx, sub_device, properties);
+        }
+    }
+
+    return sub_queues.size() - sub_queues_first;
+}
+
+sycl::queue &backend_sycl::get_sub_queue(size_t index)
+{
+    std::lock_guard<std::mutex> lock(sub_queues_mutex);
+    const size_t count = sub_queues.size() - sub_queues_first;
+    if (index >= count) {
+        throw std::runtime_error("DPNP Error: sub-queue index " +
+                                 std::to_string(index) + " is out of range " +
+                                 std::to_string(count));
+    }
+
+    return sub_queues[sub_queues_first + index];
+}
+
 void backend_sycl::backend_sycl_rng_engine_init(size_t seed)
 {
+    if (thread_queue) {
+        thread_rng_engine =
+            std::make_unique<mkl_rng::mt19937>(*thread_queue, seed);
+        thread_rng_mcg59_engine =
+            std::make_unique<mkl_rng::mcg59>(*thread_queue, seed);
+        return;
+    }
+
     if (rng_engine) {
         backend_sycl::destroy_rng_engine();
     }
@@ -249,3 +341,57 @@ size_t dpnp_queue_is_cpu_c()
 {
     return backend_sycl::backend_sycl_is_cpu();
 }
+
+void dpnp_queue_bind_thread_c(DPCTLSyclQueueRef q_ref)
+{
+    backend_sycl::bind_thread_queue(reinterpret_cast<sycl::queue *>(q_ref));
+}
+
+size_t dpnp_queue_create_numa_sub_queues_c(size_t count)
+{
+    return backend_sycl::create_numa_sub_queues(count);
+}
+
+DPCTLSyclQueueRef dpnp_queue_get_sub_queue_c(size_t index)
+{
+    return reinterpret_cast<DPCTLSyclQueueRef>(
+        &backend_sycl::get_sub_queue(index));
+}
+
+size_t dpnp_queue_warmup_c(DPCTLSyclQueueRef q_ref,
+                           const char *const *kernel_names,
+                           size_t count)
+{
+    sycl::queue &q = *(reinterpret_cast<sycl::queue *>(q_ref));
+    const sycl::device dev = q.get_device();
+
+    std::vector<sycl::kernel_id> kernel_ids;
+    for (const sycl::kernel_id &kernel_id : sycl::get_kernel_ids()) {
+        const std::string name = kernel_id.get_name();
+
+        bool selected = (kernel_names == nullptr);
+        for (size_t i = 0; !selected && (i < count); ++i) {
+            selected = (name.find(kernel_names[i]) != std::string::npos);
+        }
+
+        // kernels with aspects not supported by the device (fp64) are skipped
+        if (selected && sycl::is_compatible({kernel_id}, dev)) {
+            kernel_ids.push_back(kernel_id);
+        }
+    }
+
+    if (kernel_ids.empty()) {
+        return 0;
+    }
+
+    sycl::get_kernel_bundle<sycl::bundle_state::executable>(
+        q.get_context(), {dev}, kernel_ids);
+
+    return kernel_ids.size();
+}
+
+size_t dpnp_queue_warmup_c(const char *const *kernel_names, size_t count)
+{
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&DPNP_QUEUE);
+    return dpnp_queue_warmup_c(q_ref, kernel_names, count);
+}
@@ -39,6 +39,10 @@
 #pragma clang diagnostic pop
 
 #include <ctime>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #if !defined(DPNP_LOCAL_QUEUE)
 #if defined __has_include
@@ -79,6 +83,20 @@ class backend_sycl
     static mkl_rng::mcg59
         *rng_mcg59_engine; /**< RNG MCG59 engine ptr. initialized in @ref
                               backend_sycl_rng_engine_init */
+    static thread_local std::unique_ptr<sycl::queue>
+        thread_queue; /**< queue bound to the calling thread by @ref
+                         bind_thread_queue */
+    static thread_local std::unique_ptr<mkl_rng::mt19937>
+        thread_rng_engine; /**< RNG MT19937 engine over @ref thread_queue */
+    static thread_local std::unique_ptr<mkl_rng::mcg59>
+        thread_rng_mcg59_engine; /**< RNG MCG59 engine over @ref
+                                    thread_queue */
+    static std::deque<sycl::queue>
+        sub_queues; /**< queues over sub-devices created by all calls of
+                       @ref create_numa_sub_queues, never erased since
+                       references to them are given out */
+    static size_t sub_queues_first; /**< first queue of the last call */
+    static std::mutex sub_queues_mutex; /**< guards @ref sub_queues */
 
     static void destroy()
     {
@@ -130,15 +148,46 @@ public:
     static bool backend_sycl_is_cpu();
 
     /**
-     * Initialize @ref rng_engine and @ref rng_mcg59_engine
+     * Bind a copy of queue @ref q to the calling thread. @ref get_queue
+     * returns it for this thread until another queue is bound, and the RNG
+     * engines of the thread are created over it. Passing nullptr restores
+     * the default queue and engines for the thread.
+     */
+    static void bind_thread_queue(const sycl::queue *q);
+
+    /**
+     * Create up to @ref count in-order queues over the NUMA domains of the CPU
+     * device of the default queue. All of them share one context, so memory
+     * allocated on one of them is usable on the others. If the device can not
+     * be partitioned by NUMA domain a single queue over the whole device is
+     * created. Sub-queues of previous calls stay valid but are no longer
+     * returned by @ref get_sub_queue.
+     *
+     * @return Number of created queues.
+     */
+    static size_t create_numa_sub_queues(size_t count);
+
+    /**
+     * Return sub-queue @ref index created by @ref create_numa_sub_queues
+     */
+    static sycl::queue &get_sub_queue(size_t index);
+
+    /**
+     * Initialize @ref rng_engine and @ref rng_mcg59_engine, or the engines
+     * of the calling thread if it has a bound queue
      */
     static void backend_sycl_rng_engine_init(size_t seed = 1);
 
     /**
-     * Return the @ref queue to the user
+     * Return the @ref queue to the user. A queue bound to the calling thread
+     * by @ref bind_thread_queue takes precedence.
      */
     static sycl::queue &get_queue()
     {
+        if (thread_queue) {
+            return *thread_queue;
+        }
+
 #if defined(DPNP_LOCAL_QUEUE)
         if (!queue) {
             backend_sycl_queue_init();
@@ -163,10 +212,18 @@ public:
     }
 
     /**
-     * Return the @ref rng_engine to the user
+     * Return the @ref rng_engine to the user, the engine of the thread if
+     * it has a bound queue
      */
     static mkl_rng::mt19937 &get_rng_engine()
     {
+        if (thread_queue) {
+            if (!thread_rng_engine) {
+                backend_sycl_rng_engine_init();
+            }
+            return *thread_rng_engine;
+        }
+
         if (!rng_engine) {
             backend_sycl_rng_engine_init();
         }
@@ -174,10 +231,18 @@ public:
     }
 
     /**
-     * Return the @ref rng_mcg59_engine to the user
+     * Return the @ref rng_mcg59_engine to the user, the engine of the thread
+     * if it has a bound queue
      */
     static mkl_rng::mcg59 &get_rng_mcg59_engine()
     {
+        if (thread_queue) {
+            if (!thread_rng_mcg59_engine) {
+                backend_sycl_rng_engine_init();
+            }
+            return *thread_rng_mcg59_engine;
+        }
+
         if (!rng_engine) {
             backend_sycl_rng_engine_init();
         }
@@ -175,4 +175,9 @@ INSTANTIATE_TEST_SUITE_P(
                                                   5, 5, 5, 5, 6, 6, 6, 6}},
         IteratorParameters{{2, 1, 4}, {2, 3, 4}, {1, 2, 3, 4, 1, 2, 3, 4,
                                                   1, 2, 3, 4, 5, 6, 7, 8,
-                                                  5, 6, 7, 8, 5, 6, 7, 8}}));
+                                                  5, 6, 7, 8, 5, 6, 7, 8}},
+        // output shape metadata does not fit into the iterator metadata block
+        IteratorParameters{
+            {4},
+            {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 4},
+            {1, 2, 3, 4, 1, 2, 3, 4, 1, 2, 3, 4}}));
@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#include <gtest/gtest.h>
+
+#include <dpnp_iface.hpp>
+#include <dpnp_iface_fptr.hpp>
+
+#include <CL/sycl.hpp>
+
+typedef DPCTLSyclEventRef (*initval_ext_fptr_t)(DPCTLSyclQueueRef,
+                                                void *,
+                                                void *,
+                                                size_t,
+                                                const DPCTLEventVectorRef);
+
+static void capture_initval(void *graph,
+                            DPCTLSyclQueueRef q_ref,
+                            double *result,
+                            double value,
+                            size_t size)
+{
+    DPNPFuncData kernel_data =
+        get_dpnp_function_ptr(DPNPFuncName::DPNP_FN_INITVAL_EXT,
+                              DPNPFuncType::DPNP_FT_DOUBLE,
+                              DPNPFuncType::DPNP_FT_DOUBLE);
+    initval_ext_fptr_t initval =
+        reinterpret_cast<initval_ext_fptr_t>(kernel_data.ptr);
+
+    dpnp_graph_begin_capture_c(graph);
+    DPCTLSyclEventRef event_ref =
+        initval(q_ref, result, &value, size, nullptr);
+    DPCTLEvent_Delete(event_ref);
+    dpnp_graph_end_capture_c(graph);
+}
+
+TEST(TestCommandGraph, capture_and_replay)
+{
+#if !defined(SYCL_EXT_ONEAPI_GRAPH)
+    GTEST_SKIP() << "SYCL command graph is not supported";
+#endif
+
+    sycl::queue q;
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    const size_t size = 16;
+    double *result1 = sycl::malloc_shared<double>(size, q);
+    double *result2 = sycl::malloc_shared<double>(size, q);
+    q.fill<double>(result1, 0.0, size).wait();
+    q.fill<double>(result2, 0.0, size).wait();
+
+    void *graph = dpnp_graph_create_c(q_ref);
+    capture_initval(graph, q_ref, result1, 42.0, size);
+
+    // nothing is executed during capture
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(result1[i], 0.0);
+    }
+
+    DPCTLSyclEventRef event_ref = dpnp_graph_replay_c(graph, nullptr);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(result1[i], 42.0);
+    }
+
+    // same sequence of calls on other memory updates the graph
+    capture_initval(graph, q_ref, result2, 7.0, size);
+
+    event_ref = dpnp_graph_replay_c(graph, nullptr);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(result1[i], 42.0);
+        EXPECT_EQ(result2[i], 7.0);
+    }
+
+    dpnp_graph_delete_c(graph);
+    sycl::free(result1, q);
+    sycl::free(result2, q);
+}
+
+TEST(TestCommandGraph, replay_on_bound_memory)
+{
+#if !defined(SYCL_EXT_ONEAPI_GRAPH)
+    GTEST_SKIP() << "SYCL command graph is not supported";
+#endif
+
+    sycl::queue q;
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    const size_t size = 16;
+    double *captured = sycl::malloc_shared<double>(size, q);
+    double *bound = sycl::malloc_shared<double>(size, q);
+    q.fill<double>(captured, 0.0, size).wait();
+    q.fill<double>(bound, 0.0, size).wait();
+
+    void *graph = dpnp_graph_create_c(q_ref);
+    capture_initval(graph, q_ref, captured, 42.0, size);
+    dpnp_graph_bind_c(graph, captured, bound, size * sizeof(double),
+                      GraphBinding::OUTPUT);
+
+    DPCTLSyclEventRef event_ref = dpnp_graph_replay_c(graph, nullptr);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(bound[i], 42.0);
+    }
+
+    dpnp_graph_delete_c(graph);
+    sycl::free(captured, q);
+    sycl::free(bound, q);
+}
+
+TEST(TestCommandGraph, replay_fails_without_graph_support)
+{
+#if defined(SYCL_EXT_ONEAPI_GRAPH)
+    GTEST_SKIP() << "SYCL command graph is supported";
+#endif
+
+    sycl::queue q;
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    const size_t size = 16;
+    double *result = sycl::malloc_shared<double>(size, q);
+    q.fill<double>(result, 0.0, size).wait();
+
+    void *graph = dpnp_graph_create_c(q_ref);
+    capture_initval(graph, q_ref, result, 42.0, size);
+
+    // the calls are submitted during capture
+    q.wait();
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(result[i], 42.0);
+    }
+
+    // and can't be executed again
+    EXPECT_THROW(dpnp_graph_replay_c(graph, nullptr), std::runtime_error);
+
+    dpnp_graph_delete_c(graph);
+    sycl::free(result, q);
+}
@@ -0,0 +1,374 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <limits>
+#include <thread>
+
+#include <dpnp_iface.hpp>
+#include <dpnp_iface_fptr.hpp>
+
+#include <CL/sycl.hpp>
+
+typedef DPCTLSyclEventRef (*initval_ext_fptr_t)(DPCTLSyclQueueRef,
+                                                void *,
+                                                void *,
+                                                size_t,
+                                                const DPCTLEventVectorRef);
+
+typedef DPCTLSyclEventRef (*sum_ext_fptr_t)(DPCTLSyclQueueRef,
+                                            void *,
+                                            const void *,
+                                            const shape_elem_type *,
+                                            const size_t,
+                                            const shape_elem_type *,
+                                            const size_t,
+                                            const void *,
+                                            const long *,
+                                            const DPCTLEventVectorRef);
+
+typedef DPCTLSyclEventRef (*nansum_ext_fptr_t)(DPCTLSyclQueueRef,
+                                               void *,
+                                               const void *,
+                                               const shape_elem_type *,
+                                               const size_t,
+                                               const shape_elem_type *,
+                                               const size_t,
+                                               const DPCTLEventVectorRef);
+
+typedef DPCTLSyclEventRef (*argsort_ext_fptr_t)(DPCTLSyclQueueRef,
+                                                void *,
+                                                void *,
+                                                size_t,
+                                                const DPCTLEventVectorRef);
+
+typedef DPCTLSyclEventRef (*logic_ext_fptr_t)(DPCTLSyclQueueRef,
+                                              void *,
+                                              const size_t,
+                                              const size_t,
+                                              const shape_elem_type *,
+                                              const shape_elem_type *,
+                                              const void *,
+                                              const size_t,
+                                              const size_t,
+                                              const shape_elem_type *,
+                                              const shape_elem_type *,
+                                              const void *,
+                                              const size_t,
+                                              const size_t,
+                                              const shape_elem_type *,
+                                              const shape_elem_type *,
+                                              const size_t *,
+                                              const DPCTLEventVectorRef);
+
+// host task which blocks until gate_open is set. Kernels that honour their
+// dependencies must not start before that.
+static sycl::event submit_gate(sycl::queue &q, std::atomic<bool> &gate_open)
+{
+    return q.submit([&](sycl::handler &cgh) {
+        cgh.host_task([&gate_open]() {
+            while (!gate_open.load()) {
+                std::this_thread::yield();
+            }
+        });
+    });
+}
+
+TEST(TestDepEvents, initval_waits_for_dependencies)
+{
+    // out-of-order queue: the order comes from dependencies only
+    sycl::queue q;
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    DPNPFuncData kernel_data =
+        get_dpnp_function_ptr(DPNPFuncName::DPNP_FN_INITVAL_EXT,
+                              DPNPFuncType::DPNP_FT_DOUBLE,
+                              DPNPFuncType::DPNP_FT_DOUBLE);
+    initval_ext_fptr_t initval =
+        reinterpret_cast<initval_ext_fptr_t>(kernel_data.ptr);
+    ASSERT_NE(initval, nullptr);
+
+    const size_t size = 16;
+    double *result = sycl::malloc_shared<double>(size, q);
+    q.fill<double>(result, 0.0, size).wait();
+
+    std::atomic<bool> gate_open{false};
+    sycl::event gate = submit_gate(q, gate_open);
+
+    DPCTLSyclEventRef gate_ref = reinterpret_cast<DPCTLSyclEventRef>(&gate);
+    DPCTLEventVectorRef dep_event_vec_ref =
+        DPCTLEventVector_CreateFromArray(1, &gate_ref);
+
+    double value = 42.0;
+    DPCTLSyclEventRef event_ref =
+        initval(q_ref, result, &value, size, dep_event_vec_ref);
+    DPCTLEventVector_Delete(dep_event_vec_ref);
+
+    // the call returns without waiting and the kernel is still blocked
+    ASSERT_NE(event_ref, nullptr);
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(result[i], 0.0);
+    }
+
+    gate_open.store(true);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(result[i], value);
+    }
+
+    sycl::free(result, q);
+}
+
+TEST(TestDepEvents, broadcast_equal_waits_for_dependencies)
+{
+    sycl::queue q;
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    DPNPFuncData kernel_data = get_dpnp_function_ptr(
+        DPNPFuncName::DPNP_FN_EQUAL_EXT, DPNPFuncType::DPNP_FT_LONG,
+        DPNPFuncType::DPNP_FT_LONG);
+    logic_ext_fptr_t equal =
+        reinterpret_cast<logic_ext_fptr_t>(kernel_data.ptr);
+    ASSERT_NE(equal, nullptr);
+
+    // (3, 4) == (4,)
+    const shape_elem_type input1_shape[] = {3, 4};
+    const shape_elem_type input1_strides[] = {4, 1};
+    const shape_elem_type input2_shape[] = {4};
+    const shape_elem_type input2_strides[] = {1};
+    const size_t size = 12;
+
+    int64_t *input1 = sycl::malloc_shared<int64_t>(size, q);
+    int64_t *input2 = sycl::malloc_shared<int64_t>(4, q);
+    bool *result = sycl::malloc_shared<bool>(size, q);
+    for (size_t i = 0; i < size; ++i) {
+        input1[i] = i % 4;
+        result[i] = false;
+    }
+
+    std::atomic<bool> gate_open{false};
+    sycl::event gate = submit_gate(q, gate_open);
+    // input2 is written by a dependency of the call
+    sycl::event fill = q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(gate);
+        cgh.parallel_for(sycl::range<1>(4),
+                         [=](sycl::id<1> i) { input2[i] = i[0]; });
+    });
+
+    DPCTLSyclEventRef fill_ref = reinterpret_cast<DPCTLSyclEventRef>(&fill);
+    DPCTLEventVectorRef dep_event_vec_ref =
+        DPCTLEventVector_CreateFromArray(1, &fill_ref);
+
+    DPCTLSyclEventRef event_ref =
+        equal(q_ref, result, size, 2, input1_shape, input1_strides, input1,
+              size, 2, input1_shape, input1_strides, input2, 4, 1,
+              input2_shape, input2_strides, nullptr, dep_event_vec_ref);
+    DPCTLEventVector_Delete(dep_event_vec_ref);
+
+    ASSERT_NE(event_ref, nullptr);
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_FALSE(result[i]);
+    }
+
+    gate_open.store(true);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_TRUE(result[i]);
+    }
+
+    sycl::free(result, q);
+    sycl::free(input2, q);
+    sycl::free(input1, q);
+}
+
+TEST(TestDepEvents, sum_waits_for_dependencies)
+{
+    sycl::queue q;
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    DPNPFuncData kernel_data = get_dpnp_function_ptr(
+        DPNPFuncName::DPNP_FN_SUM_EXT, DPNPFuncType::DPNP_FT_DOUBLE,
+        DPNPFuncType::DPNP_FT_DOUBLE);
+    sum_ext_fptr_t sum = reinterpret_cast<sum_ext_fptr_t>(kernel_data.ptr);
+    ASSERT_NE(sum, nullptr);
+
+    // (4, 8) summed over axis 1
+    const shape_elem_type shape[] = {4, 8};
+    const shape_elem_type axes[] = {1};
+    const size_t size = 32;
+
+    double *input = sycl::malloc_shared<double>(size, q);
+    double *result = sycl::malloc_shared<double>(4, q);
+    q.fill<double>(input, 0.0, size).wait();
+    q.fill<double>(result, -1.0, 4).wait();
+
+    std::atomic<bool> gate_open{false};
+    sycl::event gate = submit_gate(q, gate_open);
+    sycl::event fill = q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(gate);
+        cgh.parallel_for(sycl::range<1>(size),
+                         [=](sycl::id<1> i) { input[i] = 1.0; });
+    });
+
+    DPCTLSyclEventRef fill_ref = reinterpret_cast<DPCTLSyclEventRef>(&fill);
+    DPCTLEventVectorRef dep_event_vec_ref =
+        DPCTLEventVector_CreateFromArray(1, &fill_ref);
+
+    DPCTLSyclEventRef event_ref = sum(q_ref, result, input, shape, 2, axes, 1,
+                                      nullptr, nullptr, dep_event_vec_ref);
+    DPCTLEventVector_Delete(dep_event_vec_ref);
+
+    ASSERT_NE(event_ref, nullptr);
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(result[i], -1.0);
+    }
+
+    gate_open.store(true);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(result[i], 8.0);
+    }
+
+    sycl::free(result, q);
+    sycl::free(input, q);
+}
+
+TEST(TestDepEvents, nansum_waits_for_dependencies)
+{
+    sycl::queue q;
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    DPNPFuncData kernel_data = get_dpnp_function_ptr(
+        DPNPFuncName::DPNP_FN_NANSUM_EXT, DPNPFuncType::DPNP_FT_DOUBLE,
+        DPNPFuncType::DPNP_FT_DOUBLE);
+    nansum_ext_fptr_t nansum =
+        reinterpret_cast<nansum_ext_fptr_t>(kernel_data.ptr);
+    ASSERT_NE(nansum, nullptr);
+
+    // (4, 8) summed over axis 1, odd elements are NaN
+    const shape_elem_type shape[] = {4, 8};
+    const shape_elem_type axes[] = {1};
+    const size_t size = 32;
+
+    double *input = sycl::malloc_shared<double>(size, q);
+    double *result = sycl::malloc_shared<double>(4, q);
+    q.fill<double>(input, 0.0, size).wait();
+    q.fill<double>(result, -1.0, 4).wait();
+
+    std::atomic<bool> gate_open{false};
+    sycl::event gate = submit_gate(q, gate_open);
+    sycl::event fill = q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(gate);
+        cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> i) {
+            input[i] = (i[0] % 2) ? std::numeric_limits<double>::quiet_NaN()
+                                  : 1.0;
+        });
+    });
+
+    DPCTLSyclEventRef fill_ref = reinterpret_cast<DPCTLSyclEventRef>(&fill);
+    DPCTLEventVectorRef dep_event_vec_ref =
+        DPCTLEventVector_CreateFromArray(1, &fill_ref);
+
+    DPCTLSyclEventRef event_ref =
+        nansum(q_ref, result, input, shape, 2, axes, 1, dep_event_vec_ref);
+    DPCTLEventVector_Delete(dep_event_vec_ref);
+
+    ASSERT_NE(event_ref, nullptr);
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(result[i], -1.0);
+    }
+
+    gate_open.store(true);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(result[i], 4.0);
+    }
+
+    sycl::free(result, q);
+    sycl::free(input, q);
+}
+
+TEST(TestDepEvents, argsort_waits_for_dependencies)
+{
+    sycl::queue q;
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    DPNPFuncData kernel_data = get_dpnp_function_ptr(
+        DPNPFuncName::DPNP_FN_ARGSORT_EXT, DPNPFuncType::DPNP_FT_DOUBLE,
+        DPNPFuncType::DPNP_FT_DOUBLE);
+    argsort_ext_fptr_t argsort =
+        reinterpret_cast<argsort_ext_fptr_t>(kernel_data.ptr);
+    ASSERT_NE(argsort, nullptr);
+
+    const size_t size = 64;
+    double *input = sycl::malloc_shared<double>(size, q);
+    int64_t *result = sycl::malloc_shared<int64_t>(size, q);
+    q.fill<double>(input, 0.0, size).wait();
+    q.fill<int64_t>(result, -1, size).wait();
+
+    std::atomic<bool> gate_open{false};
+    sycl::event gate = submit_gate(q, gate_open);
+    // descending input is written by a dependency of the call
+    sycl::event fill = q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(gate);
+        cgh.parallel_for(sycl::range<1>(size), [=](sycl::id<1> i) {
+            input[i] = static_cast<double>(size - i[0]);
+        });
+    });
+
+    DPCTLSyclEventRef fill_ref = reinterpret_cast<DPCTLSyclEventRef>(&fill);
+    DPCTLEventVectorRef dep_event_vec_ref =
+        DPCTLEventVector_CreateFromArray(1, &fill_ref);
+
+    DPCTLSyclEventRef event_ref =
+        argsort(q_ref, input, result, size, dep_event_vec_ref);
+    DPCTLEventVector_Delete(dep_event_vec_ref);
+
+    ASSERT_NE(event_ref, nullptr);
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(result[i], -1);
+    }
+
+    gate_open.store(true);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(result[i], static_cast<int64_t>(size - 1 - i));
+    }
+
+    sycl::free(result, q);
+    sycl::free(input, q);
+}
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <dpnp_iface.hpp>
+#include <dpnp_iface_fptr.hpp>
+
+TEST(TestFuncMap, lazy_lookup)
+{
+    // the first lookup registers the kernel family of the function
+    DPNPFuncData_t data = get_dpnp_function_ptr(
+        DPNPFuncName::DPNP_FN_ARANGE, DPNPFuncType::DPNP_FT_DOUBLE);
+    EXPECT_NE(data.ptr, nullptr);
+    EXPECT_EQ(data.return_type, DPNPFuncType::DPNP_FT_DOUBLE);
+
+    // second type defaults to the first one
+    DPNPFuncData_t data_same = get_dpnp_function_ptr(
+        DPNPFuncName::DPNP_FN_ARANGE, DPNPFuncType::DPNP_FT_DOUBLE,
+        DPNPFuncType::DPNP_FT_DOUBLE);
+    EXPECT_EQ(data_same.ptr, data.ptr);
+
+    EXPECT_THROW(get_dpnp_function_ptr(DPNPFuncName::DPNP_FN_LAST,
+                                       DPNPFuncType::DPNP_FT_DOUBLE),
+                 std::runtime_error);
+    EXPECT_THROW(get_dpnp_function_ptr(DPNPFuncName::DPNP_FN_ARANGE,
+                                       DPNPFuncType::DPNP_FT_NONE),
+                 std::runtime_error);
+}
+
+TEST(TestFuncMap, register_all)
+{
+    const size_t count = dpnp_func_map_register_all_c();
+    EXPECT_GT(count, 0);
+    EXPECT_LT(count, static_cast<size_t>(DPNPFuncName::DPNP_FN_LAST));
+
+    // registration is done once
+    EXPECT_EQ(dpnp_func_map_register_all_c(), count);
+}
+
+TEST(TestFuncMap, warmup)
+{
+    const char *kernel_names[] = {"dpnp_arange_c_kernel"};
+
+    EXPECT_GT(dpnp_queue_warmup_c(kernel_names, 1), 0);
+
+    const char *unknown_names[] = {"no_such_kernel_name"};
+    EXPECT_EQ(dpnp_queue_warmup_c(unknown_names, 1), 0);
+}
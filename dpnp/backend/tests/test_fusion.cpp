@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <dpnp_iface.hpp>
+
+#include "dpnp_fusion.hpp"
+
+template <typename _DataType>
+static _DataType *alloc_array(size_t size)
+{
+    return reinterpret_cast<_DataType *>(
+        dpnp_memory_alloc_c(size * sizeof(_DataType)));
+}
+
+TEST(TestFusion, expression_matches_backend_functions)
+{
+    using namespace dpnp_fusion;
+
+    const size_t size = 1000;
+    const std::vector<shape_elem_type> shape = {static_cast<long>(size)};
+    const std::vector<shape_elem_type> strides = {1};
+
+    double *x = alloc_array<double>(size);
+    double *y = alloc_array<double>(size);
+    double *sum = alloc_array<double>(size);
+    double *expected = alloc_array<double>(size);
+    double *result1 = alloc_array<double>(size);
+    double *result2 = alloc_array<double>(size);
+
+    for (size_t i = 0; i < size; ++i) {
+        x[i] = 1.0 + i;
+        y[i] = 0.5 * i;
+    }
+
+    // sum = x + y, expected = sqrt(sum) by separate backend calls
+    dpnp_add_c<double, double, double>(
+        sum, size, 1, shape.data(), strides.data(), x, size, 1, shape.data(),
+        strides.data(), y, size, 1, shape.data(), strides.data(), nullptr);
+    dpnp_sqrt_c<double, double>(expected, size, 1, shape.data(),
+                                strides.data(), sum, size, 1, shape.data(),
+                                strides.data(), nullptr);
+
+    const auto fused_sum = input(x) + input(y);
+    evaluate(size, assign(result1, dpnp_sqrt_c(fused_sum)),
+             assign(result2, 2.0 * fused_sum - 1.0));
+
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_DOUBLE_EQ(result1[i], expected[i]);
+        EXPECT_DOUBLE_EQ(result2[i], 2.0 * sum[i] - 1.0);
+    }
+
+    dpnp_memory_free_c(result2);
+    dpnp_memory_free_c(result1);
+    dpnp_memory_free_c(expected);
+    dpnp_memory_free_c(sum);
+    dpnp_memory_free_c(y);
+    dpnp_memory_free_c(x);
+}
+
+TEST(TestFusion, in_place_and_integer_types)
+{
+    using namespace dpnp_fusion;
+
+    const size_t size = 100;
+    long *x = alloc_array<long>(size);
+    double *result = alloc_array<double>(size);
+
+    for (size_t i = 0; i < size; ++i) {
+        x[i] = static_cast<long>(i) - 50;
+    }
+
+    // integer operations keep the integer type, x is read and stored
+    evaluate(size, assign(result, dpnp_exp2_c(dpnp_sign_c(input(x)))),
+             assign(x, dpnp_square_c(input(x)) + 1));
+
+    for (size_t i = 0; i < size; ++i) {
+        const long value = static_cast<long>(i) - 50;
+        EXPECT_EQ(x[i], value * value + 1);
+        EXPECT_DOUBLE_EQ(result[i], std::exp2((value > 0) - (value < 0)));
+    }
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(x);
+}
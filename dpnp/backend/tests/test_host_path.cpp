@@ -0,0 +1,172 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include <dpnp_iface.hpp>
+#include <dpnp_iface_fptr.hpp>
+
+#include <CL/sycl.hpp>
+
+TEST(TestHostPath, calibration_file)
+{
+    const char *file_name = "test_host_path_calibration.txt";
+    {
+        std::ofstream file(file_name);
+        file << "# comment" << std::endl;
+        file << "default 17" << std::endl;
+        file << "dpnp_add_c 1024" << std::endl;
+    }
+
+    dpnp_host_path_load_c(file_name);
+    EXPECT_EQ(dpnp_host_path_get_threshold_c("dpnp_add_c"), 1024u);
+    EXPECT_EQ(dpnp_host_path_get_threshold_c("dpnp_sin_c"), 17u);
+
+    dpnp_host_path_set_threshold_c("dpnp_add_c", 3);
+    dpnp_host_path_save_c(file_name);
+    dpnp_host_path_set_threshold_c("dpnp_add_c", 5);
+
+    dpnp_host_path_load_c(file_name);
+    EXPECT_EQ(dpnp_host_path_get_threshold_c("dpnp_add_c"), 3u);
+
+    std::remove(file_name);
+    dpnp_host_path_set_threshold_c("default", 256);
+    dpnp_host_path_set_threshold_c("dpnp_add_c", 256);
+}
+
+TEST(TestHostPath, malformed_calibration_is_not_taken)
+{
+    const char *file_name = "test_host_path_malformed.txt";
+    {
+        std::ofstream file(file_name);
+        file << "dpnp_add_c 1024" << std::endl;
+        file << "dpnp_sin_c many" << std::endl;
+    }
+
+    const size_t threshold = dpnp_host_path_get_threshold_c("dpnp_add_c");
+    EXPECT_THROW(dpnp_host_path_load_c(file_name), std::runtime_error);
+    EXPECT_EQ(dpnp_host_path_get_threshold_c("dpnp_add_c"), threshold);
+    EXPECT_THROW(dpnp_host_path_load_c("no_such_calibration.txt"),
+                 std::runtime_error);
+
+    std::remove(file_name);
+}
+
+TEST(TestHostPath, same_result_on_both_paths)
+{
+    const size_t size = 64;
+    double *result = reinterpret_cast<double *>(
+        dpnp_memory_alloc_c(size * sizeof(double)));
+    double value = 3.0;
+
+    for (size_t threshold : {size_t(0), size}) {
+        dpnp_host_path_set_threshold_c("dpnp_initval_c", threshold);
+        dpnp_initval_c<double>(result, &value, size);
+
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(result[i], value);
+        }
+        value += 1.0;
+    }
+
+    dpnp_host_path_set_threshold_c("dpnp_initval_c", 256);
+    dpnp_memory_free_c(result);
+}
+
+TEST(TestHostPath, pending_dependency_is_not_waited_for)
+{
+    typedef DPCTLSyclEventRef (*initval_ext_fptr_t)(
+        DPCTLSyclQueueRef, void *, void *, size_t, const DPCTLEventVectorRef);
+
+    // out-of-order queue of a CPU device, where the host path is allowed
+    sycl::device device;
+    try {
+        device = sycl::device(sycl::cpu_selector());
+    } catch (const sycl::exception &) {
+        GTEST_SKIP() << "no CPU device";
+    }
+    sycl::queue q(device);
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    DPNPFuncData kernel_data =
+        get_dpnp_function_ptr(DPNPFuncName::DPNP_FN_INITVAL_EXT,
+                              DPNPFuncType::DPNP_FT_DOUBLE,
+                              DPNPFuncType::DPNP_FT_DOUBLE);
+    initval_ext_fptr_t initval =
+        reinterpret_cast<initval_ext_fptr_t>(kernel_data.ptr);
+
+    const size_t size = 8;
+    dpnp_host_path_set_threshold_c("dpnp_initval_c", size);
+
+    double *result = sycl::malloc_shared<double>(size, q);
+    q.fill<double>(result, 0.0, size).wait();
+
+    std::atomic<bool> gate_open{false};
+    sycl::event gate = q.submit([&](sycl::handler &cgh) {
+        cgh.host_task([&gate_open]() {
+            while (!gate_open.load()) {
+                std::this_thread::yield();
+            }
+        });
+    });
+
+    DPCTLSyclEventRef gate_ref = reinterpret_cast<DPCTLSyclEventRef>(&gate);
+    DPCTLEventVectorRef dep_event_vec_ref =
+        DPCTLEventVector_CreateFromArray(1, &gate_ref);
+
+    // returns while the gate is closed, the fill is submitted to the queue
+    double value = 5.0;
+    DPCTLSyclEventRef event_ref =
+        initval(q_ref, result, &value, size, dep_event_vec_ref);
+    DPCTLEventVector_Delete(dep_event_vec_ref);
+
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(result[i], 0.0);
+    }
+
+    gate_open.store(true);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(result[i], value);
+    }
+
+    // complete dependencies still take the host path
+    value = 6.0;
+    dep_event_vec_ref = DPCTLEventVector_CreateFromArray(1, &gate_ref);
+    event_ref = initval(q_ref, result, &value, size, dep_event_vec_ref);
+    DPCTLEventVector_Delete(dep_event_vec_ref);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+    EXPECT_EQ(result[0], value);
+
+    dpnp_host_path_set_threshold_c("dpnp_initval_c", 256);
+    sycl::free(result, q);
+}
@@ -0,0 +1,149 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <dpnp_iface.hpp>
+
+#include "launch_tuner.hpp"
+#include "queue_sycl.hpp"
+
+TEST(TestLaunchTuner, type_names)
+{
+    EXPECT_EQ(dpnp_launch_type_name<bool>(), "b1");
+    EXPECT_EQ(dpnp_launch_type_name<int>(), "i4");
+    EXPECT_EQ(dpnp_launch_type_name<size_t>(), "u8");
+    EXPECT_EQ(dpnp_launch_type_name<double>(), "f8");
+    EXPECT_EQ(dpnp_launch_type_name<std::complex<float>>(), "c8");
+}
+
+TEST(TestLaunchTuner, tuned_params_are_cached)
+{
+    const char *file_name = "test_launch_tuner_cache.txt";
+    const size_t size = DPNPC_launch_tuner::min_tuning_size;
+    DPNPC_launch_tuner &tuner = DPNPC_launch_tuner::get_instance();
+
+    size_t runs = 0;
+    auto run = [&](const dpnp_launch_params &) {
+        ++runs;
+        return sycl::event();
+    };
+
+    tuner.set_tuning(true);
+    const dpnp_launch_params tuned =
+        tuner.get(DPNP_QUEUE, "test_op", "f8", size, run);
+    EXPECT_GT(runs, 0u);
+
+    runs = 0;
+    dpnp_launch_params cached =
+        tuner.get(DPNP_QUEUE, "test_op", "f8", size, run);
+    EXPECT_EQ(runs, 0u);
+    EXPECT_EQ(cached.lws, tuned.lws);
+    EXPECT_EQ(cached.vec_sz, tuned.vec_sz);
+
+    tuner.save(file_name);
+    tuner.set_tuning(false);
+    tuner.load(file_name);
+    cached = tuner.get(DPNP_QUEUE, "test_op", "f8", size, run);
+    EXPECT_EQ(runs, 0u);
+    EXPECT_EQ(cached.lws, tuned.lws);
+    EXPECT_EQ(cached.vec_sz, tuned.vec_sz);
+
+    // small arrays are not tuned
+    cached = tuner.get(DPNP_QUEUE, "test_op", "f8", 16, run);
+    EXPECT_EQ(runs, 0u);
+    EXPECT_EQ(cached.lws, DPNPC_launch_tuner::default_params.lws);
+
+    std::remove(file_name);
+}
+
+TEST(TestLaunchTuner, malformed_cache_is_not_taken)
+{
+    const char *file_name = "test_launch_tuner_malformed.txt";
+    const size_t size = DPNPC_launch_tuner::min_tuning_size;
+    DPNPC_launch_tuner &tuner = DPNPC_launch_tuner::get_instance();
+    const std::string device =
+        DPNP_QUEUE.get_device().get_info<sycl::info::device::name>() + "; " +
+        DPNP_QUEUE.get_device()
+            .get_info<sycl::info::device::driver_version>();
+
+    {
+        std::ofstream file(file_name);
+        file << "test_malformed_op f8 16 256 16 " << device << "\n";
+        file << "test_malformed_op f4 16 256 5 " << device << "\n";
+    }
+
+    EXPECT_THROW(tuner.load(file_name), std::runtime_error);
+
+    size_t runs = 0;
+    auto run = [&](const dpnp_launch_params &) {
+        ++runs;
+        return sycl::event();
+    };
+    tuner.set_tuning(false);
+    const dpnp_launch_params params =
+        tuner.get(DPNP_QUEUE, "test_malformed_op", "f8", size, run);
+    EXPECT_EQ(params.lws, DPNPC_launch_tuner::default_params.lws);
+    EXPECT_EQ(params.vec_sz, DPNPC_launch_tuner::default_params.vec_sz);
+
+    std::remove(file_name);
+}
+
+TEST(TestLaunchTuner, tuning_keeps_inplace_result)
+{
+    const size_t size = DPNPC_launch_tuner::min_tuning_size + 3;
+    const std::vector<shape_elem_type> shape = {static_cast<long>(size)};
+    const std::vector<shape_elem_type> strides = {1};
+
+    double *input1 = reinterpret_cast<double *>(
+        dpnp_memory_alloc_c(size * sizeof(double)));
+    double *input2 = reinterpret_cast<double *>(
+        dpnp_memory_alloc_c(size * sizeof(double)));
+
+    for (size_t i = 0; i < size; ++i) {
+        input1[i] = i;
+        input2[i] = 1.0;
+    }
+
+    // result overwrites input1, measured runs must not accumulate into it
+    dpnp_launch_tuning_enable_c(1);
+    dpnp_add_c<double, double, double>(
+        input1, size, 1, shape.data(), strides.data(), input1, size, 1,
+        shape.data(), strides.data(), input2, size, 1, shape.data(),
+        strides.data(), nullptr);
+    dpnp_launch_tuning_enable_c(0);
+
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(input1[i], i + 1.0);
+    }
+
+    dpnp_memory_free_c(input2);
+    dpnp_memory_free_c(input1);
+}
@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#include <gtest/gtest.h>
+
+#include <dpnp_iface.hpp>
+
+// TODO need to fix build procedure and remove this workaround. Issue #551
+#define DPNP_LOCAL_QUEUE 1
+#include "dpnpc_memory_adapter.hpp"
+
+TEST(TestMemoryAdapter, device_memory_for_host_access)
+{
+    sycl::queue q;
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    const size_t size = 64;
+    int *data = sycl::malloc_device<int>(size, q);
+    q.fill<int>(data, 7, size).wait();
+
+    const size_t staged_before = dpnp_memory_staged_bytes_c();
+    {
+        DPNPC_ptr_adapter<int> data_ptr(q_ref, data, size, true);
+        int *host_data = data_ptr.get_ptr();
+
+        if (q.get_device().is_cpu()) {
+            // device memory of CPU device is addressable by the host
+            EXPECT_EQ(host_data, data);
+            EXPECT_EQ(dpnp_memory_staged_bytes_c(), staged_before);
+        }
+        else {
+            EXPECT_NE(host_data, data);
+            EXPECT_EQ(dpnp_memory_staged_bytes_c(),
+                      staged_before + size * sizeof(int));
+        }
+
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(host_data[i], 7);
+        }
+    }
+
+    sycl::free(data, q);
+}
+
+TEST(TestMemoryAdapter, shared_memory_is_not_staged)
+{
+    sycl::queue q;
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&q);
+
+    const size_t size = 64;
+    int *data = reinterpret_cast<int *>(
+        dpnp_memory_alloc_c(q_ref, size * sizeof(int)));
+    if (sycl::get_pointer_type(data, q.get_context()) ==
+        sycl::usm::alloc::device) {
+        dpnp_memory_free_c(q_ref, data);
+        GTEST_SKIP() << "backend is configured to allocate device memory";
+    }
+
+    const size_t staged_before = dpnp_memory_staged_bytes_c();
+    {
+        DPNPC_ptr_adapter<int> data_ptr(q_ref, data, size, true, true);
+        EXPECT_EQ(data_ptr.get_ptr(), data);
+    }
+    EXPECT_EQ(dpnp_memory_staged_bytes_c(), staged_before);
+
+    dpnp_memory_free_c(q_ref, data);
+}
@@ -0,0 +1,334 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "memory_pool_sycl.hpp"
+
+TEST(TestMemoryPool, size_class)
+{
+    EXPECT_EQ(DPNPC_memory_pool::get_size_class(1),
+              DPNPC_memory_pool::min_block_size);
+    EXPECT_EQ(DPNPC_memory_pool::get_size_class(256), 256);
+    EXPECT_EQ(DPNPC_memory_pool::get_size_class(257), 512);
+    EXPECT_EQ(DPNPC_memory_pool::get_size_class(1024 * 1024), 1024 * 1024);
+    EXPECT_EQ(DPNPC_memory_pool::get_size_class(1024 * 1024 + 1),
+              DPNPC_memory_pool::large_block_granularity);
+    EXPECT_EQ(DPNPC_memory_pool::get_size_class(5 * 1024 * 1024),
+              3 * DPNPC_memory_pool::large_block_granularity);
+}
+
+TEST(TestMemoryPool, reuse_and_trim)
+{
+    DPNPC_memory_pool &pool = DPNPC_memory_pool::get_instance();
+    if (!pool.is_enabled()) {
+        GTEST_SKIP() << "memory pool is disabled";
+    }
+
+    sycl::queue q;
+    pool.trim();
+
+    void *ptr = pool.malloc(1000, q, sycl::usm::alloc::shared);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_TRUE(pool.free(ptr));
+    EXPECT_EQ(pool.get_cached_bytes(), 1024);
+
+    // same size class must reuse the block
+    void *ptr_reused = pool.malloc(900, q, sycl::usm::alloc::shared);
+    EXPECT_EQ(ptr_reused, ptr);
+    EXPECT_EQ(pool.get_cached_bytes(), 0);
+    EXPECT_TRUE(pool.free(ptr_reused));
+
+    pool.trim(q.get_context());
+    EXPECT_EQ(pool.get_cached_bytes(), 0);
+
+    // pointer not allocated by the pool
+    int dummy = 0;
+    EXPECT_FALSE(pool.free(&dummy));
+}
+
+TEST(TestMemoryPool, high_water_mark)
+{
+    DPNPC_memory_pool &pool = DPNPC_memory_pool::get_instance();
+    if (!pool.is_enabled()) {
+        GTEST_SKIP() << "memory pool is disabled";
+    }
+
+    sycl::queue q;
+    pool.trim();
+
+    const size_t old_mark = pool.get_high_water_mark();
+    pool.set_high_water_mark(0);
+
+    void *ptr = pool.malloc(4096, q, sycl::usm::alloc::device);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_TRUE(pool.free(ptr));
+    EXPECT_EQ(pool.get_cached_bytes(), 0);
+
+    pool.set_high_water_mark(old_mark);
+}
+
+TEST(TestMemoryPool, free_async)
+{
+    DPNPC_memory_pool &pool = DPNPC_memory_pool::get_instance();
+    if (!pool.is_enabled()) {
+        GTEST_SKIP() << "memory pool is disabled";
+    }
+
+    sycl::queue q;
+    pool.trim();
+
+    const size_t size = 1024;
+    int *data = dpnp_pool_malloc<int>(size, q, sycl::usm::alloc::device);
+    sycl::event fill_event = q.fill<int>(data, 42, size);
+
+    sycl::event free_event = dpnp_pool_free_async(q, {data}, {fill_event});
+    free_event.wait();
+
+    EXPECT_EQ(pool.get_cached_bytes(),
+              DPNPC_memory_pool::get_size_class(size * sizeof(int)));
+    pool.trim();
+}
+
+TEST(TestMemoryPool, pointer_type)
+{
+    DPNPC_memory_pool &pool = DPNPC_memory_pool::get_instance();
+    if (!pool.is_enabled()) {
+        GTEST_SKIP() << "memory pool is disabled";
+    }
+
+    sycl::queue q;
+    sycl::usm::alloc kind = sycl::usm::alloc::unknown;
+
+    void *ptr = pool.malloc(100, q, sycl::usm::alloc::device);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_TRUE(pool.get_pointer_type(ptr, q.get_context(), kind));
+    EXPECT_EQ(kind, sycl::usm::alloc::device);
+
+    // only the start of the allocation is known to the pool
+    EXPECT_FALSE(pool.get_pointer_type(static_cast<char *>(ptr) + 1,
+                                       q.get_context(), kind));
+
+    EXPECT_TRUE(pool.free(ptr));
+    EXPECT_FALSE(pool.get_pointer_type(ptr, q.get_context(), kind));
+    pool.trim();
+}
+
+TEST(TestMemoryPool, numa_policy)
+{
+    DPNPC_memory_pool &pool = DPNPC_memory_pool::get_instance();
+    sycl::queue q{sycl::cpu_selector()};
+    const NumaPolicy saved_policy = pool.get_numa_policy();
+    const size_t size = 4 * 1024 * 1024 + 1;
+
+    for (NumaPolicy policy : {NumaPolicy::LOCAL, NumaPolicy::INTERLEAVE,
+                              NumaPolicy::FIRST_TOUCH})
+    {
+        pool.set_numa_policy(policy);
+        EXPECT_EQ(pool.get_numa_policy(), policy);
+
+        // trim to get a new block from the runtime
+        pool.trim();
+        char *ptr = static_cast<char *>(
+            pool.malloc(size, q, sycl::usm::alloc::shared));
+        ASSERT_NE(ptr, nullptr);
+
+        ptr[0] = 1;
+        ptr[size - 1] = 2;
+        EXPECT_EQ(ptr[0] + ptr[size - 1], 3);
+
+        if (!pool.free(ptr)) {
+            sycl::free(ptr, q);
+        }
+    }
+
+    pool.set_numa_policy(saved_policy);
+}
+
+#if defined(__linux__)
+// NUMA nodes of the whole pages of the memory, touching them first if asked
+static std::set<int>
+    get_page_nodes(char *ptr, size_t size_in_bytes, bool touch = true)
+{
+    const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t begin =
+        (reinterpret_cast<uintptr_t>(ptr) + page_size - 1) & ~(page_size - 1);
+    const uintptr_t end =
+        (reinterpret_cast<uintptr_t>(ptr) + size_in_bytes) & ~(page_size - 1);
+
+    std::vector<void *> pages;
+    for (uintptr_t page = begin; page < end; page += page_size) {
+        if (touch) {
+            *reinterpret_cast<char *>(page) = 1;
+        }
+        pages.push_back(reinterpret_cast<void *>(page));
+    }
+
+    std::vector<int> status(pages.size(), -1);
+    EXPECT_EQ(syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr,
+                      status.data(), 0),
+              0);
+
+    std::set<int> nodes;
+    for (const int node : status) {
+        EXPECT_GE(node, 0);
+        nodes.insert(node);
+    }
+    return nodes;
+}
+
+TEST(TestMemoryPool, numa_placement)
+{
+    sycl::device dev;
+    try {
+        dev = sycl::device(sycl::cpu_selector());
+    } catch (const sycl::exception &) {
+        GTEST_SKIP() << "NUMA placement is done for CPU devices only";
+    }
+
+    DPNPC_memory_pool &pool = DPNPC_memory_pool::get_instance();
+    sycl::queue q(dev);
+    const NumaPolicy saved_policy = pool.get_numa_policy();
+    const size_t size = 4 * 1024 * 1024 + 1;
+
+    unsigned long allowed[1024 / (8 * sizeof(unsigned long))] = {};
+    ASSERT_EQ(syscall(SYS_get_mempolicy, nullptr, allowed,
+                      8 * sizeof(allowed) + 1, nullptr, MPOL_F_MEMS_ALLOWED),
+              0);
+    size_t allowed_count = 0;
+    for (const unsigned long mask : allowed) {
+        allowed_count += __builtin_popcountl(mask);
+    }
+
+    pool.set_numa_policy(NumaPolicy::INTERLEAVE);
+    pool.trim();
+    char *ptr =
+        static_cast<char *>(pool.malloc(size, q, sycl::usm::alloc::shared));
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(get_page_nodes(ptr, size).size(), allowed_count);
+    pool.free(ptr);
+
+    pool.set_numa_policy(NumaPolicy::LOCAL);
+    pool.trim();
+    ptr = static_cast<char *>(pool.malloc(size, q, sycl::usm::alloc::shared));
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(get_page_nodes(ptr, size).size(), 1u);
+    pool.free(ptr);
+
+    // pages are placed by the pool kernel, not by the first host access
+    pool.set_numa_policy(NumaPolicy::FIRST_TOUCH);
+    pool.trim();
+    ptr = static_cast<char *>(pool.malloc(size, q, sycl::usm::alloc::shared));
+    ASSERT_NE(ptr, nullptr);
+    q.wait();
+    EXPECT_FALSE(get_page_nodes(ptr, size, false).empty());
+    pool.free(ptr);
+
+    pool.set_numa_policy(saved_policy);
+    pool.trim();
+}
+#endif
+
+TEST(TestMemoryPool, stats_and_region)
+{
+    DPNPC_memory_pool &pool = DPNPC_memory_pool::get_instance();
+    sycl::queue q;
+    DPNPMemoryStats stats;
+
+    pool.reset_stats();
+    pool.get_stats(&q, sycl::usm::alloc::shared, stats);
+    const size_t live_bytes = stats.live_bytes;
+    EXPECT_EQ(stats.peak_bytes, live_bytes);
+    EXPECT_EQ(stats.alloc_count, 0);
+
+    pool.begin_region("outer");
+    void *ptr1 = pool.malloc(1000, q, sycl::usm::alloc::shared);
+    ASSERT_NE(ptr1, nullptr);
+
+    pool.begin_region("inner");
+    void *ptr2 = pool.malloc(3000, q, sycl::usm::alloc::shared);
+    ASSERT_NE(ptr2, nullptr);
+    EXPECT_TRUE(pool.free(ptr2));
+    EXPECT_EQ(pool.end_region(), 3000);
+
+    pool.add_staged_bytes(ptr1, 100);
+    EXPECT_TRUE(pool.free(ptr1));
+    EXPECT_EQ(pool.end_region(), 4000);
+    EXPECT_EQ(pool.get_region_peak("inner"), 3000);
+    EXPECT_EQ(pool.get_region_peak("unknown"), 0);
+    EXPECT_THROW(pool.end_region(), std::runtime_error);
+
+    pool.get_stats(&q, sycl::usm::alloc::shared, stats);
+    EXPECT_EQ(stats.live_bytes, live_bytes);
+    EXPECT_EQ(stats.peak_bytes, live_bytes + 4000);
+    EXPECT_EQ(stats.alloc_count, 2);
+    EXPECT_EQ(stats.staged_bytes, 100);
+    EXPECT_EQ(stats.histogram[9], 1);  // 1000 bytes
+    EXPECT_EQ(stats.histogram[11], 1); // 3000 bytes
+
+    pool.get_stats(&q, sycl::usm::alloc::device, stats);
+    EXPECT_EQ(stats.alloc_count, 0);
+}
+
+TEST(TestMemoryPool, region_of_thread)
+{
+    DPNPC_memory_pool &pool = DPNPC_memory_pool::get_instance();
+    sycl::queue q;
+
+    pool.begin_region("thread");
+
+    // memory of other threads is not counted
+    void *other = nullptr;
+    std::thread([&] {
+        other = pool.malloc(8000, q, sycl::usm::alloc::shared);
+    }).join();
+    ASSERT_NE(other, nullptr);
+
+    void *ptr = pool.malloc(1000, q, sycl::usm::alloc::shared);
+    ASSERT_NE(ptr, nullptr);
+
+    // memory of the thread freed by another one is not counted either
+    std::thread([&] {
+        EXPECT_TRUE(pool.free(ptr));
+        EXPECT_TRUE(pool.free(other));
+    }).join();
+
+    ptr = pool.malloc(1000, q, sycl::usm::alloc::shared);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_TRUE(pool.free(ptr));
+
+    EXPECT_EQ(pool.end_region(), 1000);
+}
@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <dpnp_iface.hpp>
+
+#include <CL/sycl.hpp>
+
+TEST(TestQueueBind, thread_queue_is_used)
+{
+    const sycl::device dev{sycl::default_selector()};
+    // own context: memory of the global queue is unknown in it
+    sycl::queue q(sycl::context(dev), dev, sycl::property::queue::in_order());
+
+    std::thread worker([&q]() {
+        dpnp_queue_bind_thread_c(reinterpret_cast<DPCTLSyclQueueRef>(&q));
+
+        void *ptr = dpnp_memory_alloc_c(16 * sizeof(double));
+        EXPECT_NE(sycl::get_pointer_type(ptr, q.get_context()),
+                  sycl::usm::alloc::unknown);
+        dpnp_memory_free_c(ptr);
+
+        dpnp_queue_bind_thread_c(nullptr);
+    });
+    worker.join();
+
+    // binding in the worker does not affect this thread
+    void *ptr = dpnp_memory_alloc_c(16 * sizeof(double));
+    EXPECT_EQ(sycl::get_pointer_type(ptr, q.get_context()),
+              sycl::usm::alloc::unknown);
+    dpnp_memory_free_c(ptr);
+}
+
+TEST(TestQueueBind, numa_sub_queues)
+{
+    if (!dpnp_queue_is_cpu_c()) {
+        GTEST_SKIP() << "NUMA sub-queues are created for CPU devices only";
+    }
+
+    const size_t count = dpnp_queue_create_numa_sub_queues_c(4);
+    ASSERT_GE(count, 1u);
+    ASSERT_LE(count, 4u);
+
+    sycl::queue &first =
+        *reinterpret_cast<sycl::queue *>(dpnp_queue_get_sub_queue_c(0));
+    for (size_t i = 0; i < count; ++i) {
+        sycl::queue &sub_queue =
+            *reinterpret_cast<sycl::queue *>(dpnp_queue_get_sub_queue_c(i));
+        EXPECT_TRUE(sub_queue.is_in_order());
+        EXPECT_TRUE(sub_queue.get_device().is_cpu());
+        EXPECT_EQ(sub_queue.get_context(), first.get_context());
+    }
+
+    EXPECT_THROW(dpnp_queue_get_sub_queue_c(count), std::runtime_error);
+
+    // queues of the previous call stay valid
+    dpnp_queue_create_numa_sub_queues_c(4);
+    EXPECT_TRUE(first.is_in_order());
+}
+
+TEST(TestQueueBind, thread_rng_engine_uses_thread_queue)
+{
+    const sycl::device dev{sycl::default_selector()};
+    sycl::queue q(sycl::context(dev), dev, sycl::property::queue::in_order());
+
+    std::thread worker([&q]() {
+        dpnp_queue_bind_thread_c(reinterpret_cast<DPCTLSyclQueueRef>(&q));
+
+        const size_t size = 16;
+        double *result = reinterpret_cast<double *>(
+            dpnp_memory_alloc_c(size * sizeof(double)));
+        dpnp_rng_srand_c(42);
+        dpnp_rng_uniform_c<double>(result, 1, 2, size);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_GE(result[i], 1.0);
+            EXPECT_LT(result[i], 2.0);
+        }
+        dpnp_memory_free_c(result);
+
+        dpnp_queue_bind_thread_c(nullptr);
+    });
+    worker.join();
+}
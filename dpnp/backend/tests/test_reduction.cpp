@@ -0,0 +1,576 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <dpnp_iface.hpp>
+
+#include "dpnp_reduction.hpp"
+#include "queue_sycl.hpp"
+
+template <typename _DataType>
+static _DataType *alloc_array(size_t size)
+{
+    return reinterpret_cast<_DataType *>(
+        dpnp_memory_alloc_c(size * sizeof(_DataType)));
+}
+
+typedef DPCTLSyclEventRef (*arg_axis_func_t)(DPCTLSyclQueueRef,
+                                             void *,
+                                             void *,
+                                             const shape_elem_type *,
+                                             size_t,
+                                             const shape_elem_type *,
+                                             size_t,
+                                             const DPCTLEventVectorRef);
+
+static void call_arg_axis(DPNPFuncName name,
+                          double *input,
+                          int64_t *result,
+                          const shape_elem_type *shape,
+                          size_t ndim,
+                          const shape_elem_type *axis,
+                          size_t naxis)
+{
+    DPNPFuncData kernel_data = get_dpnp_function_ptr(
+        name, DPNPFuncType::DPNP_FT_DOUBLE, DPNPFuncType::DPNP_FT_DOUBLE);
+    ASSERT_EQ(kernel_data.return_type, DPNPFuncType::DPNP_FT_LONG);
+
+    arg_axis_func_t func = reinterpret_cast<arg_axis_func_t>(kernel_data.ptr);
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&DPNP_QUEUE);
+    DPCTLSyclEventRef event_ref =
+        func(q_ref, input, result, shape, ndim, axis, naxis, nullptr);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+}
+
+TEST(TestReduction, space_of_middle_axis)
+{
+    const shape_elem_type shape[] = {2, 3, 4};
+    const shape_elem_type axis[] = {-2};
+    dpnp_reduction_space space;
+
+    ASSERT_TRUE(dpnp_make_reduction_space(shape, 3, axis, 1, space));
+    EXPECT_EQ(space.output_size, 8u);
+    EXPECT_EQ(space.reduced_size, 3u);
+    EXPECT_EQ(space.reduced.ndim, 1u);
+    EXPECT_EQ(space.reduced.strides[0][0], 4);
+
+    // kept axes 0 and 2 can't be merged for the input
+    EXPECT_EQ(space.output.ndim, 2u);
+}
+
+TEST(TestReduction, space_of_all_axes)
+{
+    const shape_elem_type shape[] = {2, 3, 4};
+    dpnp_reduction_space space;
+
+    ASSERT_TRUE(dpnp_make_reduction_space(shape, 3, nullptr, 0, space));
+    EXPECT_EQ(space.output_size, 1u);
+    EXPECT_EQ(space.reduced_size, 24u);
+    EXPECT_TRUE(space.reduced.is_contiguous());
+}
+
+TEST(TestReduction, sum_over_each_axis)
+{
+    // long rows, split between work-groups, and many strided columns
+    const size_t rows = 5;
+    const size_t cols = 10007;
+    const shape_elem_type shape[] = {rows, cols};
+    const double initial = 0.5;
+
+    double *input = alloc_array<double>(rows * cols);
+    double *result = alloc_array<double>(cols);
+
+    for (size_t i = 0; i < rows * cols; ++i) {
+        input[i] = i % 7;
+    }
+
+    dpnp_host_path_set_threshold_c("dpnp_sum_c", 0);
+    for (shape_elem_type axis : {0, 1}) {
+        const size_t result_size = axis ? rows : cols;
+        dpnp_sum_c<double, double>(result, input, shape, 2, &axis, 1,
+                                   &initial, nullptr);
+
+        for (size_t i = 0; i < result_size; ++i) {
+            double expected = initial;
+            for (size_t j = 0; j < (axis ? cols : rows); ++j) {
+                expected += axis ? input[i * cols + j] : input[j * cols + i];
+            }
+            EXPECT_EQ(result[i], expected);
+        }
+    }
+    dpnp_host_path_set_threshold_c("dpnp_sum_c", 256);
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, sum_over_interleaved_axes)
+{
+    // every other axis is reduced, neither space can be collapsed to
+    // DPNP_KERNEL_ARG_MAX_NDIM dimensions
+    const size_t ndim = 2 * (DPNP_KERNEL_ARG_MAX_NDIM + 1);
+    std::vector<shape_elem_type> shape(ndim, 2);
+    std::vector<shape_elem_type> axes;
+    for (size_t i = 1; i < ndim; i += 2) {
+        axes.push_back(i);
+    }
+    const size_t size = size_t(1) << ndim;
+    const size_t result_size = size_t(1) << axes.size();
+
+    dpnp_reduction_space space;
+    ASSERT_FALSE(dpnp_make_reduction_space(shape.data(), ndim, axes.data(),
+                                           axes.size(), space));
+
+    long *input = alloc_array<long>(size);
+    long *result = alloc_array<long>(result_size);
+
+    for (size_t i = 0; i < size; ++i) {
+        input[i] = i;
+    }
+
+    dpnp_host_path_set_threshold_c("dpnp_sum_c", 0);
+    dpnp_sum_c<long, long>(result, input, shape.data(), ndim, axes.data(),
+                           axes.size(), nullptr, nullptr);
+    dpnp_host_path_set_threshold_c("dpnp_sum_c", 256);
+
+    std::vector<long> expected(result_size, 0);
+    for (size_t i = 0; i < size; ++i) {
+        // bits of kept (even) axes form the output index
+        size_t output_id = 0;
+        for (size_t k = 0; k < ndim; k += 2) {
+            const size_t bit = (i >> (ndim - 1 - k)) & 1;
+            output_id = (output_id << 1) | bit;
+        }
+        expected[output_id] += input[i];
+    }
+
+    for (size_t j = 0; j < result_size; ++j) {
+        EXPECT_EQ(result[j], expected[j]);
+    }
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, prod_over_two_axes)
+{
+    const shape_elem_type shape[] = {3, 4, 5};
+    const shape_elem_type axes[] = {0, 2};
+    const size_t size = 3 * 4 * 5;
+
+    long *input = alloc_array<long>(size);
+    long *result = alloc_array<long>(4);
+
+    for (size_t i = 0; i < size; ++i) {
+        input[i] = (i % 4 == 1) ? 2 : 1;
+    }
+
+    dpnp_host_path_set_threshold_c("dpnp_prod_c", 0);
+    dpnp_prod_c<long, long>(result, input, shape, 3, axes, 2, nullptr,
+                            nullptr);
+    dpnp_host_path_set_threshold_c("dpnp_prod_c", 256);
+
+    for (size_t j = 0; j < 4; ++j) {
+        long expected = 1;
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t k = 0; k < 5; ++k) {
+                expected *= input[(i * 4 + j) * 5 + k];
+            }
+        }
+        EXPECT_EQ(result[j], expected);
+    }
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, sum_prod_apply_initial_on_every_path)
+{
+    const size_t size = 100;
+    const shape_elem_type shape[] = {size};
+    const double initial = 5.0;
+
+    double *input = alloc_array<double>(size);
+    double *result = alloc_array<double>(1);
+
+    for (size_t i = 0; i < size; ++i) {
+        input[i] = 1.0;
+    }
+
+    // device (MKL for the flattened array) and host path
+    for (size_t threshold : {size_t(0), size_t(1000)}) {
+        dpnp_host_path_set_threshold_c("dpnp_sum_c", threshold);
+        dpnp_host_path_set_threshold_c("dpnp_prod_c", threshold);
+
+        dpnp_sum_c<double, double>(result, input, shape, 1, nullptr, 0,
+                                   &initial, nullptr);
+        EXPECT_EQ(result[0], initial + size);
+
+        dpnp_prod_c<double, double>(result, input, shape, 1, nullptr, 0,
+                                    &initial, nullptr);
+        EXPECT_EQ(result[0], initial);
+
+        // scalars
+        dpnp_sum_c<double, double>(result, input, nullptr, 0, nullptr, 0,
+                                   &initial, nullptr);
+        EXPECT_EQ(result[0], initial + 1.0);
+
+        input[0] = 2.0;
+        dpnp_prod_c<double, double>(result, input, nullptr, 0, nullptr, 0,
+                                    &initial, nullptr);
+        EXPECT_EQ(result[0], 2.0 * initial);
+        input[0] = 1.0;
+    }
+    dpnp_host_path_set_threshold_c("dpnp_sum_c", 256);
+    dpnp_host_path_set_threshold_c("dpnp_prod_c", 256);
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, max_min_propagate_nan)
+{
+    const shape_elem_type shape[] = {3, 4};
+    const shape_elem_type axis[] = {1};
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    double *input = alloc_array<double>(12);
+    double *result = alloc_array<double>(3);
+
+    for (size_t i = 0; i < 12; ++i) {
+        input[i] = (i * 5) % 12;
+    }
+    input[5] = nan;
+
+    dpnp_max_c<double>(input, result, 3, shape, 2, axis, 1);
+    EXPECT_EQ(result[0], 10.0);
+    EXPECT_TRUE(std::isnan(result[1]));
+    EXPECT_EQ(result[2], 9.0);
+
+    dpnp_min_c<double>(input, result, 3, shape, 2, axis, 1);
+    EXPECT_EQ(result[0], 0.0);
+    EXPECT_TRUE(std::isnan(result[1]));
+    EXPECT_EQ(result[2], 2.0);
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, ptp_over_axis)
+{
+    const shape_elem_type shape[] = {2, 3};
+    const shape_elem_type strides[] = {3, 1};
+    const shape_elem_type result_shape[] = {3};
+    const shape_elem_type result_strides[] = {1};
+    const shape_elem_type axis[] = {0};
+
+    int *input = alloc_array<int>(6);
+    int *result = alloc_array<int>(3);
+
+    const int values[] = {4, -1, 7, 2, 5, 7};
+    for (size_t i = 0; i < 6; ++i) {
+        input[i] = values[i];
+    }
+
+    dpnp_ptp_c<int>(result, 3, 1, result_shape, result_strides, input, 6, 2,
+                    shape, strides, axis, 1);
+    EXPECT_EQ(result[0], 2);
+    EXPECT_EQ(result[1], 6);
+    EXPECT_EQ(result[2], 0);
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, ptp_into_strided_result)
+{
+    const shape_elem_type shape[] = {2, 2, 3};
+    const shape_elem_type strides[] = {6, 3, 1};
+    const shape_elem_type result_shape[] = {2, 3};
+    const shape_elem_type result_strides[] = {1, 2}; // Fortran order
+    const shape_elem_type axis[] = {0};
+
+    int *input = alloc_array<int>(12);
+    int *result = alloc_array<int>(6);
+
+    for (size_t i = 0; i < 6; ++i) {
+        input[i] = i;
+        input[i + 6] = 2 * i;
+    }
+
+    dpnp_ptp_c<int>(result, 6, 2, result_shape, result_strides, input, 12, 3,
+                    shape, strides, axis, 1);
+    for (size_t j = 0; j < 2; ++j) {
+        for (size_t k = 0; k < 3; ++k) {
+            EXPECT_EQ(result[j + 2 * k], static_cast<int>(j * 3 + k));
+        }
+    }
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, argmax_argmin_over_axis)
+{
+    const shape_elem_type shape[] = {3, 4};
+    const shape_elem_type axis[] = {1};
+    const shape_elem_type axis0[] = {0};
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    double *input = alloc_array<double>(12);
+    int64_t *result = alloc_array<int64_t>(4);
+
+    // ties resolve to the first index, the first NaN wins
+    const double values[] = {1, 7, 7, 0, 3, nan, 8, nan, 2, 2, -5, -5};
+    for (size_t i = 0; i < 12; ++i) {
+        input[i] = values[i];
+    }
+
+    call_arg_axis(DPNPFuncName::DPNP_FN_ARGMAX_AXIS_EXT, input, result, shape,
+                  2, axis, 1);
+    EXPECT_EQ(result[0], 1);
+    EXPECT_EQ(result[1], 1);
+    EXPECT_EQ(result[2], 0);
+
+    call_arg_axis(DPNPFuncName::DPNP_FN_ARGMIN_AXIS_EXT, input, result, shape,
+                  2, axis, 1);
+    EXPECT_EQ(result[0], 3);
+    EXPECT_EQ(result[1], 1);
+    EXPECT_EQ(result[2], 2);
+
+    call_arg_axis(DPNPFuncName::DPNP_FN_NANARGMAX_AXIS_EXT, input, result,
+                  shape, 2, axis, 1);
+    EXPECT_EQ(result[0], 1);
+    EXPECT_EQ(result[1], 2);
+    EXPECT_EQ(result[2], 0);
+
+    call_arg_axis(DPNPFuncName::DPNP_FN_NANARGMIN_AXIS_EXT, input, result,
+                  shape, 2, axis0, 1);
+    EXPECT_EQ(result[0], 0);
+    EXPECT_EQ(result[1], 2);
+    EXPECT_EQ(result[2], 2);
+    EXPECT_EQ(result[3], 2);
+
+    // a slice of NaN only has no index
+    input[1] = nan;
+    input[9] = nan;
+    call_arg_axis(DPNPFuncName::DPNP_FN_NANARGMAX_AXIS_EXT, input, result,
+                  shape, 2, axis0, 1);
+    EXPECT_EQ(result[1], -1);
+    EXPECT_EQ(result[2], 1);
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, argmax_of_long_array)
+{
+    // split between work-groups, the first of equal maxima wins
+    const size_t size = 100003;
+
+    double *input = alloc_array<double>(size);
+    int64_t *result = alloc_array<int64_t>(1);
+
+    for (size_t i = 0; i < size; ++i) {
+        input[i] = static_cast<double>(i % 1000);
+    }
+    input[77777] = 2000.0;
+    input[99999] = 2000.0;
+    input[33] = -1.0;
+    input[90001] = -1.0;
+
+    dpnp_argmax_c<double, int64_t>(input, result, size);
+    EXPECT_EQ(result[0], 77777);
+
+    dpnp_argmin_c<double, int64_t>(input, result, size);
+    EXPECT_EQ(result[0], 33);
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, var_std_over_axis)
+{
+    // large offset, lost by a naive sum of squares in single pass
+    const shape_elem_type shape[] = {4, 3};
+    const shape_elem_type axis[] = {0};
+    const double offset = 1e9;
+
+    double *input = alloc_array<double>(12);
+    double *result = alloc_array<double>(3);
+
+    const double values[] = {1, 2, 0, 3, 2, 0, 5, 2, 0, 7, 2, 4};
+    for (size_t i = 0; i < 12; ++i) {
+        input[i] = offset + values[i];
+    }
+
+    dpnp_var_c<double, double>(input, result, shape, 2, axis, 1, 0);
+    EXPECT_NEAR(result[0], 5.0, 1e-6);
+    EXPECT_EQ(result[1], 0.0);
+    EXPECT_NEAR(result[2], 3.0, 1e-6);
+
+    dpnp_std_c<double, double>(input, result, shape, 2, axis, 1, 1);
+    EXPECT_NEAR(result[0], std::sqrt(20.0 / 3), 1e-6);
+    EXPECT_EQ(result[1], 0.0);
+    EXPECT_NEAR(result[2], 2.0, 1e-6);
+
+    dpnp_mean_c<double, double>(input, result, shape, 2, axis, 1);
+    EXPECT_NEAR(result[0], offset + 4.0, 1e-6);
+    EXPECT_EQ(result[1], offset + 2.0);
+    EXPECT_NEAR(result[2], offset + 1.0, 1e-6);
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, nanmean_nanstd_skip_nan)
+{
+    typedef DPCTLSyclEventRef (*nanmean_func_t)(
+        DPCTLSyclQueueRef, void *, void *, const shape_elem_type *, size_t,
+        const shape_elem_type *, size_t, const DPCTLEventVectorRef);
+    typedef DPCTLSyclEventRef (*nanstd_func_t)(
+        DPCTLSyclQueueRef, void *, void *, const shape_elem_type *, size_t,
+        const shape_elem_type *, size_t, size_t, const DPCTLEventVectorRef);
+
+    const shape_elem_type shape[] = {3, 4};
+    const shape_elem_type axis[] = {1};
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    double *input = alloc_array<double>(12);
+    double *result = alloc_array<double>(3);
+
+    const double values[] = {1, nan, 3, nan, nan, nan, nan, nan, 2, 4, 6, 8};
+    for (size_t i = 0; i < 12; ++i) {
+        input[i] = values[i];
+    }
+
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&DPNP_QUEUE);
+
+    DPNPFuncData kernel_data = get_dpnp_function_ptr(
+        DPNPFuncName::DPNP_FN_NANMEAN_EXT, DPNPFuncType::DPNP_FT_DOUBLE,
+        DPNPFuncType::DPNP_FT_DOUBLE);
+    nanmean_func_t nanmean =
+        reinterpret_cast<nanmean_func_t>(kernel_data.ptr);
+    DPCTLSyclEventRef event_ref =
+        nanmean(q_ref, input, result, shape, 2, axis, 1, nullptr);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    EXPECT_DOUBLE_EQ(result[0], 2.0);
+    EXPECT_TRUE(std::isnan(result[1]));
+    EXPECT_DOUBLE_EQ(result[2], 5.0);
+
+    kernel_data = get_dpnp_function_ptr(DPNPFuncName::DPNP_FN_NANSTD_EXT,
+                                        DPNPFuncType::DPNP_FT_DOUBLE,
+                                        DPNPFuncType::DPNP_FT_DOUBLE);
+    nanstd_func_t nanstd = reinterpret_cast<nanstd_func_t>(kernel_data.ptr);
+    event_ref = nanstd(q_ref, input, result, shape, 2, axis, 1, 1, nullptr);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    EXPECT_DOUBLE_EQ(result[0], std::sqrt(2.0));
+    EXPECT_TRUE(std::isnan(result[1]));
+    EXPECT_DOUBLE_EQ(result[2], std::sqrt(20.0 / 3));
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestReduction, nan_reductions_skip_nan)
+{
+    typedef DPCTLSyclEventRef (*nansum_func_t)(
+        DPCTLSyclQueueRef, void *, const void *, const shape_elem_type *,
+        const size_t, const shape_elem_type *, const size_t,
+        const DPCTLEventVectorRef);
+    typedef DPCTLSyclEventRef (*nanmax_func_t)(
+        DPCTLSyclQueueRef, void *, void *, const size_t,
+        const shape_elem_type *, size_t, const shape_elem_type *, size_t,
+        const DPCTLEventVectorRef);
+
+    const shape_elem_type shape[] = {3, 4};
+    const shape_elem_type axis[] = {1};
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    double *input = alloc_array<double>(12);
+    double *result = alloc_array<double>(3);
+
+    const double values[] = {1, nan, 3, nan, nan, nan, nan, nan, 2, 4, 6, 8};
+    for (size_t i = 0; i < 12; ++i) {
+        input[i] = values[i];
+    }
+
+    DPCTLSyclQueueRef q_ref = reinterpret_cast<DPCTLSyclQueueRef>(&DPNP_QUEUE);
+
+    DPNPFuncData kernel_data = get_dpnp_function_ptr(
+        DPNPFuncName::DPNP_FN_NANSUM_EXT, DPNPFuncType::DPNP_FT_DOUBLE,
+        DPNPFuncType::DPNP_FT_DOUBLE);
+    nansum_func_t nansum = reinterpret_cast<nansum_func_t>(kernel_data.ptr);
+    DPCTLSyclEventRef event_ref =
+        nansum(q_ref, result, input, shape, 2, axis, 1, nullptr);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    EXPECT_EQ(result[0], 4.0);
+    EXPECT_EQ(result[1], 0.0);
+    EXPECT_EQ(result[2], 20.0);
+
+    kernel_data = get_dpnp_function_ptr(DPNPFuncName::DPNP_FN_NANMAX_EXT,
+                                        DPNPFuncType::DPNP_FT_DOUBLE,
+                                        DPNPFuncType::DPNP_FT_DOUBLE);
+    nanmax_func_t nanmax = reinterpret_cast<nanmax_func_t>(kernel_data.ptr);
+    event_ref = nanmax(q_ref, input, result, 3, shape, 2, axis, 1, nullptr);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    EXPECT_EQ(result[0], 3.0);
+    EXPECT_TRUE(std::isnan(result[1]));
+    EXPECT_EQ(result[2], 8.0);
+
+    kernel_data = get_dpnp_function_ptr(DPNPFuncName::DPNP_FN_NANMIN_EXT,
+                                        DPNPFuncType::DPNP_FT_DOUBLE,
+                                        DPNPFuncType::DPNP_FT_DOUBLE);
+    nanmax_func_t nanmin = reinterpret_cast<nanmax_func_t>(kernel_data.ptr);
+    event_ref = nanmin(q_ref, input, result, 3, shape, 2, axis, 1, nullptr);
+    DPCTLEvent_WaitAndThrow(event_ref);
+    DPCTLEvent_Delete(event_ref);
+
+    EXPECT_EQ(result[0], 1.0);
+    EXPECT_TRUE(std::isnan(result[1]));
+    EXPECT_EQ(result[2], 2.0);
+
+    dpnp_nanvar_c<double, double>(input, result, shape, 2, axis, 1, 0);
+    EXPECT_DOUBLE_EQ(result[0], 1.0);
+    EXPECT_TRUE(std::isnan(result[1]));
+    EXPECT_DOUBLE_EQ(result[2], 5.0);
+
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
@@ -95,3 +95,120 @@ INSTANTIATE_TEST_SUITE_P(
                     AxesParameters{{}, 2, true, {}})
     /*, AxesNormalization::PrintToStringParamName()*/
 );
+
+TEST(TestUtilsStridesNormalization, contiguous_collapses_to_1d)
+{
+    const vector<shape_elem_type> shape = {2, 3, 4};
+    const vector<shape_elem_type> strides = {12, 4, 1};
+    const shape_elem_type *const operands[2] = {strides.data(),
+                                                strides.data()};
+
+    dpnp_strided_space<2> space;
+    ASSERT_TRUE(dpnp_normalize_strides(shape.size(), shape.data(), operands,
+                                       space));
+    EXPECT_EQ(space.ndim, 1);
+    EXPECT_EQ(space.shape[0], 24);
+    EXPECT_TRUE(space.is_contiguous());
+}
+
+TEST(TestUtilsStridesNormalization, strided_slice_collapses_to_1d)
+{
+    // x[:, :, ::2] of a C-contiguous array with shape (2, 3, 8) and a
+    // C-contiguous result with a mask of zero strides
+    const vector<shape_elem_type> shape = {2, 3, 4};
+    const vector<shape_elem_type> result_strides = {12, 4, 1};
+    const vector<shape_elem_type> input_strides = {24, 8, 2};
+    const vector<shape_elem_type> zero_strides = {0, 0, 0};
+    const shape_elem_type *const operands[3] = {
+        result_strides.data(), input_strides.data(), zero_strides.data()};
+
+    dpnp_strided_space<3> space;
+    ASSERT_TRUE(dpnp_normalize_strides(shape.size(), shape.data(), operands,
+                                       space));
+    EXPECT_EQ(space.ndim, 1);
+    EXPECT_EQ(space.shape[0], 24);
+    EXPECT_EQ(space.strides[0][0], 1);
+    EXPECT_EQ(space.strides[1][0], 2);
+    EXPECT_EQ(space.strides[2][0], 0);
+    EXPECT_FALSE(space.is_contiguous(2));
+
+    ASSERT_TRUE(space.as_2d());
+    shape_elem_type offsets[3];
+    space.get_offsets(0, 5, offsets);
+    EXPECT_EQ(offsets[0], 5);
+    EXPECT_EQ(offsets[1], 10);
+    EXPECT_EQ(offsets[2], 0);
+}
+
+TEST(TestUtilsStridesNormalization, transposed_input)
+{
+    // C-contiguous result of shape (1, 3, 4) and transposed input
+    const vector<shape_elem_type> shape = {1, 3, 4};
+    const vector<shape_elem_type> result_strides = {12, 4, 1};
+    const vector<shape_elem_type> input_strides = {1, 1, 3};
+    const shape_elem_type *const operands[2] = {result_strides.data(),
+                                                input_strides.data()};
+
+    dpnp_strided_space<2> space;
+    ASSERT_TRUE(dpnp_normalize_strides(shape.size(), shape.data(), operands,
+                                       space));
+    EXPECT_EQ(space.ndim, 2);
+    EXPECT_EQ(space.shape[0], 3);
+    EXPECT_EQ(space.shape[1], 4);
+
+    for (size_t id = 0; id < 12; ++id) {
+        shape_elem_type offsets[2];
+        space.get_offsets(id, offsets);
+        EXPECT_EQ(offsets[0], id);
+        EXPECT_EQ(offsets[1], (id / 4) + (id % 4) * 3);
+    }
+}
+
+TEST(TestUtilsStridesNormalization, broadcast_row_vector)
+{
+    // (3, 4) result of a (4,) row vector and a C-contiguous (3, 4) matrix
+    const vector<shape_elem_type> shape = {3, 4};
+    const vector<shape_elem_type> result_strides = {4, 1};
+    const vector<shape_elem_type> row_shape = {4};
+    const vector<shape_elem_type> row_strides = {1};
+
+    const vector<shape_elem_type> row_view_strides = get_broadcast_strides(
+        row_shape.data(), row_strides.data(), row_shape.size(), shape.data(),
+        shape.size());
+    EXPECT_EQ(row_view_strides, (vector<shape_elem_type>{0, 1}));
+
+    const shape_elem_type *const operands[3] = {
+        result_strides.data(), row_view_strides.data(), result_strides.data()};
+
+    dpnp_strided_space<3> space;
+    ASSERT_TRUE(dpnp_normalize_strides(shape.size(), shape.data(), operands,
+                                       space));
+    EXPECT_EQ(space.ndim, 2);
+
+    for (size_t id = 0; id < 12; ++id) {
+        shape_elem_type offsets[3];
+        space.get_offsets(id / 4, id % 4, offsets);
+        EXPECT_EQ(offsets[0], id);
+        EXPECT_EQ(offsets[1], id % 4);
+        EXPECT_EQ(offsets[2], id);
+    }
+}
+
+TEST(TestUtilsStridesNormalization, broadcast_size_one_dims)
+{
+    const vector<shape_elem_type> shape = {2, 3, 4};
+    const vector<shape_elem_type> input_shape = {2, 1, 4};
+    const vector<shape_elem_type> input_strides = {4, 4, 1};
+
+    EXPECT_EQ(get_broadcast_strides(input_shape.data(), input_strides.data(),
+                                    input_shape.size(), shape.data(),
+                                    shape.size()),
+              (vector<shape_elem_type>{4, 0, 1}));
+
+    const vector<shape_elem_type> wrong_shape = {3};
+    EXPECT_THROW(get_broadcast_strides(wrong_shape.data(),
+                                       input_strides.data(),
+                                       wrong_shape.size(), shape.data(),
+                                       shape.size()),
+                 std::runtime_error);
+}
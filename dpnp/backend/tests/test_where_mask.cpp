@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Copyright (c) 2016-2023, Intel Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+// THE POSSIBILITY OF SUCH DAMAGE.
+//*****************************************************************************
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+#include <dpnp_iface.hpp>
+
+template <typename _DataType>
+static _DataType *alloc_array(size_t size)
+{
+    return reinterpret_cast<_DataType *>(
+        dpnp_memory_alloc_c(size * sizeof(_DataType)));
+}
+
+TEST(TestWhereMask, add_keeps_masked_result)
+{
+    // large enough for the sub-group vector path and its tail
+    const size_t size = 4099;
+    const std::vector<shape_elem_type> shape = {static_cast<long>(size)};
+    const std::vector<shape_elem_type> strides = {1};
+
+    double *input1 = alloc_array<double>(size);
+    double *input2 = alloc_array<double>(size);
+    double *result = alloc_array<double>(size);
+    size_t *where = alloc_array<size_t>(size);
+
+    for (size_t i = 0; i < size; ++i) {
+        input1[i] = i;
+        input2[i] = 1.0;
+        where[i] = (i % 3 == 0);
+    }
+
+    // device path and host path
+    for (size_t threshold : {size_t(0), std::numeric_limits<size_t>::max()}) {
+        dpnp_host_path_set_threshold_c("dpnp_add_c", threshold);
+        for (size_t i = 0; i < size; ++i) {
+            result[i] = -1.0;
+        }
+
+        dpnp_add_c<double, double, double>(
+            result, size, 1, shape.data(), strides.data(), input1, size, 1,
+            shape.data(), strides.data(), input2, size, 1, shape.data(),
+            strides.data(), where);
+
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(result[i], where[i] ? input1[i] + 1.0 : -1.0);
+        }
+    }
+    dpnp_host_path_set_threshold_c("dpnp_add_c", 256);
+
+    dpnp_memory_free_c(where);
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input2);
+    dpnp_memory_free_c(input1);
+}
+
+TEST(TestWhereMask, sum_skips_masked_input)
+{
+    const size_t size = 100;
+    const shape_elem_type shape[] = {static_cast<long>(size)};
+
+    double *input = alloc_array<double>(size);
+    double *result = alloc_array<double>(1);
+    long *where = alloc_array<long>(size);
+
+    double expected = 0.0;
+    for (size_t i = 0; i < size; ++i) {
+        input[i] = i;
+        where[i] = (i % 2);
+        expected += where[i] ? input[i] : 0.0;
+    }
+
+    dpnp_sum_c<double, double>(result, input, shape, 1, nullptr, 0, nullptr,
+                               where);
+    EXPECT_EQ(result[0], expected);
+
+    dpnp_memory_free_c(where);
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
+
+TEST(TestWhereMask, sum_over_axis_skips_masked_input)
+{
+    const size_t rows = 4, cols = 5;
+    const shape_elem_type shape[] = {static_cast<long>(rows),
+                                     static_cast<long>(cols)};
+    const shape_elem_type axes[] = {0};
+    const double initial = 10.0;
+
+    double *input = alloc_array<double>(rows * cols);
+    double *result = alloc_array<double>(cols);
+    long *where = alloc_array<long>(rows * cols);
+
+    for (size_t i = 0; i < rows * cols; ++i) {
+        input[i] = i;
+        where[i] = (i % 3 != 0);
+    }
+
+    dpnp_sum_c<double, double>(result, input, shape, 2, axes, 1, &initial,
+                               where);
+    for (size_t j = 0; j < cols; ++j) {
+        double expected = initial;
+        for (size_t i = 0; i < rows; ++i) {
+            const size_t k = i * cols + j;
+            expected += where[k] ? input[k] : 0.0;
+        }
+        EXPECT_EQ(result[j], expected);
+    }
+
+    dpnp_memory_free_c(where);
+    dpnp_memory_free_c(result);
+    dpnp_memory_free_c(input);
+}
@@ -58,8 +58,10 @@ cdef extern from "dpnp_iface_fptr.hpp" namespace "DPNPFuncName":  # need this na
         DPNP_FN_ARCTANH_EXT
         DPNP_FN_ARGMAX
         DPNP_FN_ARGMAX_EXT
+        DPNP_FN_ARGMAX_AXIS_EXT
         DPNP_FN_ARGMIN
         DPNP_FN_ARGMIN_EXT
+        DPNP_FN_ARGMIN_AXIS_EXT
         DPNP_FN_ARGSORT
         DPNP_FN_ARGSORT_EXT
         DPNP_FN_AROUND
@@ -182,6 +184,9 @@ cdef extern from "dpnp_iface_fptr.hpp" namespace "DPNPFuncName":  # need this na
         DPNP_FN_MINIMUM_EXT
         DPNP_FN_MODF
         DPNP_FN_MODF_EXT
+        DPNP_FN_NANARGMAX_AXIS_EXT
+        DPNP_FN_NANARGMIN_AXIS_EXT
+        DPNP_FN_NANSUM_EXT
         DPNP_FN_NANVAR
         DPNP_FN_NANVAR_EXT
         DPNP_FN_NEGATIVE
@@ -340,6 +345,7 @@ cdef extern from "dpnp_iface_fptr.hpp":
         void * ptr
 
     DPNPFuncData get_dpnp_function_ptr(DPNPFuncName name, DPNPFuncType first_type, DPNPFuncType second_type) except +
+    size_t dpnp_func_map_register_all_c() except +
 
 
 cdef extern from "dpnp_iface.hpp" namespace "QueueOptions":  # need this namespace for Enum import
@@ -354,12 +360,27 @@ cdef extern from "constants.hpp":
 cdef extern from "dpnp_iface.hpp":
     void dpnp_queue_initialize_c(QueueOptions selector)
     size_t dpnp_queue_is_cpu_c() except +
+    size_t dpnp_queue_warmup_c(c_dpctl.DPCTLSyclQueueRef q_ref, const char * const * kernel_names, size_t count) except +
 
     char * dpnp_memory_alloc_c(size_t size_in_bytes) except +
     void dpnp_memory_free_c(void * ptr)
     void dpnp_memory_memcpy_c(void * dst, const void * src, size_t size_in_bytes)
     void dpnp_rng_srand_c(size_t seed)
 
+    enum: DPNP_MEMORY_HISTOGRAM_SIZE
+    cdef struct DPNPMemoryStats:
+        size_t live_bytes
+        size_t peak_bytes
+        size_t alloc_count
+        size_t staged_bytes
+        size_t histogram[DPNP_MEMORY_HISTOGRAM_SIZE]
+
+    void dpnp_memory_stats_c(c_dpctl.DPCTLSyclQueueRef q_ref, const char * usm_type, DPNPMemoryStats * stats) except +
+    void dpnp_memory_stats_reset_c()
+    void dpnp_memory_region_begin_c(const char * name) except +
+    size_t dpnp_memory_region_end_c() except +
+    size_t dpnp_memory_region_peak_c(const char * name) except +
+
 
 # C function pointer to the C library template functions
 ctypedef c_dpctl.DPCTLSyclEventRef(*fptr_1out_t)(c_dpctl.DPCTLSyclQueueRef,
@@ -517,8 +538,10 @@ cpdef dpnp_descriptor dpnp_sort(dpnp_descriptor array1)
 """
 Searching functions
 """
-cpdef dpnp_descriptor dpnp_argmax(dpnp_descriptor array1)
-cpdef dpnp_descriptor dpnp_argmin(dpnp_descriptor array1)
+cpdef dpnp_descriptor dpnp_argmax(dpnp_descriptor array1, axis=*)
+cpdef dpnp_descriptor dpnp_argmin(dpnp_descriptor array1, axis=*)
+cpdef dpnp_descriptor dpnp_nanargmax(dpnp_descriptor array1, axis=*)
+cpdef dpnp_descriptor dpnp_nanargmin(dpnp_descriptor array1, axis=*)
 
 """
 Trigonometric functions
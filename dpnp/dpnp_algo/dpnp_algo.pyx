@@ -57,8 +57,12 @@ __all__ = [
     "dpnp_astype",
     "dpnp_flatten",
     "dpnp_init_val",
+    "dpnp_memory_region",
+    "dpnp_memory_stats",
+    "dpnp_memory_stats_reset",
     "dpnp_queue_initialize",
-    "dpnp_queue_is_cpu"
+    "dpnp_queue_is_cpu",
+    "dpnp_warmup"
 ]
 
 
@@ -231,6 +235,99 @@ cpdef dpnp_queue_is_cpu():
     return dpnp_queue_is_cpu_c()
 
 
+cpdef dpnp_warmup(kernel_names=None, sycl_queue=None):
+    """
+    Register all backend functions and JIT compile kernels with a name
+    containing any of the strings in `kernel_names` (all kernels by default)
+    for the device of `sycl_queue` (the default queue by default).
+    Return number of compiled kernels.
+
+    Use it at the start of a process to move the compilation out of the first
+    calls of the functions.
+    """
+    cdef c_dpctl.SyclQueue q
+    cdef vector[const char *] names_c
+    cdef const char * const * names_ptr = NULL
+
+    if sycl_queue is None:
+        sycl_queue = dpctl.SyclQueue()
+    q = <c_dpctl.SyclQueue> sycl_queue
+
+    dpnp_func_map_register_all_c()
+
+    if kernel_names is not None:
+        names_bytes = [name.encode() for name in kernel_names]
+        for name in names_bytes:
+            names_c.push_back(<const char *> name)
+        names_ptr = names_c.data()
+        if names_c.empty():
+            return 0
+
+    return dpnp_queue_warmup_c(q.get_queue_ref(), names_ptr, names_c.size())
+
+
+cpdef dpnp_memory_stats(sycl_queue=None, usm_type=None):
+    """
+    Return statistics of the memory allocated by the backend as a dictionary
+    with keys "live_bytes", "peak_bytes", "alloc_count", "staged_bytes" and
+    "histogram". Bin ``i`` of the histogram counts allocations of
+    ``[2**i, 2**(i+1))`` bytes.
+
+    Memory of all queues and USM types is counted by default.
+    """
+    cdef DPNPMemoryStats stats
+    cdef c_dpctl.SyclQueue q
+    cdef c_dpctl.DPCTLSyclQueueRef q_ref = NULL
+    cdef const char * usm_type_c = NULL
+
+    if sycl_queue is not None:
+        q = <c_dpctl.SyclQueue> sycl_queue
+        q_ref = q.get_queue_ref()
+
+    if usm_type is not None:
+        usm_type_bytes = usm_type.encode()
+        usm_type_c = usm_type_bytes
+
+    dpnp_memory_stats_c(q_ref, usm_type_c, &stats)
+
+    return {"live_bytes": stats.live_bytes,
+            "peak_bytes": stats.peak_bytes,
+            "alloc_count": stats.alloc_count,
+            "staged_bytes": stats.staged_bytes,
+            "histogram": [stats.histogram[i] for i in range(DPNP_MEMORY_HISTOGRAM_SIZE)]}
+
+
+cpdef dpnp_memory_stats_reset():
+    """Reset counters, histograms and peaks of the memory statistics."""
+    dpnp_memory_stats_reset_c()
+
+
+class dpnp_memory_region:
+    """
+    Context manager tracking the peak memory allocated by the backend inside
+    of the ``with`` block. The peak in bytes is stored in ``peak_bytes``
+    attribute on exit.
+
+    Examples
+    --------
+    >>> with dpnp_memory_region("sum") as region:
+    ...     dpnp.sum(x)
+    >>> region.peak_bytes
+    """
+
+    def __init__(self, name):
+        self.name = name
+        self.peak_bytes = 0
+
+    def __enter__(self):
+        dpnp_memory_region_begin_c(self.name.encode())
+        return self
+
+    def __exit__(self, *args):
+        self.peak_bytes = dpnp_memory_region_end_c()
+        return False
+
+
 """
 Internal functions
 """
@@ -508,14 +605,18 @@ cdef utils.dpnp_descriptor call_fptr_2in_1out_strides(DPNPFuncName fptr_name,
 
         utils.get_common_usm_allocation(x1_obj, out)  # check USM allocation is common
 
-    if out is None or out.is_array_overlapped(x1_obj) or out.is_array_overlapped(x2_obj) or not out.match_ctype(return_type):
+    if (out is None or not out.match_ctype(return_type) or
+            (out.is_array_overlapped(x1_obj) and not out.is_array_aliased(x1_obj)) or
+            (out.is_array_overlapped(x2_obj) and not out.is_array_aliased(x2_obj))):
         """
         Create result array with type given by FPTR data.
-        If 'out' array has another dtype than expected or overlaps a memory from any input array,
+        If 'out' array has another dtype than expected or partially overlaps a memory from any input array,
         we have to create a temporary array and to copy data from the temporary into 'out' array,
         once the computation is completed.
         Otherwise simultaneously access to the same memory may cause a race condition issue
         which will result into undefined behaviour.
+        An 'out' array being the same view as an input is computed in place, every element is read
+        by the kernel before the result is stored at the same position.
         """
         is_result_memory_allocated = True
         result = utils.create_output_descriptor(result_shape,
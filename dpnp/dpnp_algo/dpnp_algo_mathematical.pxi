@@ -83,6 +83,10 @@ ctypedef c_dpctl.DPCTLSyclEventRef(*ftpr_custom_trapz_2in_1out_with_2size_t)(c_d
 ctypedef c_dpctl.DPCTLSyclEventRef(*ftpr_custom_around_1in_1out_t)(c_dpctl.DPCTLSyclQueueRef,
                                                                    const void * , void * , const size_t, const int,
                                                                    const c_dpctl.DPCTLEventVectorRef)
+ctypedef c_dpctl.DPCTLSyclEventRef(*fptr_custom_nansum_t)(c_dpctl.DPCTLSyclQueueRef,
+                                                          void * , const void * , const shape_elem_type * , const size_t,
+                                                          const shape_elem_type * , const size_t,
+                                                          const c_dpctl.DPCTLEventVectorRef)
 
 
 cpdef utils.dpnp_descriptor dpnp_absolute(utils.dpnp_descriptor x1):
@@ -462,23 +466,44 @@ cpdef utils.dpnp_descriptor dpnp_nanprod(utils.dpnp_descriptor x1):
 
 
 cpdef utils.dpnp_descriptor dpnp_nansum(utils.dpnp_descriptor x1):
+    cdef shape_type_c x1_shape = x1.shape
+    cdef DPNPFuncType x1_c_type = dpnp_dtype_to_DPNPFuncType(x1.dtype)
+
+    # NaN are skipped by the kernel, all axes are reduced
+    cdef shape_type_c axis_shape
+    cdef shape_type_c result_shape = utils.get_reduction_output_shape(x1_shape, None, False)
+    cdef DPNPFuncType result_c_type = utils.get_output_c_type(DPNP_FN_NANSUM_EXT, x1_c_type, None, None)
+
+    cdef DPNPFuncData kernel_data = get_dpnp_function_ptr(DPNP_FN_NANSUM_EXT, x1_c_type, result_c_type)
+
     x1_obj = x1.get_array()
-    cdef utils.dpnp_descriptor result = utils_py.create_output_descriptor_py(x1.shape,
-                                                                             x1.dtype,
-                                                                             None,
-                                                                             device=x1_obj.sycl_device,
-                                                                             usm_type=x1_obj.usm_type,
-                                                                             sycl_queue=x1_obj.sycl_queue)
 
-    for i in range(result.size):
-        input_elem = x1.get_pyobj().flat[i]
+    cdef utils.dpnp_descriptor result = utils.create_output_descriptor(result_shape,
+                                                                       result_c_type,
+                                                                       None,
+                                                                       device=x1_obj.sycl_device,
+                                                                       usm_type=x1_obj.usm_type,
+                                                                       sycl_queue=x1_obj.sycl_queue)
 
-        if dpnp.isnan(input_elem):
-            result.get_pyobj().flat[i] = 0
-        else:
-            result.get_pyobj().flat[i] = input_elem
+    result_sycl_queue = result.get_array().sycl_queue
+
+    cdef c_dpctl.SyclQueue q = <c_dpctl.SyclQueue> result_sycl_queue
+    cdef c_dpctl.DPCTLSyclQueueRef q_ref = q.get_queue_ref()
 
-    return dpnp_sum(result)
+    cdef fptr_custom_nansum_t func = <fptr_custom_nansum_t > kernel_data.ptr
+    cdef c_dpctl.DPCTLSyclEventRef event_ref = func(q_ref,
+                                                    result.get_data(),
+                                                    x1.get_data(),
+                                                    x1_shape.data(),
+                                                    x1_shape.size(),
+                                                    axis_shape.data(),
+                                                    axis_shape.size(),
+                                                    NULL)  # dep_events_ref
+
+    with nogil: c_dpctl.DPCTLEvent_WaitAndThrow(event_ref)
+    c_dpctl.DPCTLEvent_Delete(event_ref)
+
+    return result
 
 
 cpdef utils.dpnp_descriptor dpnp_negative(dpnp_descriptor x1):
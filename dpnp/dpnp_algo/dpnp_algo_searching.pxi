@@ -37,26 +37,48 @@ and the rest of the library
 
 __all__ += [
     "dpnp_argmax",
-    "dpnp_argmin"
+    "dpnp_argmin",
+    "dpnp_nanargmax",
+    "dpnp_nanargmin"
 ]
 
 
 # C function pointer to the C library template functions
-ctypedef c_dpctl.DPCTLSyclEventRef(*custom_search_1in_1out_func_ptr_t)(c_dpctl.DPCTLSyclQueueRef,
-                                                                       void * , void * , size_t,
-                                                                       const c_dpctl.DPCTLEventVectorRef)
+ctypedef c_dpctl.DPCTLSyclEventRef(*custom_search_axis_1in_1out_func_ptr_t)(c_dpctl.DPCTLSyclQueueRef,
+                                                                            void * , void * ,
+                                                                            const shape_elem_type * , size_t,
+                                                                            const shape_elem_type * , size_t,
+                                                                            const c_dpctl.DPCTLEventVectorRef)
+
+
+cdef utils.dpnp_descriptor _dpnp_arg_extremum(DPNPFuncName fptr_name, utils.dpnp_descriptor in_array1, axis, name):
+    cdef shape_type_c in_array1_shape = in_array1.shape
+    cdef shape_type_c axis_
+    cdef shape_type_c result_shape
+    cdef size_t axis_extent = in_array1.size
+
+    if axis is None:
+        # a 0-d array is reduced as an array of one element
+        if in_array1.ndim == 0:
+            in_array1_shape.push_back(1)
+        result_shape.push_back(1)
+    else:
+        axis_ = utils.normalize_axis(axis, in_array1.ndim)
+        axis_extent = in_array1_shape[axis_[0]]
+        for id, shape_axis in enumerate(in_array1_shape):
+            if id != axis_[0]:
+                result_shape.push_back(shape_axis)
+
+    if axis_extent == 0:
+        raise ValueError(f"attempt to get {name} of an empty sequence")
 
-
-cpdef utils.dpnp_descriptor dpnp_argmax(utils.dpnp_descriptor in_array1):
     cdef DPNPFuncType param1_type = dpnp_dtype_to_DPNPFuncType(in_array1.dtype)
-    cdef DPNPFuncType output_type = dpnp_dtype_to_DPNPFuncType(dpnp.int64)
 
-    cdef DPNPFuncData kernel_data = get_dpnp_function_ptr(DPNP_FN_ARGMAX_EXT, param1_type, output_type)
+    cdef DPNPFuncData kernel_data = get_dpnp_function_ptr(fptr_name, param1_type, param1_type)
 
     in_array1_obj = in_array1.get_array()
 
     # ceate result array with type given by FPTR data
-    cdef shape_type_c result_shape = (1,)
     cdef utils.dpnp_descriptor result = utils.create_output_descriptor(result_shape,
                                                                        kernel_data.return_type,
                                                                        None,
@@ -64,17 +86,24 @@ cpdef utils.dpnp_descriptor dpnp_argmax(utils.dpnp_descriptor in_array1):
                                                                        usm_type=in_array1_obj.usm_type,
                                                                        sycl_queue=in_array1_obj.sycl_queue)
 
+    # nothing to reduce when another axis is empty
+    if result.size == 0:
+        return result
+
     result_sycl_queue = result.get_array().sycl_queue
 
     cdef c_dpctl.SyclQueue q = <c_dpctl.SyclQueue> result_sycl_queue
     cdef c_dpctl.DPCTLSyclQueueRef q_ref = q.get_queue_ref()
 
-    cdef custom_search_1in_1out_func_ptr_t func = <custom_search_1in_1out_func_ptr_t > kernel_data.ptr
+    cdef custom_search_axis_1in_1out_func_ptr_t func = <custom_search_axis_1in_1out_func_ptr_t > kernel_data.ptr
 
     cdef c_dpctl.DPCTLSyclEventRef event_ref = func(q_ref,
                                                     in_array1.get_data(),
                                                     result.get_data(),
-                                                    in_array1.size,
+                                                    in_array1_shape.data(),
+                                                    in_array1_shape.size(),
+                                                    axis_.data(),
+                                                    axis_.size(),
                                                     NULL)  # dep_events_ref
 
     with nogil: c_dpctl.DPCTLEvent_WaitAndThrow(event_ref)
@@ -83,37 +112,29 @@ cpdef utils.dpnp_descriptor dpnp_argmax(utils.dpnp_descriptor in_array1):
     return result
 
 
-cpdef utils.dpnp_descriptor dpnp_argmin(utils.dpnp_descriptor in_array1):
-    cdef DPNPFuncType param1_type = dpnp_dtype_to_DPNPFuncType(in_array1.dtype)
-    cdef DPNPFuncType output_type = dpnp_dtype_to_DPNPFuncType(dpnp.int64)
+cpdef utils.dpnp_descriptor dpnp_argmax(utils.dpnp_descriptor in_array1, axis=None):
+    return _dpnp_arg_extremum(DPNP_FN_ARGMAX_AXIS_EXT, in_array1, axis, "argmax")
 
-    cdef DPNPFuncData kernel_data = get_dpnp_function_ptr(DPNP_FN_ARGMIN_EXT, param1_type, output_type)
 
-    in_array1_obj = in_array1.get_array()
+cpdef utils.dpnp_descriptor dpnp_argmin(utils.dpnp_descriptor in_array1, axis=None):
+    return _dpnp_arg_extremum(DPNP_FN_ARGMIN_AXIS_EXT, in_array1, axis, "argmin")
 
-    # ceate result array with type given by FPTR data
-    cdef shape_type_c result_shape = (1,)
-    cdef utils.dpnp_descriptor result = utils.create_output_descriptor(result_shape,
-                                                                       kernel_data.return_type,
-                                                                       None,
-                                                                       device=in_array1_obj.sycl_device,
-                                                                       usm_type=in_array1_obj.usm_type,
-                                                                       sycl_queue=in_array1_obj.sycl_queue)
 
-    result_sycl_queue = result.get_array().sycl_queue
+cpdef utils.dpnp_descriptor dpnp_nanargmax(utils.dpnp_descriptor in_array1, axis=None):
+    cdef utils.dpnp_descriptor result = _dpnp_arg_extremum(DPNP_FN_NANARGMAX_AXIS_EXT, in_array1, axis, "nanargmax")
 
-    cdef c_dpctl.SyclQueue q = <c_dpctl.SyclQueue> result_sycl_queue
-    cdef c_dpctl.DPCTLSyclQueueRef q_ref = q.get_queue_ref()
+    # the backend marks a slice of NaN only with -1
+    if dpnp.any(result.get_pyobj() == -1):
+        raise ValueError("All-NaN slice encountered")
 
-    cdef custom_search_1in_1out_func_ptr_t func = <custom_search_1in_1out_func_ptr_t > kernel_data.ptr
+    return result
 
-    cdef c_dpctl.DPCTLSyclEventRef event_ref = func(q_ref,
-                                                    in_array1.get_data(),
-                                                    result.get_data(),
-                                                    in_array1.size,
-                                                    NULL)  # dep_events_ref
 
-    with nogil: c_dpctl.DPCTLEvent_WaitAndThrow(event_ref)
-    c_dpctl.DPCTLEvent_Delete(event_ref)
+cpdef utils.dpnp_descriptor dpnp_nanargmin(utils.dpnp_descriptor in_array1, axis=None):
+    cdef utils.dpnp_descriptor result = _dpnp_arg_extremum(DPNP_FN_NANARGMIN_AXIS_EXT, in_array1, axis, "nanargmin")
+
+    # the backend marks a slice of NaN only with -1
+    if dpnp.any(result.get_pyobj() == -1):
+        raise ValueError("All-NaN slice encountered")
 
     return result
@@ -51,9 +51,6 @@ __all__ += [
 ctypedef c_dpctl.DPCTLSyclEventRef(*fptr_custom_cov_1in_1out_t)(c_dpctl.DPCTLSyclQueueRef,
                                                                 void *, void * , size_t, size_t,
                                                                 const c_dpctl.DPCTLEventVectorRef)
-ctypedef c_dpctl.DPCTLSyclEventRef(*fptr_custom_nanvar_t)(c_dpctl.DPCTLSyclQueueRef,
-                                                          void *, void * , void * , size_t, size_t,
-                                                          const c_dpctl.DPCTLEventVectorRef)
 ctypedef c_dpctl.DPCTLSyclEventRef(*fptr_custom_std_var_1in_1out_t)(c_dpctl.DPCTLSyclQueueRef,
                                                                     void *, void * , shape_elem_type * , size_t,
                                                                     shape_elem_type * , size_t, size_t,
@@ -378,45 +375,7 @@ cpdef utils.dpnp_descriptor dpnp_min(utils.dpnp_descriptor x1, axis):
 
 
 cpdef utils.dpnp_descriptor dpnp_nanvar(utils.dpnp_descriptor arr, ddof):
-    # dpnp_isnan does not support USM array as input in comparison to dpnp.isnan
-    cdef utils.dpnp_descriptor mask_arr = dpnp.get_dpnp_descriptor(dpnp.isnan(arr.get_pyobj()),
-                                                                   copy_when_nondefault_queue=False)
-    n = dpnp.count_nonzero(mask_arr.get_pyobj())
-    res_size = int(arr.size - n)
-    cdef DPNPFuncType param1_type = dpnp_dtype_to_DPNPFuncType(arr.dtype)
-
-    cdef DPNPFuncData kernel_data = get_dpnp_function_ptr(DPNP_FN_NANVAR_EXT, param1_type, param1_type)
-
-    arr_obj = arr.get_array()
-
-    # ceate result array with type given by FPTR data
-    cdef shape_type_c result_shape = utils._object_to_tuple(res_size)
-    cdef utils.dpnp_descriptor result = utils.create_output_descriptor(result_shape,
-                                                                       kernel_data.return_type,
-                                                                       None,
-                                                                       device=arr_obj.sycl_device,
-                                                                       usm_type=arr_obj.usm_type,
-                                                                       sycl_queue=arr_obj.sycl_queue)
-
-    result_sycl_queue = result.get_array().sycl_queue
-
-    cdef c_dpctl.SyclQueue q = <c_dpctl.SyclQueue> result_sycl_queue
-    cdef c_dpctl.DPCTLSyclQueueRef q_ref = q.get_queue_ref()
-
-    cdef fptr_custom_nanvar_t func = <fptr_custom_nanvar_t > kernel_data.ptr
-
-    cdef c_dpctl.DPCTLSyclEventRef event_ref = func(q_ref,
-                                                    arr.get_data(),
-                                                    mask_arr.get_data(),
-                                                    result.get_data(),
-                                                    result.size,
-                                                    arr.size,
-                                                    NULL)  # dep_events_ref
-
-    with nogil: c_dpctl.DPCTLEvent_WaitAndThrow(event_ref)
-    c_dpctl.DPCTLEvent_Delete(event_ref)
-
-    return call_fptr_custom_std_var_1in_1out(DPNP_FN_VAR_EXT, result, ddof)
+    return call_fptr_custom_std_var_1in_1out(DPNP_FN_NANVAR_EXT, arr, ddof)
 
 
 cpdef utils.dpnp_descriptor dpnp_std(utils.dpnp_descriptor a, size_t ddof):
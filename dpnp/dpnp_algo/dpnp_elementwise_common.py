@@ -274,6 +274,10 @@ def dpnp_divide(x1, x2, out=None, order="K"):
         if depends is None:
             depends = []
 
+        if vmi._mkl_div_to_call(sycl_queue, lhs, rhs, lhs):
+            # OneMKL VM computes in place, no temporary for out array needed
+            return vmi._div(sycl_queue, lhs, rhs, lhs, depends)
+
         # allocate temporary memory for out array
         out = dpt.empty_like(lhs, dtype=dpnp.result_type(lhs.dtype, rhs.dtype))
 
@@ -48,7 +48,14 @@ from dpnp.dpnp_algo import *
 from dpnp.dpnp_array import dpnp_array
 from dpnp.dpnp_utils import *
 
-__all__ = ["argmax", "argmin", "searchsorted", "where"]
+__all__ = [
+    "argmax",
+    "argmin",
+    "nanargmax",
+    "nanargmin",
+    "searchsorted",
+    "where",
+]
 
 
 def argmax(x1, axis=None, out=None):
@@ -61,7 +68,7 @@ def argmax(x1, axis=None, out=None):
     -----------
     Input array is supported as :obj:`dpnp.ndarray`.
     Otherwise the function will be executed sequentially on CPU.
-    Parameter ``axis`` is supported only with default value ``None``.
+    Parameter ``axis`` is supported as an integer or ``None``.
     Parameter ``out`` is supported only with default value ``None``.
     Input array data types are limited by supported DPNP :ref:`Data types`.
 
@@ -93,15 +100,14 @@ def argmax(x1, axis=None, out=None):
 
     x1_desc = dpnp.get_dpnp_descriptor(x1, copy_when_nondefault_queue=False)
     if x1_desc:
-        if axis is not None:
-            pass
-        elif out is not None:
+        if out is not None:
             pass
         else:
-            result_obj = dpnp_argmax(x1_desc).get_pyobj()
-            result = dpnp.convert_single_elem_array_to_scalar(result_obj)
+            result_obj = dpnp_argmax(x1_desc, axis).get_pyobj()
+            if axis is None:
+                return dpnp.convert_single_elem_array_to_scalar(result_obj)
 
-            return result
+            return result_obj
 
     return call_origin(numpy.argmax, x1, axis, out)
 
@@ -116,7 +122,7 @@ def argmin(x1, axis=None, out=None):
     -----------
     Input array is supported as :obj:`dpnp.ndarray`.
     Otherwise the function will be executed sequentially on CPU.
-    Parameter ``axis`` is supported only with default value ``None``.
+    Parameter ``axis`` is supported as an integer or ``None``.
     Parameter ``out`` is supported only with default value ``None``.
     Input array data types are limited by supported DPNP :ref:`Data types`.
 
@@ -148,19 +154,120 @@ def argmin(x1, axis=None, out=None):
 
     x1_desc = dpnp.get_dpnp_descriptor(x1, copy_when_nondefault_queue=False)
     if x1_desc:
-        if axis is not None:
-            pass
-        elif out is not None:
+        if out is not None:
             pass
         else:
-            result_obj = dpnp_argmin(x1_desc).get_pyobj()
-            result = dpnp.convert_single_elem_array_to_scalar(result_obj)
+            result_obj = dpnp_argmin(x1_desc, axis).get_pyobj()
+            if axis is None:
+                return dpnp.convert_single_elem_array_to_scalar(result_obj)
 
-            return result
+            return result_obj
 
     return call_origin(numpy.argmin, x1, axis, out)
 
 
+def nanargmax(x1, axis=None, out=None):
+    """
+    Returns the indices of the maximum values along an axis ignoring NaNs.
+
+    For full documentation refer to :obj:`numpy.nanargmax`.
+
+    Limitations
+    -----------
+    Input array is supported as :obj:`dpnp.ndarray`.
+    Otherwise the function will be executed sequentially on CPU.
+    Parameter ``axis`` is supported as an integer or ``None``.
+    Parameter ``out`` is supported only with default value ``None``.
+    Input array data types are limited by supported DPNP :ref:`Data types`.
+
+    Raises
+    ------
+    ValueError
+        If a slice contains only NaNs.
+
+    See Also
+    --------
+    :obj:`dpnp.nanargmin` : Returns the indices of the minimum values along an
+                            axis ignoring NaNs.
+    :obj:`dpnp.argmax` : Returns the indices of the maximum values along an
+                         axis.
+
+    Examples
+    --------
+    >>> import dpnp as np
+    >>> a = np.array([[np.nan, 4], [2, 3]])
+    >>> np.nanargmax(a)
+    1
+    >>> np.nanargmax(a, axis=0)
+    array([1, 0])
+
+    """
+
+    x1_desc = dpnp.get_dpnp_descriptor(x1, copy_when_nondefault_queue=False)
+    if x1_desc:
+        if out is not None:
+            pass
+        else:
+            result_obj = dpnp_nanargmax(x1_desc, axis).get_pyobj()
+            if axis is None:
+                return dpnp.convert_single_elem_array_to_scalar(result_obj)
+
+            return result_obj
+
+    return call_origin(numpy.nanargmax, x1, axis, out)
+
+
+def nanargmin(x1, axis=None, out=None):
+    """
+    Returns the indices of the minimum values along an axis ignoring NaNs.
+
+    For full documentation refer to :obj:`numpy.nanargmin`.
+
+    Limitations
+    -----------
+    Input array is supported as :obj:`dpnp.ndarray`.
+    Otherwise the function will be executed sequentially on CPU.
+    Parameter ``axis`` is supported as an integer or ``None``.
+    Parameter ``out`` is supported only with default value ``None``.
+    Input array data types are limited by supported DPNP :ref:`Data types`.
+
+    Raises
+    ------
+    ValueError
+        If a slice contains only NaNs.
+
+    See Also
+    --------
+    :obj:`dpnp.nanargmax` : Returns the indices of the maximum values along an
+                            axis ignoring NaNs.
+    :obj:`dpnp.argmin` : Returns the indices of the minimum values along an
+                         axis.
+
+    Examples
+    --------
+    >>> import dpnp as np
+    >>> a = np.array([[np.nan, 4], [2, 3]])
+    >>> np.nanargmin(a)
+    2
+    >>> np.nanargmin(a, axis=0)
+    array([1, 1])
+
+    """
+
+    x1_desc = dpnp.get_dpnp_descriptor(x1, copy_when_nondefault_queue=False)
+    if x1_desc:
+        if out is not None:
+            pass
+        else:
+            result_obj = dpnp_nanargmin(x1_desc, axis).get_pyobj()
+            if axis is None:
+                return dpnp.convert_single_elem_array_to_scalar(result_obj)
+
+            return result_obj
+
+    return call_origin(numpy.nanargmin, x1, axis, out)
+
+
 def searchsorted(a, v, side="left", sorter=None):
     """
     Find indices where elements should be inserted to maintain order.
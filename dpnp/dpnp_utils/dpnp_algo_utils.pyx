@@ -833,6 +833,21 @@ cdef class dpnp_descriptor:
 
         return dpt_ti._array_overlap(self.get_array(), other_desc.get_array())
 
+    def is_array_aliased(self, other_desc):
+        """
+        Check if usm_ndarray is the same view of memory as an array from other DPNP descriptor,
+        so an elementwise result may be stored in place of the other array
+        """
+        if not isinstance(other_desc, dpnp_descriptor):
+            raise TypeError("expected dpnp_descriptor, got {}".format(type(other_desc)))
+
+        array = self.get_array()
+        other_array = other_desc.get_array()
+        return (array._pointer == other_array._pointer and
+                array.dtype == other_array.dtype and
+                array.shape == other_array.shape and
+                array.strides == other_array.strides)
+
     cdef void * get_data(self):
         cdef Py_ssize_t item_size = 0
         cdef Py_ssize_t elem_offset = 0
@@ -34,6 +34,8 @@ setup(
             "libdpnp_backend_c.so",
             "dpnp_backend_c.lib",
             "dpnp_backend_c.dll",
+            "*/libdpnp_backend_c.so",
+            "*/dpnp_backend_c.dll",
         ]
     },
     include_package_data=True,
@@ -318,6 +318,24 @@ def test_divide_scalar(shape, dtype):
     assert_allclose(result, expected, rtol=1e-6)
 
 
+@pytest.mark.parametrize("dtype", get_float_complex_dtypes())
+def test_divide_inplace(dtype):
+    np_a = numpy.arange(1, 11, dtype=dtype)
+    np_b = numpy.arange(10, 0, -1, dtype=dtype)
+    dpnp_a = dpnp.array(np_a)
+    dpnp_b = dpnp.array(np_b)
+
+    np_a /= np_b
+    dpnp_a /= dpnp_b
+    assert_allclose(dpnp_a, np_a, rtol=1e-6)
+
+    # output is the same array as an input
+    expected = numpy.divide(np_a, np_b, out=np_a)
+    result = dpnp.divide(dpnp_a, dpnp_b, out=dpnp_a)
+    assert_allclose(result, expected, rtol=1e-6)
+    assert_allclose(dpnp_a, np_a, rtol=1e-6)
+
+
 @pytest.mark.parametrize("shape", [(), (3, 2)], ids=["()", "(3, 2)"])
 @pytest.mark.parametrize("dtype", get_all_dtypes())
 def test_power_scalar(shape, dtype):
@@ -0,0 +1,69 @@
+import threading
+
+import pytest
+
+import dpnp
+from dpnp.dparray import dparray
+from dpnp.dpnp_algo import (
+    dpnp_memory_region,
+    dpnp_memory_stats,
+    dpnp_memory_stats_reset,
+)
+
+
+def test_memory_stats():
+    dpnp_memory_stats_reset()
+    a = dparray((1024,), dtype=dpnp.float64)
+    stats = dpnp_memory_stats()
+
+    assert stats["live_bytes"] >= a.nbytes
+    assert stats["peak_bytes"] >= stats["live_bytes"]
+    assert stats["alloc_count"] >= 1
+    assert sum(stats["histogram"]) == stats["alloc_count"]
+    del a
+
+
+def test_memory_region():
+    with dpnp_memory_region("outer") as outer:
+        with dpnp_memory_region("inner") as inner:
+            a = dparray((1024,), dtype=dpnp.float64)
+            del a
+
+    assert inner.peak_bytes >= 1024 * 8
+    assert outer.peak_bytes >= inner.peak_bytes
+
+
+def test_memory_region_per_thread():
+    worker_started = threading.Event()
+    main_closed = threading.Event()
+    worker_region = dpnp_memory_region("worker")
+
+    def worker():
+        with worker_region:
+            worker_started.set()
+            main_closed.wait()
+            a = dparray((1024,), dtype=dpnp.float64)
+            del a
+
+    main_region = dpnp_memory_region("main")
+    main_region.__enter__()
+    a = dparray((1024,), dtype=dpnp.float64)
+
+    thread = threading.Thread(target=worker)
+    thread.start()
+    worker_started.wait()
+
+    # closes the region of this thread, not the one opened after it
+    main_region.__exit__(None, None, None)
+    main_closed.set()
+    thread.join()
+    del a
+
+    assert main_region.peak_bytes >= 1024 * 8
+    assert worker_region.peak_bytes >= 1024 * 8
+
+
+def test_memory_region_exit_without_enter():
+    region = dpnp_memory_region("unopened")
+    with pytest.raises(RuntimeError):
+        region.__exit__(None, None, None)
@@ -0,0 +1,54 @@
+import numpy
+import pytest
+from numpy.testing import assert_array_equal
+
+import dpnp
+
+from .helper import get_all_dtypes, get_float_dtypes
+
+
+@pytest.mark.parametrize("func", ["argmax", "argmin"])
+@pytest.mark.parametrize("axis", [None, 0, 1, -1])
+@pytest.mark.parametrize(
+    "dtype", get_all_dtypes(no_bool=True, no_complex=True, no_none=True)
+)
+def test_argmax_argmin(func, axis, dtype):
+    np_a = numpy.array([[3, 7, 7, 1], [5, 0, 9, 9], [2, 2, 2, 2]], dtype=dtype)
+    dp_a = dpnp.array(np_a)
+
+    expected = getattr(numpy, func)(np_a, axis=axis)
+    result = getattr(dpnp, func)(dp_a, axis=axis)
+    assert_array_equal(expected, result)
+
+
+@pytest.mark.parametrize("func", ["nanargmax", "nanargmin"])
+@pytest.mark.parametrize("axis", [None, 0, 1])
+@pytest.mark.parametrize("dtype", get_float_dtypes())
+def test_nanargmax_nanargmin(func, axis, dtype):
+    np_a = numpy.array([[numpy.nan, 4, 1], [2, numpy.nan, 3]], dtype=dtype)
+    dp_a = dpnp.array(np_a)
+
+    expected = getattr(numpy, func)(np_a, axis=axis)
+    result = getattr(dpnp, func)(dp_a, axis=axis)
+    assert_array_equal(expected, result)
+
+
+@pytest.mark.parametrize("func", ["nanargmax", "nanargmin"])
+@pytest.mark.parametrize("axis", [None, 0])
+def test_nanargmax_nanargmin_all_nan(func, axis):
+    if axis is None:
+        a = dpnp.full((2, 2), numpy.nan)
+    else:
+        a = dpnp.array([[numpy.nan, 1], [numpy.nan, 2]])
+
+    with pytest.raises(ValueError):
+        getattr(dpnp, func)(a, axis=axis)
+
+
+@pytest.mark.parametrize("func", ["argmax", "argmin"])
+def test_argmax_argmin_empty(func):
+    a = dpnp.empty((0, 3))
+
+    with pytest.raises(ValueError):
+        getattr(dpnp, func)(a)
+    assert getattr(dpnp, func)(a, axis=1).shape == (0,)